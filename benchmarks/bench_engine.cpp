@@ -0,0 +1,59 @@
+#include "Engine.h"
+#include "empty_space.h"
+#include "ilogger.h"
+#include "point_mass.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+using namespace InertiaFX::Core::Engine;
+
+// Discards every message, so the runs measure stepping only
+class NullLogger : public ILogger
+{
+  public:
+    void log(LogLevel, const char *, ...) override
+    {
+    }
+    void enable() override
+    {
+    }
+    void disable() override
+    {
+    }
+    void setThreshold(LogLevel) override
+    {
+    }
+};
+
+static std::unique_ptr<Engine> makeEngine(std::size_t entityCount)
+{
+    auto world = std::make_unique<EmptySpace>();
+    for (std::size_t i = 0; i < entityCount; ++i)
+    {
+        const double offset = static_cast<double>(i);
+        world->addEntity(std::make_unique<PointMass>(
+            Mass(1.0, DecimalPrefix::Name::base),
+            Position({offset, 0.0, 0.0}, DecimalPrefix::Name::base),
+            Velocity({1.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    }
+    return std::make_unique<Engine>(std::make_unique<NullLogger>(), std::move(world));
+}
+
+// Runs 100 steps per iteration over state.range(0) entities; reports steps per second
+static void BM_EngineRun(benchmark::State &state)
+{
+    constexpr double STEPS = 100.0;
+    auto engine            = makeEngine(static_cast<std::size_t>(state.range(0)));
+    const Time runTime(STEPS - 1.0, DecimalPrefix::Name::milli);
+    const Time timeStep(1.0, DecimalPrefix::Name::milli);
+
+    for (auto _ : state)
+    {
+        engine->run(runTime, timeStep);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(STEPS));
+    state.counters["entity_steps/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * STEPS * static_cast<double>(state.range(0)),
+        benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_EngineRun)->RangeMultiplier(10)->Range(1, 100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+#include "empty_space.h"
+#include "point_mass.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+static std::unique_ptr<PointMass> makePointMass(double offset)
+{
+    return std::make_unique<PointMass>(Mass(1.0, DecimalPrefix::Name::base),
+                                       Position({offset, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                       Velocity({1.0, 0.0, 0.0}, DecimalPrefix::Name::base));
+}
+
+static void BM_EntityAddForce(benchmark::State &state)
+{
+    auto entity = makePointMass(0.0);
+    const Force force({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        entity->addForce(force);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EntityAddForce);
+
+// Fills a world with state.range(0) entities; reports entities per second
+static void BM_WorldAddEntity(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::unique_ptr<EmptySpace> world;
+    for (auto _ : state)
+    {
+        // Build the entities and tear down the previous world outside the measurement
+        state.PauseTiming();
+        std::vector<std::unique_ptr<IEntity>> entities;
+        entities.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            entities.push_back(makePointMass(static_cast<double>(i)));
+        }
+        world = std::make_unique<EmptySpace>();
+        state.ResumeTiming();
+
+        for (std::unique_ptr<IEntity> &entity : entities)
+        {
+            world->addEntity(std::move(entity));
+        }
+        benchmark::DoNotOptimize(world->getEntities().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WorldAddEntity)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
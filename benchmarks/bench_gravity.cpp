@@ -0,0 +1,130 @@
+#include "barnes_hut_gravity.h"
+#include "direct_gravity.h"
+#include "empty_space.h"
+#include "fmm_gravity.h"
+#include "point_mass.h"
+#include "thread_pool.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Fills a world with count point masses, uniformly in a unit cube
+static void fillWorld(EmptySpace &world, std::size_t count)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-0.5, 0.5);
+    std::uniform_real_distribution<double> mass(0.5, 2.0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        world.addEntity(std::make_unique<PointMass>(
+            Mass(mass(generator), DecimalPrefix::Name::base),
+            Position({coordinate(generator), coordinate(generator), coordinate(generator)},
+                     DecimalPrefix::Name::base)));
+    }
+}
+
+// Applies the generator once on a world of state.range(0) entities per iteration
+static void runGravity(benchmark::State &state, MutualGravity &gravity)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    EmptySpace world;
+    fillWorld(world, count);
+    ThreadPool pool(std::thread::hardware_concurrency());
+    gravity.setThreadPool(&pool);
+    for (auto _ : state)
+    {
+        gravity.apply(world, 0.0);
+        benchmark::DoNotOptimize(world.getEntityStore().forces().x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+// Exact O(N^2) reference; reports entities per second
+static void BM_DirectGravity(benchmark::State &state)
+{
+    DirectGravity gravity;
+    runGravity(state, gravity);
+}
+BENCHMARK(BM_DirectGravity)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Barnes-Hut at the default opening angle; reports entities per second
+static void BM_BarnesHutGravity(benchmark::State &state)
+{
+    BarnesHutGravity gravity;
+    runGravity(state, gravity);
+}
+BENCHMARK(BM_BarnesHutGravity)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+// Applies the generator to a world of 10000 entities per iteration; reports the largest force
+// error relative to the largest direct force
+static void measureAccuracy(benchmark::State &state, MutualGravity &gravity)
+{
+    EmptySpace world;
+    fillWorld(world, 10000);
+    EntityStore &store = world.getEntityStore();
+    ThreadPool pool(std::thread::hardware_concurrency());
+
+    DirectGravity direct;
+    direct.setThreadPool(&pool);
+    direct.apply(world, 0.0);
+    const Vector3Array reference = store.forces();
+
+    gravity.setThreadPool(&pool);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            std::fill(store.forces()[axis].begin(), store.forces()[axis].end(), 0.0);
+        }
+        state.ResumeTiming();
+        gravity.apply(world, 0.0);
+    }
+
+    double error = 0.0;
+    double scale = 0.0;
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        for (std::size_t i = 0; i < store.size(); ++i)
+        {
+            error = std::max(error, std::abs(store.forces()[axis][i] - reference[axis][i]));
+            scale = std::max(scale, std::abs(reference[axis][i]));
+        }
+    }
+    state.counters["relative_error"] = error / scale;
+}
+
+// Barnes-Hut at opening angle state.range(0) / 10
+static void BM_BarnesHutAccuracy(benchmark::State &state)
+{
+    BarnesHutGravity gravity(static_cast<double>(state.range(0)) / 10.0);
+    measureAccuracy(state, gravity);
+}
+BENCHMARK(BM_BarnesHutAccuracy)->DenseRange(2, 10, 2)->Unit(benchmark::kMillisecond);
+
+// FMM at the default expansion order; reports entities per second
+static void BM_FmmGravity(benchmark::State &state)
+{
+    FmmGravity gravity;
+    runGravity(state, gravity);
+}
+BENCHMARK(BM_FmmGravity)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// FMM at expansion order state.range(0) and the default separation
+static void BM_FmmAccuracy(benchmark::State &state)
+{
+    FmmGravity gravity(static_cast<std::size_t>(state.range(0)));
+    measureAccuracy(state, gravity);
+    state.counters["m2l"] = static_cast<double>(gravity.getM2LCount());
+}
+BENCHMARK(BM_FmmAccuracy)->DenseRange(1, 8, 1)->Unit(benchmark::kMillisecond);
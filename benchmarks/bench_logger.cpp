@@ -0,0 +1,134 @@
+#include "async_logger.h"
+#include "file_logger.h"
+#include "logger.h"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#ifdef _WIN32
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define fileno _fileno
+#define close _close
+#define NULL_DEVICE "NUL"
+#else
+#include <unistd.h>
+#define NULL_DEVICE "/dev/null"
+#endif
+
+using namespace InertiaFX::Core::Tools;
+
+// Sends stdout and stderr to the null device while alive, so console logging does not
+// interleave with the benchmark report
+class SilenceConsole
+{
+  public:
+    SilenceConsole()
+    {
+        std::fflush(stdout);
+        std::fflush(stderr);
+        _stdout         = dup(fileno(stdout));
+        _stderr         = dup(fileno(stderr));
+        FILE *nullFile = std::fopen(NULL_DEVICE, "w");
+        dup2(fileno(nullFile), fileno(stdout));
+        dup2(fileno(nullFile), fileno(stderr));
+        std::fclose(nullFile);
+    }
+
+    ~SilenceConsole()
+    {
+        std::fflush(stdout);
+        std::fflush(stderr);
+        dup2(_stdout, fileno(stdout));
+        dup2(_stderr, fileno(stderr));
+        close(_stdout);
+        close(_stderr);
+    }
+
+  private:
+    int _stdout;
+    int _stderr;
+};
+
+static void BM_LoggerLog(benchmark::State &state)
+{
+    Logger logger;
+    SilenceConsole silence;
+    for (auto _ : state)
+    {
+        logger.log(LogLevel::Info, "Step %d at %g s.", 42, 0.125);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerLog);
+
+// Messages below the threshold must be close to free
+static void BM_LoggerLogFiltered(benchmark::State &state)
+{
+    Logger logger;
+    logger.setThreshold(LogLevel::Error);
+    for (auto _ : state)
+    {
+        logger.log(LogLevel::Debug, "Step %d at %g s.", 42, 0.125);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerLogFiltered);
+
+static void BM_FileLoggerLog(benchmark::State &state)
+{
+    const auto path = std::filesystem::temp_directory_path() / "inertiafx_bench_file_logger.log";
+    {
+        FileLogger logger(path.string(), LogLevel::Info, true);
+        logger.clearLogs();
+        SilenceConsole silence;
+        for (auto _ : state)
+        {
+            logger.log(LogLevel::Info, "Step %d at %g s.", 42, 0.125);
+        }
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FileLoggerLog);
+
+// Same messages, coalesced into 64 KiB writes instead of one write per line
+static void BM_FileLoggerLogBuffered(benchmark::State &state)
+{
+    const auto path = std::filesystem::temp_directory_path() / "inertiafx_bench_file_logger.log";
+    {
+        FileLogger logger(path.string(), LogLevel::Info, true, FileSinkOptions{});
+        logger.clearLogs();
+        SilenceConsole silence;
+        for (auto _ : state)
+        {
+            logger.log(LogLevel::Info, "Step %d at %g s.", 42, 0.125);
+        }
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FileLoggerLogBuffered);
+
+// Producer-side cost only: there are no sinks and a full queue drops the record
+static void BM_AsyncLoggerLog(benchmark::State &state)
+{
+    AsyncLogger logger(1 << 16, OverflowPolicy::DropNewest);
+    for (auto _ : state)
+    {
+        logger.log(LogLevel::Info, "Step %d at %g s.", 42, 0.125);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AsyncLoggerLog);
+
+static void BM_AsyncLoggerLogDeferred(benchmark::State &state)
+{
+    AsyncLogger logger(1 << 16, OverflowPolicy::DropNewest);
+    for (auto _ : state)
+    {
+        logger.logDeferred(LogLevel::Info, "Step %d at %g s.", 42, 0.125);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AsyncLoggerLogDeferred);
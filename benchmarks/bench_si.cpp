@@ -0,0 +1,140 @@
+#include "decimal_prefix.h"
+#include "force.h"
+#include "velocity.h"
+#include "volume.h"
+#include <benchmark/benchmark.h>
+
+using namespace InertiaFX::Core::SI;
+
+// Construction from a prefixed value, converted to base units
+static void BM_VelocityConstruct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        Velocity velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+        benchmark::DoNotOptimize(velocity);
+    }
+}
+BENCHMARK(BM_VelocityConstruct);
+
+static void BM_VelocityCopy(benchmark::State &state)
+{
+    const Velocity source({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Velocity copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_VelocityCopy);
+
+static void BM_VelocityAdd(benchmark::State &state)
+{
+    const Velocity a({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    const Velocity b({4.0, 5.0, 6.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Velocity sum = a + b;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_VelocityAdd);
+
+static void BM_VelocityConvert(benchmark::State &state)
+{
+    const Velocity velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        auto value = velocity.getValueIn(DecimalPrefix::Name::milli);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_VelocityConvert);
+
+static void BM_VolumeConstruct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        Volume volume(1.0, 2.0, 3.0, DecimalPrefix::Name::centi);
+        benchmark::DoNotOptimize(volume);
+    }
+}
+BENCHMARK(BM_VolumeConstruct);
+
+static void BM_VolumeCopy(benchmark::State &state)
+{
+    const Volume source(1.0, 2.0, 3.0, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Volume copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_VolumeCopy);
+
+static void BM_VolumeAdd(benchmark::State &state)
+{
+    const Volume a(1.0, 2.0, 3.0, DecimalPrefix::Name::base);
+    const Volume b(4.0, 5.0, 6.0, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Volume sum = a + b;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_VolumeAdd);
+
+static void BM_VolumeConvert(benchmark::State &state)
+{
+    const Volume volume(1.0, 2.0, 3.0, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        double value = volume.getValueIn(DecimalPrefix::Name::centi);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_VolumeConvert);
+
+static void BM_ForceConstruct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        Force force({1.0, 2.0, 3.0}, DecimalPrefix::Name::mega);
+        benchmark::DoNotOptimize(force);
+    }
+}
+BENCHMARK(BM_ForceConstruct);
+
+static void BM_ForceCopy(benchmark::State &state)
+{
+    const Force source({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Force copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ForceCopy);
+
+static void BM_ForceAdd(benchmark::State &state)
+{
+    const Force a({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    const Force b({4.0, 5.0, 6.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        Force sum = a + b;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ForceAdd);
+
+static void BM_ForceConvert(benchmark::State &state)
+{
+    const Force force({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    for (auto _ : state)
+    {
+        auto value = force.getValueIn(DecimalPrefix::Name::kilo);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_ForceConvert);
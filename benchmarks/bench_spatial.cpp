@@ -0,0 +1,312 @@
+#include "bounding_volume_hierarchy.h"
+#include "empty_space.h"
+#include "entity.h"
+#include "medium_index.h"
+#include "point_mass.h"
+#include "spatial_hash_grid.h"
+#include "thread_pool.h"
+#include "water.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Sphere shaped entity of any radius
+class Ball : public Entity
+{
+  public:
+    Ball(double radius, const Position &position) :
+        Entity(Mass(1.0, DecimalPrefix::Name::base), Volume(radius, DecimalPrefix::Name::base),
+               position)
+    {
+    }
+
+    std::unique_ptr<IEntity> clone() const override
+    {
+        return std::make_unique<Ball>(*this);
+    }
+};
+
+// Fills a store with count entities, about one per cubic metre
+static void fillStore(EntityStore &store, std::size_t count)
+{
+    const double extent = 0.5 * std::cbrt(static_cast<double>(count));
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-extent, extent);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        PointMass entity(
+            Mass(1.0, DecimalPrefix::Name::base),
+            Position({coordinate(generator), coordinate(generator), coordinate(generator)},
+                     DecimalPrefix::Name::base));
+        store.add(entity);
+    }
+}
+
+// Builds the grid from scratch over state.range(0) entities; reports entities per second
+static void BM_SpatialHashGridRebuild(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    EntityStore store;
+    fillStore(store, count);
+    ThreadPool pool(std::thread::hardware_concurrency());
+    SpatialHashGrid grid(1.0);
+    for (auto _ : state)
+    {
+        grid.rebuild(store, &pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialHashGridRebuild)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Updates the grid after a small step that moves about 1% of the entities across a cell edge
+static void BM_SpatialHashGridUpdate(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    EntityStore store;
+    fillStore(store, count);
+    ThreadPool pool(std::thread::hardware_concurrency());
+    SpatialHashGrid grid(1.0);
+    grid.setEnabled(true);
+    grid.update(store, &pool);
+    double step = 0.005;
+    for (auto _ : state)
+    {
+        for (double &x : store.positions().x)
+        {
+            x += step;
+        }
+        step = -step;
+        grid.update(store, &pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialHashGridUpdate)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Finds the neighbours within 1.5 m of 100000 entities; reports queries per second
+static void BM_SpatialHashGridRadiusQuery(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    EntityStore store;
+    fillStore(store, count);
+    SpatialHashGrid grid(1.5);
+    grid.rebuild(store);
+    const Vector3Array &positions = store.positions();
+    const std::size_t queries     = 100000;
+    for (auto _ : state)
+    {
+        std::size_t neighbours = 0;
+        for (std::size_t q = 0; q < queries; ++q)
+        {
+            const std::size_t i = q * (count / queries);
+            grid.forEachInRadius({positions.x[i], positions.y[i], positions.z[i]}, 1.5,
+                                 [&neighbours](std::size_t, double) { ++neighbours; });
+        }
+        benchmark::DoNotOptimize(neighbours);
+    }
+    state.SetItemsProcessed(state.iterations() * queries);
+}
+BENCHMARK(BM_SpatialHashGridRadiusQuery)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Finds the 8 nearest neighbours of 10000 entities; reports queries per second
+static void BM_SpatialHashGridNearestQuery(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    EntityStore store;
+    fillStore(store, count);
+    SpatialHashGrid grid;
+    grid.rebuild(store);
+    const Vector3Array &positions = store.positions();
+    const std::size_t queries     = 10000;
+    std::vector<std::size_t> result;
+    for (auto _ : state)
+    {
+        for (std::size_t q = 0; q < queries; ++q)
+        {
+            const std::size_t i = q * (count / queries);
+            grid.queryNearest({positions.x[i], positions.y[i], positions.z[i]}, 8, result);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * queries);
+}
+BENCHMARK(BM_SpatialHashGridNearestQuery)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Fills a world with count spheres of radii from 1 cm to 1 m, about one per cubic metre
+static std::unique_ptr<EmptySpace> makeBallWorld(std::size_t count)
+{
+    const double extent = 0.5 * std::cbrt(static_cast<double>(count));
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-extent, extent);
+    std::uniform_real_distribution<double> exponent(-2.0, 0.0);
+    auto world = std::make_unique<EmptySpace>();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        world->addEntity(std::make_unique<Ball>(
+            std::pow(10.0, exponent(generator)),
+            Position({coordinate(generator), coordinate(generator), coordinate(generator)},
+                     DecimalPrefix::Name::base)));
+    }
+    return world;
+}
+
+// Builds the entity tree with the surface area heuristic; reports entities per second
+static void BM_BoundingVolumeHierarchyRebuild(benchmark::State &state)
+{
+    auto world = makeBallWorld(static_cast<std::size_t>(state.range(0)));
+    BoundingVolumeHierarchy bvh;
+    for (auto _ : state)
+    {
+        bvh.rebuild(world->getEntities(), world->getEntityStore(), world->getMediums());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BoundingVolumeHierarchyRebuild)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Updates the trees after a step moving every entity by 5 cm, half the default margin
+static void BM_BoundingVolumeHierarchyUpdate(benchmark::State &state)
+{
+    auto world = makeBallWorld(static_cast<std::size_t>(state.range(0)));
+    ThreadPool pool(std::thread::hardware_concurrency());
+    BoundingVolumeHierarchy bvh;
+    bvh.setEnabled(true);
+    bvh.update(world->getEntities(), world->getEntityStore(), world->getMediums(), &pool);
+    double step = 0.05;
+    for (auto _ : state)
+    {
+        for (double &x : world->getEntityStore().positions().x)
+        {
+            x += step;
+        }
+        step = -step;
+        bvh.update(world->getEntities(), world->getEntityStore(), world->getMediums(), &pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BoundingVolumeHierarchyUpdate)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Casts 10000 rays across the world; reports rays per second
+static void BM_BoundingVolumeHierarchyRay(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto world       = makeBallWorld(count);
+    BoundingVolumeHierarchy bvh;
+    bvh.rebuild(world->getEntities(), world->getEntityStore(), world->getMediums());
+    const double extent = 0.5 * std::cbrt(static_cast<double>(count));
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> coordinate(-extent, extent);
+    std::vector<std::array<double, 3>> origins(10000);
+    for (std::array<double, 3> &origin : origins)
+    {
+        origin = {-extent, coordinate(generator), coordinate(generator)};
+    }
+    std::vector<BoundingVolumeHierarchy::Hit> hits;
+    for (auto _ : state)
+    {
+        for (const std::array<double, 3> &origin : origins)
+        {
+            bvh.queryRay(origin, {1.0, 0.0, 0.0}, 2.0 * extent, hits);
+        }
+        benchmark::DoNotOptimize(hits.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(origins.size()));
+}
+BENCHMARK(BM_BoundingVolumeHierarchyRay)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// A 10 x 10 x 10 lattice of 4 m water cubes, 5 m apart, and count entities among them
+static void makeMediumScene(std::size_t count, std::vector<std::unique_ptr<IMedium>> &mediums,
+                            EntityStore &store)
+{
+    for (int x = 0; x < 10; ++x)
+    {
+        for (int y = 0; y < 10; ++y)
+        {
+            for (int z = 0; z < 10; ++z)
+            {
+                mediums.push_back(std::make_unique<Water>(
+                    Position({5.0 * x, 5.0 * y, 5.0 * z}, DecimalPrefix::Name::base),
+                    Volume(4.0, 4.0, 4.0, DecimalPrefix::Name::base)));
+            }
+        }
+    }
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-2.5, 47.5);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        PointMass entity(
+            Mass(1.0, DecimalPrefix::Name::base),
+            Position({coordinate(generator), coordinate(generator), coordinate(generator)},
+                     DecimalPrefix::Name::base));
+        store.add(entity);
+    }
+}
+
+// Finds the medium of every entity after a 1 cm step; reports entities per second
+static void BM_MediumIndexUpdate(benchmark::State &state)
+{
+    std::vector<std::unique_ptr<IMedium>> mediums;
+    EntityStore store;
+    makeMediumScene(static_cast<std::size_t>(state.range(0)), mediums, store);
+    ThreadPool pool(std::thread::hardware_concurrency());
+    MediumIndex index;
+    index.setEnabled(true);
+    index.update(mediums, store, &pool);
+    double step = 0.01;
+    for (auto _ : state)
+    {
+        for (double &x : store.positions().x)
+        {
+            x += step;
+        }
+        step = -step;
+        index.update(mediums, store, &pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MediumIndexUpdate)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Baseline: tests every medium for every entity; reports entities per second
+static void BM_MediumLinearScan(benchmark::State &state)
+{
+    std::vector<std::unique_ptr<IMedium>> mediums;
+    EntityStore store;
+    makeMediumScene(static_cast<std::size_t>(state.range(0)), mediums, store);
+    const Vector3Array &positions = store.positions();
+    std::vector<std::uint32_t> found(store.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < store.size(); ++i)
+        {
+            const std::array<double, 3> point = {positions.x[i], positions.y[i], positions.z[i]};
+            found[i]                          = MediumIndex::NO_MEDIUM;
+            for (std::size_t m = 0; m < mediums.size(); ++m)
+            {
+                const BoundingShape shape = getBoundingShape(mediums[m]->getVolume());
+                if (shape.contains(mediums[m]->getPosition().getValue(), point))
+                {
+                    found[i] = static_cast<std::uint32_t>(m);
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(found.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MediumLinearScan)->Arg(10000)->Unit(benchmark::kMillisecond);
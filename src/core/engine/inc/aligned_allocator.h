@@ -0,0 +1,106 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file aligned_allocator.h
+ * @brief Declaration of the AlignedAllocator class template.
+ *
+ * @details Standard allocator that hands out storage aligned to a cache line, so contiguous
+ * numeric arrays start on a line boundary and can be streamed with aligned vector loads.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_ALIGNED_ALLOCATOR_H
+#define INERTIAFX_CORE_ENGINE_ALIGNED_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class AlignedAllocator
+         * @brief Allocator returning memory aligned to Alignment bytes.
+         * @tparam T The element type.
+         * @tparam Alignment The alignment in bytes. It defaults to a 64 byte cache line.
+         */
+        template <typename T, std::size_t Alignment = 64>
+        class AlignedAllocator
+        {
+          public:
+            using value_type = T;
+
+            /**
+             * @brief Rebinds the allocator to another element type, keeping the alignment.
+             */
+            template <typename U>
+            struct rebind
+            {
+                using other = AlignedAllocator<U, Alignment>;
+            };
+
+            AlignedAllocator() noexcept = default;
+
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept
+            {
+            }
+
+            /**
+             * @brief Allocates uninitialised storage for n elements.
+             * @param n The number of elements.
+             * @return Pointer to storage aligned to Alignment bytes.
+             */
+            T *allocate(std::size_t n)
+            {
+                return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+            }
+
+            /**
+             * @brief Releases storage obtained from allocate().
+             * @param p Pointer returned by allocate().
+             */
+            void deallocate(T *p, std::size_t) noexcept
+            {
+                ::operator delete(p, std::align_val_t(Alignment));
+            }
+
+            template <typename U>
+            bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+            {
+                return true;
+            }
+        };
+
+        /**
+         * @brief std::vector whose storage starts on a cache line boundary.
+         */
+        template <typename T>
+        using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_ALIGNED_ALLOCATOR_H
@@ -0,0 +1,155 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file barnes_hut_gravity.h
+ * @brief Declaration of the BarnesHutGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_BARNES_HUT_GRAVITY_H
+#define INERTIAFX_CORE_ENGINE_BARNES_HUT_GRAVITY_H
+
+#include "gravity_octree.h"
+#include "mutual_gravity.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class BarnesHutGravity
+         * @brief Mutual gravitation approximated with a Barnes-Hut octree, in O(N log N).
+         *
+         * Each evaluation sorts the entities along a Morton curve and builds an octree over
+         * them, each cell holding its mass and centre of mass. An entity then walks the tree
+         * and treats a whole cell as one point mass when the cell looks small from there:
+         * when its edge s and the distance d to its centre of mass satisfy d > s / theta + delta,
+         * delta being the offset of the centre of mass from the cell centre. Smaller opening
+         * angles theta are more accurate and slower; theta = 0 sums every pair exactly.
+         *
+         * The tree is a GravityOctree built on the engine's pool, the cells are summarised level
+         * by level in parallel, and the tree walks run in parallel over the entities, in curve
+         * order so that neighbouring walks touch the same cells. Results do not depend on the
+         * worker count.
+         */
+        class BarnesHutGravity : public MutualGravity
+        {
+          public:
+            /**
+             * @brief Default opening angle.
+             */
+            static constexpr double DEFAULT_THETA = 0.5;
+
+            /**
+             * @brief Default maximum number of entities in a leaf cell.
+             */
+            static constexpr std::size_t DEFAULT_LEAF_CAPACITY = 8;
+
+            /**
+             * @brief Minimum number of entities per parallel chunk of the tree walks.
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 256;
+
+            /**
+             * @brief Constructs a generator with the SI constant and no softening.
+             * @param theta Opening angle.
+             */
+            explicit BarnesHutGravity(double theta = DEFAULT_THETA);
+
+            /**
+             * @copydoc IForceGenerator::apply(IWorld &, double)
+             */
+            void apply(IWorld &world, double time) override;
+
+            /**
+             * @brief Sets the opening angle.
+             * @param theta The angle; 0 is exact, 0.3 to 0.7 are usual.
+             */
+            void setTheta(double theta)
+            {
+                _theta = theta;
+            }
+
+            /**
+             * @brief Retrieves the opening angle.
+             * @return The angle.
+             */
+            double getTheta() const
+            {
+                return _theta;
+            }
+
+            /**
+             * @brief Sets the number of entities up to which a cell is not split.
+             * @param leafCapacity The capacity; 0 is treated as 1.
+             */
+            void setLeafCapacity(std::size_t leafCapacity)
+            {
+                _leafCapacity = leafCapacity;
+            }
+
+            /**
+             * @brief Retrieves the number of entities up to which a cell is not split.
+             * @return The capacity.
+             */
+            std::size_t getLeafCapacity() const
+            {
+                return _leafCapacity;
+            }
+
+            /**
+             * @brief Retrieves the number of cells of the last tree.
+             * @return The cell count.
+             */
+            std::size_t getNodeCount() const
+            {
+                return _tree.getNodes().size();
+            }
+
+          private:
+            /**
+             * @brief Mass summary of an octree cell.
+             */
+            struct Cell
+            {
+                std::array<double, 3> centreOfMass; /**< Centre of mass, in metres. */
+                double mass;                        /**< Total mass, in kilograms. */
+                double openingRadius;               /**< Cells nearer than this are opened. */
+            };
+
+            void summarise(std::uint32_t node);
+            std::array<double, 3> walk(std::size_t body) const;
+
+            double _theta;             /**< Opening angle. */
+            std::size_t _leafCapacity; /**< Bodies up to which a cell is not split. */
+            GravityOctree _tree;       /**< Octree over the massive entities. */
+            std::vector<Cell> _cells;  /**< Summary of each cell of _tree. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_BARNES_HUT_GRAVITY_H
@@ -0,0 +1,220 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file bounding_volume.h
+ * @brief Bounding shapes of entity and medium volumes, for the spatial indices.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_H
+#define INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_H
+
+#include "volume.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+using namespace InertiaFX::Core::SI;
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @struct Aabb
+         * @brief Axis-aligned bounding box, in metres.
+         */
+        struct Aabb
+        {
+            std::array<double, 3> min; /**< Lowest corner. */
+            std::array<double, 3> max; /**< Highest corner. */
+
+            /**
+             * @brief Checks whether a point lies inside the box, boundary included.
+             */
+            bool contains(const std::array<double, 3> &point) const
+            {
+                return min[0] <= point[0] && point[0] <= max[0] && min[1] <= point[1] &&
+                       point[1] <= max[1] && min[2] <= point[2] && point[2] <= max[2];
+            }
+
+            /**
+             * @brief Checks whether another box lies inside this one.
+             */
+            bool contains(const Aabb &other) const
+            {
+                return min[0] <= other.min[0] && other.max[0] <= max[0] &&
+                       min[1] <= other.min[1] && other.max[1] <= max[1] &&
+                       min[2] <= other.min[2] && other.max[2] <= max[2];
+            }
+
+            /**
+             * @brief Checks whether two boxes share at least one point.
+             */
+            bool overlaps(const Aabb &other) const
+            {
+                return min[0] <= other.max[0] && other.min[0] <= max[0] &&
+                       min[1] <= other.max[1] && other.min[1] <= max[1] &&
+                       min[2] <= other.max[2] && other.min[2] <= max[2];
+            }
+
+            /**
+             * @brief Smallest box holding both boxes.
+             */
+            Aabb merged(const Aabb &other) const
+            {
+                return {{std::min(min[0], other.min[0]), std::min(min[1], other.min[1]),
+                         std::min(min[2], other.min[2])},
+                        {std::max(max[0], other.max[0]), std::max(max[1], other.max[1]),
+                         std::max(max[2], other.max[2])}};
+            }
+
+            /**
+             * @brief Box grown by margin on every side.
+             */
+            Aabb expanded(double margin) const
+            {
+                return {{min[0] - margin, min[1] - margin, min[2] - margin},
+                        {max[0] + margin, max[1] + margin, max[2] + margin}};
+            }
+
+            /**
+             * @brief Centre of the box.
+             */
+            std::array<double, 3> centre() const
+            {
+                return {0.5 * (min[0] + max[0]), 0.5 * (min[1] + max[1]),
+                        0.5 * (min[2] + max[2])};
+            }
+
+            /**
+             * @brief Surface area, the cost measure of the surface area heuristic.
+             */
+            double surfaceArea() const
+            {
+                const double dx = max[0] - min[0];
+                const double dy = max[1] - min[1];
+                const double dz = max[2] - min[2];
+                return 2.0 * (dx * dy + dy * dz + dz * dx);
+            }
+
+            /**
+             * @brief Slab test of a ray against the box.
+             * @param origin Start of the ray.
+             * @param inverseDirection 1 / direction, per axis (infinite for zero components).
+             * @param maxDistance Length of the ray, in units of the direction.
+             * @param entry Receives where the ray enters the box, 0 if it starts inside.
+             * @return True if the ray meets the box within maxDistance.
+             */
+            bool intersectsRay(const std::array<double, 3> &origin,
+                               const std::array<double, 3> &inverseDirection, double maxDistance,
+                               double &entry) const
+            {
+                double near = 0.0;
+                double far  = maxDistance;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double t0 = (min[axis] - origin[axis]) * inverseDirection[axis];
+                    double t1 = (max[axis] - origin[axis]) * inverseDirection[axis];
+                    if (t0 > t1)
+                    {
+                        std::swap(t0, t1);
+                    }
+                    // Written so that NaN (a zero direction on a slab boundary) keeps the ray
+                    near = (t0 > near) ? t0 : near;
+                    far  = (t1 < far) ? t1 : far;
+                    if (near > far)
+                    {
+                        return false;
+                    }
+                }
+                entry = near;
+                return true;
+            }
+        };
+
+        /**
+         * @struct BoundingShape
+         * @brief Box or sphere a volume occupies around its centre, in metres.
+         *
+         * Volumes have no orientation, so boxes are taken as axis aligned.
+         */
+        struct BoundingShape
+        {
+            Volume::Type type;                 /**< Box or Sphere. */
+            std::array<double, 3> halfExtents; /**< Half the box edges, or the sphere radius. */
+
+            /**
+             * @brief Tight bounding box of the shape centred on a point.
+             */
+            Aabb boundsAt(const std::array<double, 3> &centre) const
+            {
+                return {{centre[0] - halfExtents[0], centre[1] - halfExtents[1],
+                         centre[2] - halfExtents[2]},
+                        {centre[0] + halfExtents[0], centre[1] + halfExtents[1],
+                         centre[2] + halfExtents[2]}};
+            }
+
+            /**
+             * @brief Checks whether a point lies inside the shape centred on centre.
+             */
+            bool contains(const std::array<double, 3> &centre,
+                          const std::array<double, 3> &point) const;
+
+            /**
+             * @brief Checks whether the shape centred on centre overlaps a box.
+             */
+            bool overlaps(const std::array<double, 3> &centre, const Aabb &box) const;
+
+            /**
+             * @brief Intersects a ray with the shape centred on centre.
+             * @param centre Centre of the shape.
+             * @param origin Start of the ray.
+             * @param direction Direction of the ray, of unit length.
+             * @param maxDistance Length of the ray.
+             * @param distance Receives where the ray enters the shape, 0 if it starts inside.
+             * @return True if the ray meets the shape within maxDistance.
+             */
+            bool intersectsRay(const std::array<double, 3> &centre,
+                               const std::array<double, 3> &origin,
+                               const std::array<double, 3> &direction, double maxDistance,
+                               double &distance) const;
+        };
+
+        /**
+         * @brief Shape of a volume, in metres.
+         * @param volume A box or sphere volume.
+         * @return The box half edges, or the sphere radius on every axis.
+         */
+        BoundingShape getBoundingShape(const Volume &volume);
+
+        /**
+         * @brief Radius of the smallest sphere around a volume centred on its position.
+         * @param volume A box or sphere volume.
+         * @return The sphere radius for spheres, the half diagonal for boxes, in metres.
+         */
+        double getBoundingRadius(const Volume &volume);
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_H
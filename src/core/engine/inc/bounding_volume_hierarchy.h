@@ -0,0 +1,237 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file bounding_volume_hierarchy.h
+ * @brief Declaration of the BoundingVolumeHierarchy class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_HIERARCHY_H
+#define INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_HIERARCHY_H
+
+#include "bounding_volume.h"
+#include "dynamic_aabb_tree.h"
+#include "entity_store.h"
+#include "ientity.h"
+#include "imedium.h"
+#include "thread_pool.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class BoundingVolumeHierarchy
+         * @brief Dynamic AABB trees over the entities and mediums of a world, answering
+         * overlap, point and ray queries against their exact box or sphere shapes.
+         *
+         * Unlike SpatialHashGrid it copes with objects of very different sizes. Entity shapes
+         * are read from IEntity::getVolume() on rebuild and their positions from the
+         * EntityStore on each update(); medium shapes and positions are read on each update().
+         */
+        class BoundingVolumeHierarchy
+        {
+          public:
+            /**
+             * @brief Kind of object a query hit.
+             */
+            enum class Kind
+            {
+                Entity, /**< Index into IWorld::getEntities(). */
+                Medium  /**< Index into IWorld::getMediums(). */
+            };
+
+            /**
+             * @struct Hit
+             * @brief Object found by a query.
+             */
+            struct Hit
+            {
+                Kind kind;         /**< Entity or medium. */
+                std::size_t index; /**< Index of the object in the world. */
+                double distance;   /**< Where a ray enters the object, 0 for other queries. */
+
+                bool operator==(const Hit &other) const = default;
+            };
+
+            /**
+             * @brief Minimum number of entities per parallel chunk of update().
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 4096;
+
+            /**
+             * @brief Constructs a disabled, empty hierarchy.
+             * @param margin Margin of the fat boxes, in metres.
+             */
+            explicit BoundingVolumeHierarchy(double margin = DynamicAabbTree::DEFAULT_MARGIN);
+
+            /**
+             * @brief Sets whether update() maintains the hierarchy.
+             * @param enabled If false, update() does nothing and queries see the last state.
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * @brief Indicates whether update() maintains the hierarchy.
+             * @return True if enabled.
+             */
+            bool isEnabled() const
+            {
+                return _enabled;
+            }
+
+            /**
+             * @brief Sets the margin of the fat boxes; the next update() rebuilds the trees.
+             * @param margin Margin, in metres. Larger margins reinsert moving objects less often
+             * but make queries visit more of them.
+             */
+            void setMargin(double margin);
+
+            /**
+             * @brief Retrieves the margin of the fat boxes.
+             * @return The margin, in metres.
+             */
+            double getMargin() const
+            {
+                return _margin;
+            }
+
+            /**
+             * @brief Makes the next update() rebuild the trees, e.g. after objects were added.
+             */
+            void invalidate();
+
+            /**
+             * @brief Brings the trees up to date with the entity and medium positions.
+             * @param entities Entities of the world.
+             * @param store State of the entities. It must outlive the queries.
+             * @param mediums Mediums of the world.
+             * @param threadPool Pool running the entity pass, or nullptr to run serially.
+             * @return True if the trees were rebuilt.
+             */
+            bool update(const std::vector<std::unique_ptr<IEntity>> &entities,
+                        const EntityStore &store,
+                        const std::vector<std::unique_ptr<IMedium>> &mediums,
+                        ThreadPool *threadPool = nullptr);
+
+            /**
+             * @brief Rebuilds both trees from scratch with the surface area heuristic.
+             * @param entities Entities of the world.
+             * @param store State of the entities. It must outlive the queries.
+             * @param mediums Mediums of the world.
+             */
+            void rebuild(const std::vector<std::unique_ptr<IEntity>> &entities,
+                         const EntityStore &store,
+                         const std::vector<std::unique_ptr<IMedium>> &mediums);
+
+            /**
+             * @brief Retrieves how many times a moving object left its fat box.
+             * @return The reinsertion count since construction.
+             */
+            std::uint64_t getReinsertCount() const
+            {
+                return _reinsertCount;
+            }
+
+            /**
+             * @brief Retrieves the tree over the entities; proxy user data are entity indices.
+             * @return The entity tree.
+             */
+            const DynamicAabbTree &getEntityTree() const
+            {
+                return _entityTree;
+            }
+
+            /**
+             * @brief Retrieves the tree over the mediums; proxy user data are medium indices.
+             * @return The medium tree.
+             */
+            const DynamicAabbTree &getMediumTree() const
+            {
+                return _mediumTree;
+            }
+
+            /**
+             * @brief Finds the objects overlapping a box.
+             * @param box The query box, in metres.
+             * @param result Receives the objects, entities first, in no particular order.
+             */
+            void queryOverlap(const Aabb &box, std::vector<Hit> &result) const;
+
+            /**
+             * @brief Finds the objects containing a point.
+             * @param point The query point, in metres.
+             * @param result Receives the objects, entities first, in no particular order.
+             */
+            void queryPoint(const std::array<double, 3> &point, std::vector<Hit> &result) const;
+
+            /**
+             * @brief Finds the objects a ray meets.
+             * @param origin Start of the ray, in metres.
+             * @param direction Direction of the ray; need not be of unit length.
+             * @param maxDistance Length of the ray, in metres.
+             * @param result Receives the objects, nearest entry first.
+             */
+            void queryRay(const std::array<double, 3> &origin,
+                          const std::array<double, 3> &direction, double maxDistance,
+                          std::vector<Hit> &result) const;
+
+          private:
+            /**
+             * @brief Current centre of entity index.
+             */
+            std::array<double, 3> entityCentre(std::size_t index) const
+            {
+                const Vector3Array &positions = _store->positions();
+                return {positions.x[index], positions.y[index], positions.z[index]};
+            }
+
+            /**
+             * @brief Reads the medium shapes and positions and moves their proxies.
+             */
+            void updateMediums(const std::vector<std::unique_ptr<IMedium>> &mediums);
+
+            bool _enabled;                /**< update() maintains the trees. */
+            bool _dirty;                  /**< The next update() rebuilds the trees. */
+            double _margin;               /**< Margin of the fat boxes. */
+            std::uint64_t _reinsertCount; /**< Objects that left their fat box. */
+
+            const EntityStore *_store;                         /**< Entities of the last update. */
+            DynamicAabbTree _entityTree;                       /**< Tree over the entities. */
+            DynamicAabbTree _mediumTree;                       /**< Tree over the mediums. */
+            std::vector<BoundingShape> _entityShapes;          /**< Shape of each entity. */
+            std::vector<std::int32_t> _entityProxies;          /**< Proxy of each entity. */
+            std::vector<std::uint8_t> _entityEscaped;          /**< Entities out of their box. */
+            std::vector<BoundingShape> _mediumShapes;          /**< Shape of each medium. */
+            std::vector<std::array<double, 3>> _mediumCentres; /**< Centre of each medium. */
+            std::vector<std::int32_t> _mediumProxies;          /**< Proxy of each medium. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_BOUNDING_VOLUME_HIERARCHY_H
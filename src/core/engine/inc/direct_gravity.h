@@ -0,0 +1,71 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file direct_gravity.h
+ * @brief Declaration of the DirectGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_DIRECT_GRAVITY_H
+#define INERTIAFX_CORE_ENGINE_DIRECT_GRAVITY_H
+
+#include "mutual_gravity.h"
+#include <cstddef>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class DirectGravity
+         * @brief Mutual gravitation summed exactly over all pairs, in O(N^2).
+         *
+         * The reference for the approximate solvers, and the fastest choice for a few thousand
+         * entities or fewer.
+         */
+        class DirectGravity : public MutualGravity
+        {
+          public:
+            /**
+             * @brief Minimum number of target entities per parallel chunk.
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 64;
+
+            /**
+             * @brief Constructs a generator with the SI constant and no softening.
+             */
+            DirectGravity() = default;
+
+            /**
+             * @copydoc IForceGenerator::apply(IWorld &, double)
+             */
+            void apply(IWorld &world, double time) override;
+
+          private:
+            std::vector<double> _masses; /**< Mass of each entity, in kilograms. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_DIRECT_GRAVITY_H
@@ -0,0 +1,327 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file dynamic_aabb_tree.h
+ * @brief Declaration of the DynamicAabbTree class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_DYNAMIC_AABB_TREE_H
+#define INERTIAFX_CORE_ENGINE_DYNAMIC_AABB_TREE_H
+
+#include "bounding_volume.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class DynamicAabbTree
+         * @brief Bounding volume hierarchy of axis-aligned boxes that supports moving objects.
+         *
+         * Each object is a proxy: a leaf holding a "fat" box, its tight box grown by a margin.
+         * moveProxy() leaves the tree untouched while the tight box stays inside the fat one,
+         * so objects jittering in place cost nothing. Leaves are inserted next to the sibling
+         * that grows the tree surface area the least and the tree is kept height balanced by
+         * rotations; rebuild() rebuilds it top-down with the binned surface area heuristic.
+         *
+         * Proxy ids are leaf node indices. They stay valid until destroyProxy() or clear(),
+         * including across rebuild().
+         */
+        class DynamicAabbTree
+        {
+          public:
+            /**
+             * @brief Id of no node.
+             */
+            static constexpr std::int32_t NULL_NODE = -1;
+
+            /**
+             * @brief Default margin added around tight boxes, in metres.
+             */
+            static constexpr double DEFAULT_MARGIN = 0.1;
+
+            /**
+             * @brief Constructs an empty tree.
+             * @param margin Margin added around tight boxes, in metres.
+             */
+            explicit DynamicAabbTree(double margin = DEFAULT_MARGIN);
+
+            /**
+             * @brief Sets the margin of the proxies created or moved from now on.
+             * @param margin Margin added around tight boxes, in metres.
+             */
+            void setMargin(double margin)
+            {
+                _margin = margin;
+            }
+
+            /**
+             * @brief Retrieves the margin added around tight boxes.
+             * @return The margin, in metres.
+             */
+            double getMargin() const
+            {
+                return _margin;
+            }
+
+            /**
+             * @brief Inserts an object.
+             * @param box Tight box of the object.
+             * @param userData Value handed back by getUserData(), e.g. an index.
+             * @return The proxy id.
+             */
+            std::int32_t createProxy(const Aabb &box, std::uint32_t userData);
+
+            /**
+             * @brief Inserts many objects at once and rebuilds the tree.
+             * @param boxes Tight boxes of the objects; object i gets user data i.
+             * @param proxyIds Receives the proxy id of each object.
+             *
+             * Cheaper than createProxy() for each box followed by rebuild().
+             */
+            void createProxies(const std::vector<Aabb> &boxes, std::vector<std::int32_t> &proxyIds);
+
+            /**
+             * @brief Removes an object.
+             * @param proxyId Id returned by createProxy().
+             */
+            void destroyProxy(std::int32_t proxyId);
+
+            /**
+             * @brief Updates the box of an object.
+             * @param proxyId Id returned by createProxy().
+             * @param box New tight box of the object.
+             * @return True if the box escaped the fat box and the proxy was reinserted.
+             */
+            bool moveProxy(std::int32_t proxyId, const Aabb &box);
+
+            /**
+             * @brief Removes every object.
+             */
+            void clear();
+
+            /**
+             * @brief Rebuilds the tree top-down with the surface area heuristic.
+             *
+             * Incremental insertion depends on the insertion order; a rebuild after large
+             * changes gives cheaper queries.
+             */
+            void rebuild();
+
+            /**
+             * @brief Retrieves the value given when the proxy was created.
+             * @param proxyId Id returned by createProxy().
+             * @return The user data.
+             */
+            std::uint32_t getUserData(std::int32_t proxyId) const
+            {
+                return _nodes[proxyId].userData;
+            }
+
+            /**
+             * @brief Retrieves the fat box of a proxy.
+             * @param proxyId Id returned by createProxy().
+             * @return The box stored in the tree.
+             */
+            const Aabb &getFatAabb(std::int32_t proxyId) const
+            {
+                return _nodes[proxyId].box;
+            }
+
+            /**
+             * @brief Retrieves the number of objects.
+             * @return The proxy count.
+             */
+            std::size_t getProxyCount() const
+            {
+                return _proxyCount;
+            }
+
+            /**
+             * @brief Retrieves the height of the tree.
+             * @return 0 for an empty tree or a single leaf.
+             */
+            std::int32_t getHeight() const
+            {
+                return (_root == NULL_NODE) ? 0 : _nodes[_root].height;
+            }
+
+            /**
+             * @brief Retrieves the summed surface area of the inner nodes over that of the root.
+             * @return The surface area heuristic cost of the tree; lower is better.
+             */
+            double getAreaRatio() const;
+
+            /**
+             * @brief Calls visit(proxyId) for each proxy whose fat box overlaps box.
+             * @param box The query box.
+             * @param visit Callable taking the proxy id.
+             */
+            template <typename Visitor>
+            void forEachOverlap(const Aabb &box, Visitor &&visit) const;
+
+            /**
+             * @brief Calls visit(proxyId) for each proxy whose fat box contains point.
+             * @param point The query point.
+             * @param visit Callable taking the proxy id.
+             */
+            template <typename Visitor>
+            void forEachContaining(const std::array<double, 3> &point, Visitor &&visit) const;
+
+            /**
+             * @brief Calls visit(proxyId, entry) for each proxy whose fat box the ray meets.
+             * @param origin Start of the ray.
+             * @param direction Direction of the ray.
+             * @param maxDistance Length of the ray, in units of direction.
+             * @param visit Callable taking the proxy id and where the ray enters its fat box.
+             */
+            template <typename Visitor>
+            void forEachRayHit(const std::array<double, 3> &origin,
+                               const std::array<double, 3> &direction, double maxDistance,
+                               Visitor &&visit) const;
+
+          private:
+            /**
+             * @brief Leaf, inner or free node.
+             */
+            struct Node
+            {
+                Aabb box;               /**< Fat box for leaves, union of the children otherwise. */
+                std::int32_t parent;    /**< Parent node, or next free node. */
+                std::int32_t left;      /**< First child, NULL_NODE for leaves. */
+                std::int32_t right;     /**< Second child, NULL_NODE for leaves. */
+                std::int32_t height;    /**< 0 for leaves, -1 for free nodes. */
+                std::uint32_t userData; /**< Value given to createProxy(). */
+
+                bool isLeaf() const
+                {
+                    return left == NULL_NODE;
+                }
+            };
+
+            /**
+             * @brief Walks the nodes whose box passes test, calling visit on the leaves.
+             */
+            template <typename Test, typename Visitor>
+            void traverse(Test &&test, Visitor &&visit) const;
+
+            std::int32_t allocateNode();
+            void freeNode(std::int32_t node);
+            void insertLeaf(std::int32_t leaf);
+            void removeLeaf(std::int32_t leaf);
+            void refitFrom(std::int32_t node);
+            std::int32_t balance(std::int32_t node);
+            std::int32_t build(std::int32_t *first, std::int32_t *last);
+
+            std::vector<Node> _nodes; /**< Node pool, indexed by node id. */
+            std::int32_t _root;       /**< Root node, or NULL_NODE. */
+            std::int32_t _freeList;   /**< First free node, or NULL_NODE. */
+            std::size_t _proxyCount;  /**< Number of leaves. */
+            double _margin;           /**< Margin added around tight boxes. */
+        };
+
+        template <typename Test, typename Visitor>
+        void DynamicAabbTree::traverse(Test &&test, Visitor &&visit) const
+        {
+            if (_root == NULL_NODE)
+            {
+                return;
+            }
+
+            // Balanced trees fit the fixed stack; deeper ones spill onto the heap
+            std::array<std::int32_t, 64> stack;
+            std::vector<std::int32_t> spill;
+            std::size_t top = 0;
+            stack[top++]    = _root;
+            while (top > 0 || !spill.empty())
+            {
+                std::int32_t index;
+                if (spill.empty())
+                {
+                    index = stack[--top];
+                }
+                else
+                {
+                    index = spill.back();
+                    spill.pop_back();
+                }
+                const Node &node = _nodes[index];
+                if (!test(node.box))
+                {
+                    continue;
+                }
+                if (node.isLeaf())
+                {
+                    visit(index);
+                    continue;
+                }
+                for (const std::int32_t child : {node.left, node.right})
+                {
+                    if (top < stack.size())
+                    {
+                        stack[top++] = child;
+                    }
+                    else
+                    {
+                        spill.push_back(child);
+                    }
+                }
+            }
+        }
+
+        template <typename Visitor>
+        void DynamicAabbTree::forEachOverlap(const Aabb &box, Visitor &&visit) const
+        {
+            traverse([&box](const Aabb &node) { return node.overlaps(box); }, visit);
+        }
+
+        template <typename Visitor>
+        void DynamicAabbTree::forEachContaining(const std::array<double, 3> &point,
+                                                Visitor &&visit) const
+        {
+            traverse([&point](const Aabb &node) { return node.contains(point); }, visit);
+        }
+
+        template <typename Visitor>
+        void DynamicAabbTree::forEachRayHit(const std::array<double, 3> &origin,
+                                            const std::array<double, 3> &direction,
+                                            double maxDistance, Visitor &&visit) const
+        {
+            const std::array<double, 3> inverseDirection = {1.0 / direction[0], 1.0 / direction[1],
+                                                            1.0 / direction[2]};
+            double entry = 0.0;
+            traverse(
+                [&](const Aabb &node) {
+                    return node.intersectsRay(origin, inverseDirection, maxDistance, entry);
+                },
+                [&](std::int32_t proxyId) { visit(proxyId, entry); });
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_DYNAMIC_AABB_TREE_H
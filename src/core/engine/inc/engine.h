@@ -26,9 +26,21 @@
 #ifndef INERTIAFX_CORE_ENGINE_ENGINE_H
 #define INERTIAFX_CORE_ENGINE_ENGINE_H
 
+#include "iforce_generator.h"
 #include "ilogger.h"
+#include "integrator.h"
 #include "iworld.h"
+#include "run_handle.h"
 #include "si_time.h"
+#include "thread_pool.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 using namespace InertiaFX::Core::SI;
 using namespace InertiaFX::Core::Tools;
@@ -73,6 +85,9 @@ namespace Core
             /**
              * @brief Sets the logger to the engine.
              *
+             * The engine updates the logger's simulation stamp after each step; enable
+             * LogStamp::Simulation on the logger to print the time and step on each line.
+             *
              * @param world A unique pointer to an ILogger object to add simulation logs.
              */
             void setLogger(std::unique_ptr<ILogger> logger);
@@ -104,23 +119,170 @@ namespace Core
              */
             void run(unsigned int runTime, unsigned int timeStep = 1);
 
+            /**
+             * @brief Runs the simulation indefinitely on a dedicated thread.
+             * @return The handle controlling the run.
+             * @throws std::logic_error If an asynchronous run is already in progress.
+             */
+            RunHandle runAsync();
+
+            /**
+             * @brief Runs for a fixed duration given as Time on a dedicated thread.
+             * @param runTime The duration to run the simulation.
+             * @param timeStep The time step for the simulation.
+             * @return The handle controlling the run.
+             * @throws std::logic_error If an asynchronous run is already in progress.
+             */
+            RunHandle runAsync(Time runTime, Time timeStep = Time(1.0, DecimalPrefix::Name::base));
+
+            /**
+             * @brief Runs for a fixed duration (seconds) on a dedicated thread.
+             * @param runTime The duration to run the simulation in seconds.
+             * @param timeStep The time step for the simulation in seconds.
+             * @return The handle controlling the run.
+             * @throws std::logic_error If an asynchronous run is already in progress.
+             */
+            RunHandle runAsync(unsigned int runTime, unsigned int timeStep = 1);
+
             /**
              * @brief Request the simulation to stop at the next step.
-             * This is a non-blocking call.
+             * This is a non-blocking call, safe to make from any thread.
              */
             void stop();
 
-          private:
+            /**
+             * @brief Suspends the simulation loop before its next step.
+             * This is a non-blocking call, safe to make from any thread.
+             */
+            void pause();
+
+            /**
+             * @brief Resumes a paused simulation loop.
+             * This is a non-blocking call, safe to make from any thread.
+             */
+            void resume();
+
+            /**
+             * @brief Checks whether the simulation loop is paused.
+             * @return True if pause() was requested and not resumed.
+             */
+            bool isPaused() const;
+
+            /**
+             * @brief Checks whether an asynchronous run is in progress.
+             * @return True from runAsync() until its simulation loop returns.
+             */
+            bool isRunning() const;
+
+            /**
+             * @brief Retrieves the number of time steps executed so far. Lock-free.
+             * @return The step count.
+             */
+            std::uint64_t getStepCount() const;
+
+            /**
+             * @brief Callback invoked after every time step.
+             * @details Receives the world and the simulation time reached, in seconds.
+             */
+            using PostStepHook = std::function<void(IWorld &, double)>;
+
+            /**
+             * @brief Sets the integration scheme used by every subsequent time step.
+             * @param type The integration scheme.
+             */
+            void setIntegrator(IntegratorType type);
+
+            /**
+             * @brief Retrieves the integration scheme.
+             * @return The integration scheme.
+             */
+            IntegratorType getIntegrator() const;
+
+            /**
+             * @brief Sets the number of threads running the per-entity phases of a step.
+             * @param workerCount Number of threads, including the one calling run() or
+             * timeStep(); 0 is treated as 1, which runs every phase serially.
+             *
+             * Results are bit-identical between runs with the same worker count.
+             * @note Must not be called while a step is executing.
+             */
+            void setWorkerCount(std::size_t workerCount);
+
+            /**
+             * @brief Retrieves the number of threads running the per-entity phases of a step.
+             * @return The worker count. It defaults to the hardware concurrency.
+             */
+            std::size_t getWorkerCount() const;
+
+            /**
+             * @brief Registers a force generator, applied on every force evaluation.
+             * @param generator A unique pointer to the generator. It is owned by the engine.
+             */
+            void addForceGenerator(std::unique_ptr<IForceGenerator> generator);
+
+            /**
+             * @brief Registers a hook invoked after every time step.
+             * @param hook The callback.
+             */
+            void addPostStepHook(PostStepHook hook);
+
+            /**
+             * @brief Retrieves the simulation time reached so far. Lock-free.
+             * @return The simulation time in seconds.
+             */
+            double getSimulationTime() const;
+
             /**
              * @brief Executes a single time step of the simulation.
-             * @param timeStep The time step for the simulation.
-             * @note This function is called internally by the run() method.
+             * @param timeStep The time step for the simulation, in seconds.
+             *
+             * The step runs the pipeline: clear forces, apply the world gravity, apply the force
+             * generators, integrate and run the post-step hooks.
+             * @note This function is called internally by the run() methods.
              */
             void timeStep(double timeStep);
 
+          private:
+            friend class RunHandle;
+
+            /**
+             * @brief Blocks while the loop is paused.
+             * @return True if the loop must execute another step, false once stopped.
+             */
+            bool continueRunning();
+
+            /**
+             * @brief Launches a simulation loop on a dedicated thread.
+             * @param loop The loop to run.
+             * @return The handle controlling the run.
+             */
+            RunHandle launch(std::function<void()> loop);
+
+            /**
+             * @brief Recomputes the net force of every entity for the current world state.
+             * @param time The simulation time of the state, in seconds.
+             */
+            void evaluateForces(double time);
+
             std::unique_ptr<ILogger> _logger; /**< Optional logger */
             std::unique_ptr<IWorld> _world;   /**< Physics world */
-            bool _stop;                       /**< Stop flag */
+            Integrator _integrator;           /**< Integration scheme and scratch storage */
+
+            std::atomic<bool> _stop;               /**< Stop flag */
+            std::atomic<bool> _paused;             /**< Pause flag */
+            std::atomic<bool> _running;            /**< Set while an asynchronous run is active */
+            std::atomic<double> _simulationTime;   /**< Simulation time reached, in seconds */
+            std::atomic<std::uint64_t> _stepCount; /**< Time steps executed */
+            std::mutex _pauseMutex;                /**< Guards waiting on _pauseChanged */
+            std::condition_variable _pauseChanged; /**< Wakes the loop on resume or stop */
+            std::exception_ptr _runError;          /**< Exception ending an asynchronous run */
+            bool _forcesValid;                     /**< Net forces match the last step's state */
+            std::uint64_t _forcesRevision;         /**< Store revision of those net forces */
+
+            std::unique_ptr<ThreadPool> _threadPool; /**< Runs the per-entity phases */
+
+            std::vector<std::unique_ptr<IForceGenerator>> _forceGenerators; /**< Force sources */
+            std::vector<PostStepHook> _postStepHooks; /**< Callbacks run after each step */
         };
     }  // namespace Engine
 }  // namespace Core
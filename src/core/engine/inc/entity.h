@@ -168,6 +168,26 @@ namespace Core
             {
             }
 
+            /**
+             * @brief Copy constructor.
+             */
+            Entity(const Entity &) = default;
+
+            /**
+             * @brief Move constructor; lets containers of entities relocate instead of copying.
+             */
+            Entity(Entity &&) noexcept = default;
+
+            /**
+             * @brief Copy assignment operator.
+             */
+            Entity &operator=(const Entity &) = default;
+
+            /**
+             * @brief Move assignment operator.
+             */
+            Entity &operator=(Entity &&) noexcept = default;
+
             /**
              * @brief Virtual destructor for polymorphic cleanup.
              */
@@ -274,7 +294,7 @@ namespace Core
              */
             void addForce(const Force &force) override
             {
-                _netForce = _netForce + force;
+                _netForce += force;
             }
 
             /**
@@ -282,7 +302,7 @@ namespace Core
              */
             void addForce(const std::array<double, 3> force) override
             {
-                _netForce = _netForce + Force(force, DecimalPrefix::Name::base);
+                _netForce += Force(force, DecimalPrefix::Name::base);
             }
 
             /**
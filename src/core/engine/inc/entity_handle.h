@@ -0,0 +1,201 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file entity_handle.h
+ * @brief Declaration of the EntityHandle class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_ENTITY_HANDLE_H
+#define INERTIAFX_CORE_ENGINE_ENTITY_HANDLE_H
+
+#include "entity_store.h"
+#include "ientity.h"
+#include <cstddef>
+#include <memory>
+
+using namespace InertiaFX::Core::SI;
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class EntityHandle
+         * @brief IEntity proxy whose dynamic state lives in an EntityStore.
+         *
+         * Position, velocity, acceleration, net force and the fixed flag are written to the store
+         * slot of the handle. The getters return references to a copy of the slot held by the
+         * handle, so they never write and may be called from several threads at once; the copy
+         * is refreshed by sync(), which the engine calls after each step, and by the setters.
+         * Writes made to the store directly show through the getters after the next sync().
+         * Mass, volume and the concrete entity type are kept by the wrapped entity. Values read
+         * through the handle are reported in base prefix.
+         */
+        class EntityHandle : public IEntity
+        {
+          public:
+            /**
+             * @brief Constructs a handle for an entity already added to a store.
+             * @param store The store holding the entity state. It must outlive the handle.
+             * @param index The index returned by EntityStore::add().
+             * @param entity The wrapped entity, providing mass, volume and the concrete type.
+             */
+            EntityHandle(EntityStore &store, std::size_t index, std::unique_ptr<IEntity> entity);
+
+            /**
+             * @brief Retrieves the index of the entity in its store.
+             * @return The store index.
+             */
+            std::size_t getIndex() const
+            {
+                return _index;
+            }
+
+            /**
+             * @brief Retrieves the wrapped entity, e.g. to reach its concrete type with
+             * dynamic_cast.
+             * @return The entity passed to the constructor. Its position, velocity, acceleration
+             * and force are those it had when added; the current ones are read through the handle.
+             */
+            const IEntity &getEntity() const
+            {
+                return *_entity;
+            }
+
+            /**
+             * @brief Refreshes the values returned by the getters from the store slot.
+             */
+            void sync();
+
+            /**
+             * @copydoc IEntity::clone
+             * @details The clone is a detached entity of the wrapped type, holding the current
+             * state of the store slot.
+             */
+            std::unique_ptr<IEntity> clone() const override;
+
+            /**
+             * @copydoc IEntity::getPosition
+             */
+            const Position &getPosition() const override;
+
+            /**
+             * @copydoc IEntity::setPosition(const Position &position)
+             */
+            void setPosition(const Position &position) override;
+
+            /**
+             * @copydoc IEntity::setPosition(const std::array<double, 3> position)
+             */
+            void setPosition(const std::array<double, 3> position) override;
+
+            /**
+             * @copydoc IEntity::getVelocity
+             */
+            const Velocity &getVelocity() const override;
+
+            /**
+             * @copydoc IEntity::setVelocity(const Velocity &velocity)
+             */
+            void setVelocity(const Velocity &velocity) override;
+
+            /**
+             * @copydoc IEntity::setVelocity(const std::array<double, 3> velocity)
+             */
+            void setVelocity(const std::array<double, 3> velocity) override;
+
+            /**
+             * @copydoc IEntity::getAcceleration
+             */
+            const Acceleration &getAcceleration() const override;
+
+            /**
+             * @copydoc IEntity::setAcceleration(const Acceleration &acceleration)
+             */
+            void setAcceleration(const Acceleration &acceleration) override;
+
+            /**
+             * @copydoc IEntity::setAcceleration(const std::array<double, 3> acceleration)
+             */
+            void setAcceleration(const std::array<double, 3> acceleration) override;
+
+            /**
+             * @copydoc IEntity::getForce
+             */
+            const Force &getForce() const override;
+
+            /**
+             * @copydoc IEntity::setForce(const Force &force)
+             */
+            void setForce(const Force &force) override;
+
+            /**
+             * @copydoc IEntity::setForce(const std::array<double, 3> force)
+             */
+            void setForce(const std::array<double, 3> force) override;
+
+            /**
+             * @copydoc IEntity::addForce(const Force &force)
+             */
+            void addForce(const Force &force) override;
+
+            /**
+             * @copydoc IEntity::addForce(const std::array<double, 3> force)
+             */
+            void addForce(const std::array<double, 3> force) override;
+
+            /**
+             * @copydoc IEntity::getMass
+             */
+            const Mass &getMass() const override;
+
+            /**
+             * @copydoc IEntity::getVolume
+             */
+            const Volume &getVolume() const override;
+
+            /**
+             * @copydoc IEntity::isFixed
+             */
+            bool isFixed() const override;
+
+            /**
+             * @copydoc IEntity::fixEntity
+             */
+            void fixEntity() override;
+
+          private:
+            EntityStore *_store;              /**< Store holding the dynamic state. */
+            std::size_t _index;               /**< Slot of the entity in the store. */
+            std::unique_ptr<IEntity> _entity; /**< Wrapped entity (mass, volume, type). */
+            Position _position;               /**< Position at the last sync. */
+            Velocity _velocity;               /**< Velocity at the last sync. */
+            Acceleration _acceleration;       /**< Acceleration at the last sync. */
+            Force _force;                     /**< Net force at the last sync. */
+        };
+
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_ENTITY_HANDLE_H
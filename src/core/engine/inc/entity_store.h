@@ -0,0 +1,329 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file entity_store.h
+ * @brief Declaration of the EntityStore class.
+ *
+ * @details The EntityStore keeps the per-step state of every entity of a world in a
+ * structure-of-arrays layout: one contiguous, cache line aligned array per component, in base SI
+ * units. A pass over one component (e.g., all x positions) streams through memory instead of
+ * chasing a pointer per entity.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_ENTITY_STORE_H
+#define INERTIAFX_CORE_ENGINE_ENTITY_STORE_H
+
+#include "aligned_allocator.h"
+#include "ientity.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @struct Vector3Array
+         * @brief Three aligned component arrays holding one 3D vector per entity.
+         */
+        struct Vector3Array
+        {
+            AlignedVector<double> x; /**< First components. */
+            AlignedVector<double> y; /**< Second components. */
+            AlignedVector<double> z; /**< Third components. */
+
+            /**
+             * @brief Retrieves the array of one component.
+             * @param axis Component index (0 for x, 1 for y, 2 for z).
+             * @return The component array.
+             */
+            AlignedVector<double> &operator[](std::size_t axis)
+            {
+                return axis == 0 ? x : (axis == 1 ? y : z);
+            }
+
+            /**
+             * @copydoc Vector3Array::operator[](std::size_t)
+             */
+            const AlignedVector<double> &operator[](std::size_t axis) const
+            {
+                return axis == 0 ? x : (axis == 1 ? y : z);
+            }
+
+            /**
+             * @brief Retrieves the vector at the given index.
+             * @param index Entity index.
+             * @return The vector, in base units.
+             */
+            std::array<double, 3> get(std::size_t index) const
+            {
+                return {x[index], y[index], z[index]};
+            }
+
+            /**
+             * @brief Overwrites the vector at the given index.
+             * @param index Entity index.
+             * @param value The new vector, in base units.
+             */
+            void set(std::size_t index, const std::array<double, 3> &value)
+            {
+                x[index] = value[0];
+                y[index] = value[1];
+                z[index] = value[2];
+            }
+
+            /**
+             * @brief Adds to the vector at the given index.
+             * @param index Entity index.
+             * @param value The vector to add, in base units.
+             */
+            void add(std::size_t index, const std::array<double, 3> &value)
+            {
+                x[index] += value[0];
+                y[index] += value[1];
+                z[index] += value[2];
+            }
+
+            /**
+             * @brief Appends a vector.
+             * @param value The vector to append, in base units.
+             */
+            void push_back(const std::array<double, 3> &value)
+            {
+                x.push_back(value[0]);
+                y.push_back(value[1]);
+                z.push_back(value[2]);
+            }
+
+            /**
+             * @brief Resizes the arrays, zero-filling new entries.
+             * @param count Number of vectors.
+             */
+            void resize(std::size_t count)
+            {
+                x.resize(count, 0.0);
+                y.resize(count, 0.0);
+                z.resize(count, 0.0);
+            }
+
+            /**
+             * @brief Reserves storage for the given number of vectors.
+             * @param capacity Number of vectors.
+             */
+            void reserve(std::size_t capacity)
+            {
+                x.reserve(capacity);
+                y.reserve(capacity);
+                z.reserve(capacity);
+            }
+        };
+
+        /**
+         * @class EntityStore
+         * @brief Structure-of-arrays storage for the dynamic state of entities.
+         *
+         * Entities are addressed by the index returned from add(). Indices are stable for the
+         * lifetime of the store.
+         *
+         * A revision counter tells the engine whether the state changed outside its steps. add()
+         * and the EntityHandle setters advance it; code writing the arrays directly between steps
+         * calls markModified().
+         */
+        class EntityStore
+        {
+          public:
+            /**
+             * @brief Constructs an empty store.
+             */
+            EntityStore();
+
+            /**
+             * @brief Copies the state of an entity into the store.
+             * @param entity The entity to copy position, velocity, acceleration, force, mass and
+             * fixed flag from.
+             * @return The index of the new entry.
+             */
+            std::size_t add(const IEntity &entity);
+
+            /**
+             * @brief Reserves storage for the given number of entities.
+             * @param capacity Number of entities.
+             */
+            void reserve(std::size_t capacity);
+
+            /**
+             * @brief Retrieves the number of stored entities.
+             * @return The number of entities.
+             */
+            std::size_t size() const
+            {
+                return _inverseMasses.size();
+            }
+
+            /**
+             * @brief Records a change of the state made outside the engine's steps.
+             */
+            void markModified()
+            {
+                ++_revision;
+            }
+
+            /**
+             * @brief Retrieves the revision counter.
+             * @return The number of additions and recorded changes so far.
+             */
+            std::uint64_t getRevision() const
+            {
+                return _revision;
+            }
+
+            /**
+             * @brief Retrieves the positions, in metres.
+             */
+            Vector3Array &positions()
+            {
+                return _positions;
+            }
+
+            /**
+             * @copydoc EntityStore::positions()
+             */
+            const Vector3Array &positions() const
+            {
+                return _positions;
+            }
+
+            /**
+             * @brief Retrieves the velocities, in metres per second.
+             */
+            Vector3Array &velocities()
+            {
+                return _velocities;
+            }
+
+            /**
+             * @copydoc EntityStore::velocities()
+             */
+            const Vector3Array &velocities() const
+            {
+                return _velocities;
+            }
+
+            /**
+             * @brief Retrieves the accelerations, in metres per second squared.
+             */
+            Vector3Array &accelerations()
+            {
+                return _accelerations;
+            }
+
+            /**
+             * @copydoc EntityStore::accelerations()
+             */
+            const Vector3Array &accelerations() const
+            {
+                return _accelerations;
+            }
+
+            /**
+             * @brief Retrieves the net forces, in newtons.
+             */
+            Vector3Array &forces()
+            {
+                return _forces;
+            }
+
+            /**
+             * @copydoc EntityStore::forces()
+             */
+            const Vector3Array &forces() const
+            {
+                return _forces;
+            }
+
+            /**
+             * @brief Retrieves the inverse masses, in inverse kilograms.
+             * @details Massless entities store 0, i.e. forces do not accelerate them.
+             */
+            AlignedVector<double> &inverseMasses()
+            {
+                return _inverseMasses;
+            }
+
+            /**
+             * @copydoc EntityStore::inverseMasses()
+             */
+            const AlignedVector<double> &inverseMasses() const
+            {
+                return _inverseMasses;
+            }
+
+            /**
+             * @brief Retrieves the bounding radii, in metres, from the entity volumes.
+             */
+            AlignedVector<double> &radii()
+            {
+                return _radii;
+            }
+
+            /**
+             * @copydoc EntityStore::radii()
+             */
+            const AlignedVector<double> &radii() const
+            {
+                return _radii;
+            }
+
+            /**
+             * @brief Retrieves the fixed flags (1 if the entity is immovable, 0 otherwise).
+             */
+            AlignedVector<std::uint8_t> &fixed()
+            {
+                return _fixed;
+            }
+
+            /**
+             * @copydoc EntityStore::fixed()
+             */
+            const AlignedVector<std::uint8_t> &fixed() const
+            {
+                return _fixed;
+            }
+
+          private:
+            Vector3Array _positions;              /**< Positions, in metres. */
+            Vector3Array _velocities;             /**< Velocities, in metres per second. */
+            Vector3Array _accelerations;          /**< Accelerations, in metres per second^2. */
+            Vector3Array _forces;                 /**< Net forces, in newtons. */
+            AlignedVector<double> _inverseMasses; /**< Inverse masses, in 1/kg. */
+            AlignedVector<double> _radii;         /**< Bounding radii, in metres. */
+            AlignedVector<std::uint8_t> _fixed;   /**< Fixed flags. */
+            std::uint64_t _revision;              /**< Additions and recorded changes. */
+        };
+
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_ENTITY_STORE_H
@@ -0,0 +1,251 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file fmm_gravity.h
+ * @brief Declaration of the FmmGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_FMM_GRAVITY_H
+#define INERTIAFX_CORE_ENGINE_FMM_GRAVITY_H
+
+#include "gravity_octree.h"
+#include "mutual_gravity.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class FmmGravity
+         * @brief Mutual gravitation with the Fast Multipole Method, in O(N).
+         *
+         * Each cell of an adaptive GravityOctree carries a Cartesian multipole expansion of its
+         * potential about its centre of mass, up to the expansion order p. Two cells A and B are
+         * well separated when r_A + r_B < theta |z_A - z_B|, r being the radius of a cell around
+         * its centre z. Going down the tree, each cell converts the multipoles of the cells it
+         * is well separated from into a local expansion (M2L) and inherits the local expansion
+         * of its parent; leaves evaluate their local expansion at their bodies and sum the
+         * bodies of the leaves that are not separated from them directly. The number of
+         * interactions per cell is bounded, so the cost grows linearly with the entity count.
+         *
+         * The error falls roughly as theta^(p+1) and an M2L costs O(p^6): raising the order
+         * buys accuracy at a fixed theta. Softening only applies to the direct sums, which is
+         * exact as long as the softening length is small against the cell separations.
+         *
+         * The upward pass and the downward pass, which holds the M2L and direct sums, run level
+         * by level in parallel on the engine's pool, one cell per task element. Results do not
+         * depend on the worker count.
+         */
+        class FmmGravity : public MutualGravity
+        {
+          public:
+            /**
+             * @brief Default expansion order.
+             */
+            static constexpr std::size_t DEFAULT_ORDER = 4;
+
+            /**
+             * @brief Highest supported expansion order.
+             */
+            static constexpr std::size_t MAX_ORDER = 12;
+
+            /**
+             * @brief Default separation parameter.
+             */
+            static constexpr double DEFAULT_THETA = 0.5;
+
+            /**
+             * @brief Default maximum number of entities in a leaf cell.
+             */
+            static constexpr std::size_t DEFAULT_LEAF_CAPACITY = 32;
+
+            /**
+             * @brief Minimum number of cells per parallel chunk of the tree passes.
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 8;
+
+            /**
+             * @brief Constructs a generator with the SI constant and no softening.
+             * @param order Expansion order, clamped to [1, MAX_ORDER].
+             * @param theta Separation parameter, between 0 and 1.
+             */
+            explicit FmmGravity(std::size_t order = DEFAULT_ORDER, double theta = DEFAULT_THETA);
+
+            /**
+             * @copydoc IForceGenerator::apply(IWorld &, double)
+             */
+            void apply(IWorld &world, double time) override;
+
+            /**
+             * @brief Sets the expansion order.
+             * @param order The order, clamped to [1, MAX_ORDER]; 1 keeps the monopoles only.
+             */
+            void setOrder(std::size_t order);
+
+            /**
+             * @brief Retrieves the expansion order.
+             * @return The order.
+             */
+            std::size_t getOrder() const
+            {
+                return _order;
+            }
+
+            /**
+             * @brief Sets the separation parameter.
+             * @param theta The parameter; smaller values separate fewer cells and are more
+             * accurate, 0 sums every pair directly.
+             */
+            void setTheta(double theta)
+            {
+                _theta = theta;
+            }
+
+            /**
+             * @brief Retrieves the separation parameter.
+             * @return The parameter.
+             */
+            double getTheta() const
+            {
+                return _theta;
+            }
+
+            /**
+             * @brief Sets the number of entities up to which a cell is not split.
+             * @param leafCapacity The capacity; 0 is treated as 1.
+             */
+            void setLeafCapacity(std::size_t leafCapacity)
+            {
+                _leafCapacity = leafCapacity;
+            }
+
+            /**
+             * @brief Retrieves the number of entities up to which a cell is not split.
+             * @return The capacity.
+             */
+            std::size_t getLeafCapacity() const
+            {
+                return _leafCapacity;
+            }
+
+            /**
+             * @brief Retrieves the number of cells of the last tree.
+             * @return The cell count.
+             */
+            std::size_t getNodeCount() const
+            {
+                return _tree.getNodes().size();
+            }
+
+            /**
+             * @brief Retrieves the number of M2L conversions of the last evaluation.
+             * @return The conversion count.
+             */
+            std::size_t getM2LCount() const
+            {
+                return _m2lCount;
+            }
+
+          private:
+            /**
+             * @brief Term of M2M and L2L: out[to] += coefficient shift^monomial in[from].
+             */
+            struct ShiftTerm
+            {
+                std::uint32_t to;       /**< Multi-index of the larger order. */
+                std::uint32_t from;     /**< Multi-index of the smaller order. */
+                std::uint32_t monomial; /**< Difference of the two. */
+                double coefficient;     /**< Binomial coefficient. */
+            };
+
+            /**
+             * @brief Term of M2L: local[local] += coefficient T[sum] multipole[multipole].
+             */
+            struct ConversionTerm
+            {
+                std::uint32_t local;     /**< Multi-index of the local expansion. */
+                std::uint32_t multipole; /**< Multi-index of the multipole expansion. */
+                std::uint32_t sum;       /**< Sum of the two. */
+                double coefficient;      /**< Signed binomial coefficient. */
+            };
+
+            /**
+             * @brief Term of L2P: field[axis] += coefficient local[local] y^monomial.
+             */
+            struct GradientTerm
+            {
+                std::uint32_t local;    /**< Multi-index of the local expansion. */
+                std::uint32_t monomial; /**< That multi-index minus the axis. */
+                std::uint32_t axis;     /**< Axis of the derivative. */
+                double coefficient;     /**< Exponent along the axis. */
+            };
+
+            /**
+             * @brief Working buffers of one parallel chunk.
+             */
+            struct Scratch
+            {
+                std::vector<std::uint32_t> stack;     /**< Cells still to classify. */
+                std::vector<std::uint32_t> separated; /**< Cells converted by M2L. */
+                std::vector<std::uint32_t> direct;    /**< Leaves summed directly. */
+                std::vector<double> monomials;        /**< Powers of a displacement. */
+                std::vector<double> derivatives;      /**< Taylor coefficients of 1/r. */
+            };
+
+            void buildTables();
+            std::size_t getTermIndex(std::size_t x, std::size_t y, std::size_t z) const;
+            void computeMonomials(const std::array<double, 3> &d, double *monomials) const;
+            void computeDerivatives(const std::array<double, 3> &r, double *derivatives) const;
+            void upward(std::uint32_t node, Scratch &scratch);
+            std::size_t downward(std::uint32_t node, EntityStore &store, Scratch &scratch);
+            bool isSeparated(std::uint32_t a, std::uint32_t b) const;
+            void evaluate(std::uint32_t leaf, EntityStore &store, Scratch &scratch) const;
+
+            std::size_t _order;        /**< Expansion order p. */
+            double _theta;             /**< Separation parameter. */
+            std::size_t _leafCapacity; /**< Bodies up to which a cell is not split. */
+            std::size_t _m2lCount;     /**< M2L conversions of the last evaluation. */
+
+            std::vector<std::array<std::uint32_t, 3>> _terms; /**< Multi-indices, by order. */
+            std::vector<std::uint32_t> _termIndex; /**< Position of each multi-index in _terms. */
+            std::vector<std::array<std::int32_t, 6>> _recurrence; /**< Terms minus e_i, 2 e_i. */
+            std::vector<ShiftTerm> _shiftTerms;       /**< M2M and L2L terms. */
+            std::vector<ConversionTerm> _conversions; /**< M2L terms. */
+            std::vector<GradientTerm> _gradientTerms; /**< L2P terms. */
+
+            GravityOctree _tree;                              /**< Octree over the bodies. */
+            std::vector<std::array<double, 3>> _centres;      /**< Expansion centre of each cell. */
+            std::vector<double> _radii;                       /**< Radius around that centre. */
+            std::vector<double> _multipoles;                  /**< Multipoles, per cell. */
+            std::vector<double> _locals;                      /**< Local expansions, per cell. */
+            std::vector<std::vector<std::uint32_t>> _nearLists; /**< Unresolved cells, per cell. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_FMM_GRAVITY_H
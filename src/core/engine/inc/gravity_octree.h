@@ -0,0 +1,238 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gravity_octree.h
+ * @brief Declaration of the GravityOctree class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_GRAVITY_OCTREE_H
+#define INERTIAFX_CORE_ENGINE_GRAVITY_OCTREE_H
+
+#include "entity_store.h"
+#include "thread_pool.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class GravityOctree
+         * @brief Adaptive octree over the massive entities of a store, shared by the tree codes.
+         *
+         * A build sorts the entities of non-zero mass along a Morton curve, so that the bodies
+         * of every cell are contiguous, and splits the cells holding more than the leaf capacity.
+         * Bodies are numbered in curve order; their positions and masses are gathered in that
+         * order for cache friendly traversals. Every step of the build runs on the pool when one
+         * is given, and the resulting tree does not depend on the worker count.
+         *
+         * Children follow their parent in the node array, and the nodes are also listed level by
+         * level so that upward and downward passes can run each level in parallel.
+         */
+        class GravityOctree
+        {
+          public:
+            /**
+             * @brief Deepest level: the Morton codes hold 21 bits per axis.
+             */
+            static constexpr std::uint32_t MAX_DEPTH = 21;
+
+            /**
+             * @brief Parent of the root.
+             */
+            static constexpr std::uint32_t NO_PARENT = UINT32_MAX;
+
+            /**
+             * @brief Octree cell.
+             */
+            struct Node
+            {
+                std::array<double, 3> centre; /**< Geometric centre, in metres. */
+                double halfSize;              /**< Half the cell edge, in metres. */
+                std::uint32_t first;          /**< First body, in curve order. */
+                std::uint32_t count;          /**< Number of bodies. */
+                std::int32_t firstChild;      /**< First child, -1 for leaves. */
+                std::uint32_t childCount;     /**< Children, stored contiguously. */
+                std::uint32_t parent;         /**< Parent cell, NO_PARENT for the root. */
+                std::uint32_t level;          /**< Depth, 0 for the root. */
+
+                /**
+                 * @brief Checks whether the cell has no children.
+                 * @return True for leaves.
+                 */
+                bool isLeaf() const
+                {
+                    return firstChild < 0;
+                }
+            };
+
+            /**
+             * @brief Constructs an empty tree.
+             */
+            GravityOctree();
+
+            /**
+             * @brief Rebuilds the tree over the current positions and masses of a store.
+             * @param store The store; entities of zero inverse mass or at non-finite positions
+             * are left out.
+             * @param leafCapacity Number of bodies up to which a cell is not split; 0 acts as 1.
+             * @param threadPool The pool running the build, or nullptr to build serially.
+             */
+            void build(const EntityStore &store, std::size_t leafCapacity, ThreadPool *threadPool);
+
+            /**
+             * @brief Retrieves the cells; the root is the first unless the tree is empty.
+             * @return The cells.
+             */
+            const std::vector<Node> &getNodes() const
+            {
+                return _nodes;
+            }
+
+            /**
+             * @brief Retrieves the number of levels.
+             * @return The level count, 0 for an empty tree.
+             */
+            std::size_t getLevelCount() const
+            {
+                return _levelStarts.empty() ? 0 : _levelStarts.size() - 1;
+            }
+
+            /**
+             * @brief Retrieves the cells of one level.
+             * @param level The level, below getLevelCount().
+             * @return The cell indices.
+             */
+            std::span<const std::uint32_t> getLevel(std::size_t level) const
+            {
+                return {_levelOrder.data() + _levelStarts[level],
+                        _levelStarts[level + 1] - _levelStarts[level]};
+            }
+
+            /**
+             * @brief Retrieves the number of bodies in the tree.
+             * @return The body count.
+             */
+            std::size_t getBodyCount() const
+            {
+                return _keys.size();
+            }
+
+            /**
+             * @brief Retrieves the store index of a body.
+             * @param body The body, in curve order.
+             * @return The entity index.
+             */
+            std::uint32_t getEntityIndex(std::size_t body) const
+            {
+                return _keys[body].index;
+            }
+
+            /**
+             * @brief Retrieves the x coordinate of each body, in curve order.
+             * @return The coordinates, in metres.
+             */
+            const std::vector<double> &getX() const
+            {
+                return _x;
+            }
+
+            /**
+             * @brief Retrieves the y coordinate of each body, in curve order.
+             * @return The coordinates, in metres.
+             */
+            const std::vector<double> &getY() const
+            {
+                return _y;
+            }
+
+            /**
+             * @brief Retrieves the z coordinate of each body, in curve order.
+             * @return The coordinates, in metres.
+             */
+            const std::vector<double> &getZ() const
+            {
+                return _z;
+            }
+
+            /**
+             * @brief Retrieves the mass of each body, in curve order.
+             * @return The masses, in kilograms.
+             */
+            const std::vector<double> &getMasses() const
+            {
+                return _masses;
+            }
+
+          private:
+            /**
+             * @brief Subtree left for a parallel task by the serial top-level build.
+             */
+            struct Subtree
+            {
+                std::uint32_t node;  /**< Cell at the root of the subtree. */
+                std::uint32_t level; /**< Depth of that cell. */
+            };
+
+            /**
+             * @brief Morton code and index of a body.
+             */
+            struct Key
+            {
+                std::uint64_t code;  /**< Interleaved cell coordinates. */
+                std::uint32_t index; /**< Entity index. */
+
+                bool operator<(const Key &other) const
+                {
+                    return code < other.code || (code == other.code && index < other.index);
+                }
+            };
+
+            void sortBodies(const EntityStore &store, ThreadPool *threadPool);
+            void buildNodes(ThreadPool *threadPool);
+            void buildNode(std::vector<Node> &nodes, std::uint32_t node, std::uint32_t splitLimit,
+                           std::vector<Subtree> *subtrees) const;
+            void listLevels();
+
+            std::size_t _leafCapacity; /**< Bodies up to which a cell is not split. */
+
+            std::array<double, 3> _origin;          /**< Lowest corner of the root cell. */
+            double _rootSize;                       /**< Edge of the root cell. */
+            std::vector<Key> _keys;                 /**< Bodies sorted along the Morton curve. */
+            std::vector<double> _x;                 /**< x of each body, in curve order. */
+            std::vector<double> _y;                 /**< y of each body, in curve order. */
+            std::vector<double> _z;                 /**< z of each body, in curve order. */
+            std::vector<double> _masses;            /**< Mass of each body, in curve order. */
+            std::vector<Node> _nodes;               /**< Cells; the root is the first. */
+            std::vector<std::uint32_t> _levelOrder; /**< Cells sorted by level. */
+            std::vector<std::size_t> _levelStarts;  /**< Offset of each level in _levelOrder. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_GRAVITY_OCTREE_H
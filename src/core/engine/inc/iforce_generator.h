@@ -0,0 +1,74 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file iforce_generator.h
+ * @brief Declaration of the IForceGenerator interface.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_IFORCE_GENERATOR_H
+#define INERTIAFX_CORE_ENGINE_IFORCE_GENERATOR_H
+
+#include "iworld.h"
+#include "thread_pool.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class IForceGenerator
+         * @brief Interface for sources of force registered with the Engine (e.g., springs, drag,
+         * mutual gravitation).
+         *
+         * A generator is invoked once per force evaluation for the whole world, never per entity,
+         * and accumulates into the net forces of the world's EntityStore.
+         */
+        class IForceGenerator
+        {
+          public:
+            /**
+             * @brief Virtual destructor for interface cleanup.
+             */
+            virtual ~IForceGenerator() = default;
+
+            /**
+             * @brief Adds the generated forces to the net forces of the world's entities.
+             * @param world The world whose EntityStore holds the current state.
+             * @param time The simulation time of the state, in seconds.
+             */
+            virtual void apply(IWorld &world, double time) = 0;
+
+            /**
+             * @brief Hands the generator the engine's pool, for generators that parallelise.
+             * @param threadPool The pool, or nullptr to run serially. The engine calls it again
+             * before the pool is replaced.
+             */
+            virtual void setThreadPool([[maybe_unused]] ThreadPool *threadPool)
+            {
+            }
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_IFORCE_GENERATOR_H
@@ -0,0 +1,153 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file integrator.h
+ * @brief Declaration of the Integrator class.
+ *
+ * @details The integrator advances the positions and velocities held by an EntityStore. Each
+ * scheme is a set of tight loops over the component arrays, so the choice of scheme costs one
+ * switch per step rather than a virtual call per entity.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_INTEGRATOR_H
+#define INERTIAFX_CORE_ENGINE_INTEGRATOR_H
+
+#include "entity_store.h"
+#include "thread_pool.h"
+#include <cstddef>
+#include <functional>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @enum IntegratorType
+         * @brief Numerical schemes available to advance the simulation state.
+         */
+        enum class IntegratorType
+        {
+            ExplicitEuler,      ///< First order; position from the old velocity.
+            SemiImplicitEuler,  ///< First order, symplectic; position from the new velocity.
+            VelocityVerlet,     ///< Second order, symplectic; one force evaluation per step.
+            RungeKutta4,        ///< Fourth order; four force evaluations per step.
+        };
+
+        /**
+         * @class Integrator
+         * @brief Advances the state of an EntityStore over one time step.
+         *
+         * Fixed entities are neither moved nor accelerated.
+         */
+        class Integrator
+        {
+          public:
+            /**
+             * @brief Callback that recomputes the net forces of the store for its current state.
+             * @details The argument is the simulation time of that state, in seconds.
+             */
+            using ForceEvaluator = std::function<void(double)>;
+
+            /**
+             * @brief Constructs a new Integrator object.
+             * @param type The integration scheme. It defaults to semi-implicit Euler.
+             */
+            explicit Integrator(IntegratorType type = IntegratorType::SemiImplicitEuler);
+
+            /**
+             * @brief Retrieves the integration scheme.
+             * @return The integration scheme.
+             */
+            IntegratorType getType() const
+            {
+                return _type;
+            }
+
+            /**
+             * @brief Sets the integration scheme.
+             * @param type The integration scheme.
+             */
+            void setType(IntegratorType type)
+            {
+                _type = type;
+            }
+
+            /**
+             * @brief Sets the pool that runs the per-entity loops in chunks.
+             * @param threadPool The pool, or nullptr to run serially. It must outlive its use.
+             */
+            void setThreadPool(ThreadPool *threadPool)
+            {
+                _threadPool = threadPool;
+            }
+
+            /**
+             * @brief Runs body over [0, count), chunked on the thread pool when one is set.
+             * @param count Number of entities.
+             * @param body Function processing the entity range [begin, end).
+             */
+            void forEachChunk(std::size_t count, const ThreadPool::RangeFunction &body);
+
+            /**
+             * @brief Advances the store by one time step.
+             * @param store The entity state. Its net forces must already be evaluated at 'time'.
+             * @param time The current simulation time, in seconds.
+             * @param timeStep The time step, in seconds.
+             * @param evaluateForces Recomputes the net forces; called for the intermediate states
+             * of multi-stage schemes.
+             */
+            void integrate(EntityStore &store, double time, double timeStep,
+                           const ForceEvaluator &evaluateForces);
+
+            /**
+             * @brief Computes accelerations from net forces and inverse masses.
+             * @param store The entity state.
+             * @details Fixed entities get a zero acceleration.
+             */
+            void computeAccelerations(EntityStore &store);
+
+            /**
+             * @brief Minimum number of entities per chunk, so small worlds stay serial.
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 4096;
+
+          private:
+            void explicitEuler(EntityStore &store, double timeStep);
+            void semiImplicitEuler(EntityStore &store, double timeStep);
+            void velocityVerlet(EntityStore &store, double time, double timeStep,
+                                const ForceEvaluator &evaluateForces);
+            void rungeKutta4(EntityStore &store, double time, double timeStep,
+                             const ForceEvaluator &evaluateForces);
+
+            IntegratorType _type;          /**< Selected integration scheme. */
+            ThreadPool *_threadPool;       /**< Pool running the chunks, or nullptr. */
+            Vector3Array _startPositions;  /**< Scratch: positions at the start of the step. */
+            Vector3Array _startVelocities; /**< Scratch: velocities at the start of the step. */
+            Vector3Array _positionSlopes;  /**< Scratch: weighted sum of position slopes. */
+            Vector3Array _velocitySlopes;  /**< Scratch: weighted sum of velocity slopes. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_INTEGRATOR_H
@@ -26,10 +26,12 @@
 #ifndef INERTIAFX_CORE_ENGINE_IWORLD_H
 #define INERTIAFX_CORE_ENGINE_IWORLD_H
 
+#include "entity_store.h"
 #include "force.h"
 #include "ientity.h"
 #include "imedium.h"
 #include "volume.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -41,6 +43,11 @@ namespace Core
 {
     namespace Engine
     {
+        class BoundingVolumeHierarchy;
+        class MediumIndex;
+        class SpatialHashGrid;
+        class ThreadPool;
+
         /**
          * @class IWorld
          * @brief Interface representing a simulation world containing all simulation objects.
@@ -94,6 +101,12 @@ namespace Core
             /**
              * @brief Adds an entity to the simulation world.
              * @param entity A unique pointer to the IEntity object to be added.
+             *
+             * Worlds may copy the dynamic state of the entity into an EntityStore and list an
+             * EntityHandle in getEntities() instead of the entity itself, as World does. The
+             * concrete entity is then reached through EntityHandle::getEntity(), and writes made
+             * through a pointer kept to the added entity do not reach the simulation; write
+             * through getEntities() instead.
              */
             virtual void addEntity(std::unique_ptr<IEntity> entity) = 0;
 
@@ -108,6 +121,68 @@ namespace Core
              * @return A constant reference to the Force object representing gravity.
              */
             virtual const Force &getGravity() const = 0;
+
+            /**
+             * @brief Retrieves the structure-of-arrays store with the dynamic state of entities.
+             * @return A reference to the EntityStore, indexed like getEntities().
+             */
+            virtual EntityStore &getEntityStore() = 0;
+
+            /**
+             * @copydoc IWorld::getEntityStore()
+             */
+            virtual const EntityStore &getEntityStore() const = 0;
+
+            /**
+             * @brief Retrieves the hash grid answering neighbour queries over entity positions.
+             * @return A reference to the SpatialHashGrid, disabled until setEnabled(true).
+             */
+            virtual SpatialHashGrid &getSpatialHashGrid() = 0;
+
+            /**
+             * @copydoc IWorld::getSpatialHashGrid()
+             */
+            virtual const SpatialHashGrid &getSpatialHashGrid() const = 0;
+
+            /**
+             * @brief Retrieves the AABB trees answering overlap, point and ray queries over
+             * entities and mediums.
+             * @return A reference to the BoundingVolumeHierarchy, disabled until
+             * setEnabled(true).
+             */
+            virtual BoundingVolumeHierarchy &getBoundingVolumeHierarchy() = 0;
+
+            /**
+             * @copydoc IWorld::getBoundingVolumeHierarchy()
+             */
+            virtual const BoundingVolumeHierarchy &getBoundingVolumeHierarchy() const = 0;
+
+            /**
+             * @brief Retrieves the index of the medium each entity is in.
+             * @return A reference to the MediumIndex, disabled until setEnabled(true).
+             */
+            virtual MediumIndex &getMediumIndex() = 0;
+
+            /**
+             * @copydoc IWorld::getMediumIndex()
+             */
+            virtual const MediumIndex &getMediumIndex() const = 0;
+
+            /**
+             * @brief Brings the enabled spatial indices up to date with the entity positions.
+             * @param threadPool Pool running the update, or nullptr to run serially.
+             *
+             * The engine calls it at the start of each time step.
+             */
+            virtual void updateSpatialIndices(ThreadPool *threadPool) = 0;
+
+            /**
+             * @brief Refreshes the values the entities report from the entity store.
+             * @param threadPool Pool running the refresh, or nullptr to run serially.
+             *
+             * The engine calls it at the end of each time step, before the post-step hooks.
+             */
+            virtual void syncEntities(ThreadPool *threadPool) = 0;
         };
     }  // namespace Engine
 }  // namespace Core
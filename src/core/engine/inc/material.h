@@ -239,7 +239,7 @@ namespace Core
             /**
              * @brief Protected move constructor to allow derived classes to move members.
              */
-            Material(Material &&) = default;
+            Material(Material &&) noexcept = default;
 
             /**
              * @brief Protected copy assignment operator.
@@ -249,7 +249,7 @@ namespace Core
             /**
              * @brief Protected move assignment operator.
              */
-            Material &operator=(Material &&) = default;
+            Material &operator=(Material &&) noexcept = default;
 
             Volume _volume;            ///< Internal storage for material volume
             Mass _mass;                ///< Internal storage for material mass
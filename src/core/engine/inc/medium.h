@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_ENGINE_MEDIUM_H
 
 #include "imedium.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -209,6 +210,32 @@ namespace Core
                     _material = other._material ?
                                     std::unique_ptr<IMaterial>(other._material->clone()) :
                                     nullptr;
+                    _volume   = other._volume;
+                    _position = other._position;
+                }
+                return *this;
+            }
+
+            /**
+             * @brief Protected move constructor; takes ownership of the other medium's material.
+             */
+            Medium(Medium &&other) noexcept :
+                _volume(std::move(other._volume)), _position(std::move(other._position)),
+                _material(std::move(other._material))
+            {
+            }
+
+            /**
+             * @brief Protected move assignment operator.
+             */
+            Medium &operator=(Medium &&other) noexcept
+            {
+                // Move assignment operator
+                if (this != &other)
+                {
+                    _material = std::move(other._material);
+                    _volume   = std::move(other._volume);
+                    _position = std::move(other._position);
                 }
                 return *this;
             }
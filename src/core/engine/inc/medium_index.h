@@ -0,0 +1,187 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file medium_index.h
+ * @brief Declaration of the MediumIndex class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_MEDIUM_INDEX_H
+#define INERTIAFX_CORE_ENGINE_MEDIUM_INDEX_H
+
+#include "bounding_volume.h"
+#include "dynamic_aabb_tree.h"
+#include "entity_store.h"
+#include "imedium.h"
+#include "thread_pool.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class MediumIndex
+         * @brief Finds the medium each entity sits in, e.g. for buoyancy and drag.
+         *
+         * Mediums are kept in an AABB tree, so a point lookup costs O(log M) instead of a scan
+         * of every medium. update() also caches the medium of each entity. Entities rarely
+         * leave their medium from one step to the next, so the cached medium is checked first
+         * and the tree is searched only when the entity left it, or when other mediums overlap
+         * it and one of them could now be the innermost.
+         *
+         * Where mediums are nested, an entity is in the innermost one: the containing medium
+         * of least volume.
+         */
+        class MediumIndex
+        {
+          public:
+            /**
+             * @brief Medium index of a point outside every medium.
+             */
+            static constexpr std::uint32_t NO_MEDIUM = UINT32_MAX;
+
+            /**
+             * @brief Minimum number of entities per parallel chunk of update().
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 4096;
+
+            /**
+             * @brief Constructs a disabled, empty index.
+             */
+            MediumIndex();
+
+            /**
+             * @brief Sets whether update() maintains the index.
+             * @param enabled If false, update() does nothing and lookups see the last state.
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * @brief Indicates whether update() maintains the index.
+             * @return True if enabled.
+             */
+            bool isEnabled() const
+            {
+                return _enabled;
+            }
+
+            /**
+             * @brief Makes the next update() rebuild the index, e.g. after mediums were added.
+             */
+            void invalidate();
+
+            /**
+             * @brief Reads the medium shapes and positions and finds the medium of each entity.
+             * @param mediums Mediums of the world. They must outlive the lookups.
+             * @param store State of the entities.
+             * @param threadPool Pool running the entity pass, or nullptr to run serially.
+             */
+            void update(const std::vector<std::unique_ptr<IMedium>> &mediums,
+                        const EntityStore &store, ThreadPool *threadPool = nullptr);
+
+            /**
+             * @brief Retrieves the medium an entity was in at the last update().
+             * @param entityIndex Index of the entity in the world.
+             * @return The innermost medium, or nullptr if the entity is in none.
+             */
+            const IMedium *getEntityMedium(std::size_t entityIndex) const;
+
+            /**
+             * @brief Retrieves the index of the medium an entity was in at the last update().
+             * @param entityIndex Index of the entity in the world.
+             * @return The innermost medium index, or NO_MEDIUM.
+             */
+            std::uint32_t getEntityMediumIndex(std::size_t entityIndex) const
+            {
+                return (entityIndex < _entityMediums.size()) ? _entityMediums[entityIndex]
+                                                              : NO_MEDIUM;
+            }
+
+            /**
+             * @brief Finds the innermost medium containing a point.
+             * @param point The query point, in metres.
+             * @return The medium index, or NO_MEDIUM.
+             */
+            std::uint32_t findMedium(const std::array<double, 3> &point) const;
+
+            /**
+             * @brief Finds every medium containing a point.
+             * @param point The query point, in metres.
+             * @param result Receives the medium indices, innermost first.
+             */
+            void findMediums(const std::array<double, 3> &point,
+                             std::vector<std::uint32_t> &result) const;
+
+            /**
+             * @brief Retrieves how many entities the last update() had to search the tree for.
+             * @return The number of cache misses; the other entities kept their medium.
+             */
+            std::size_t getLastLookupCount() const
+            {
+                return _lastLookupCount;
+            }
+
+          private:
+            /**
+             * @brief Checks whether medium index contains point.
+             */
+            bool contains(std::uint32_t index, const std::array<double, 3> &point) const
+            {
+                return _shapes[index].contains(_centres[index], point);
+            }
+
+            /**
+             * @brief Checks whether medium a is nested inside medium b (b is larger).
+             */
+            bool isInner(std::uint32_t a, std::uint32_t b) const
+            {
+                return _volumes[a] < _volumes[b] || (_volumes[a] == _volumes[b] && a < b);
+            }
+
+            /**
+             * @brief Reads the medium shapes, rebuilding the tree if needed.
+             */
+            void updateMediums(const std::vector<std::unique_ptr<IMedium>> &mediums);
+
+            bool _enabled;                /**< update() maintains the index. */
+            bool _dirty;                  /**< The next update() rebuilds the tree. */
+            std::size_t _lastLookupCount; /**< Tree searches of the last update. */
+
+            const std::vector<std::unique_ptr<IMedium>> *_mediums; /**< Mediums of the world. */
+            DynamicAabbTree _tree;                                 /**< Tree over the mediums. */
+            std::vector<std::int32_t> _proxies;                    /**< Proxy of each medium. */
+            std::vector<BoundingShape> _shapes;                    /**< Shape of each medium. */
+            std::vector<std::array<double, 3>> _centres;           /**< Centre of each medium. */
+            std::vector<double> _volumes;                          /**< Volume, in m^3. */
+            std::vector<std::uint8_t> _overlapped;                 /**< Overlaps another medium. */
+            std::vector<std::uint32_t> _entityMediums;             /**< Medium of each entity. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_MEDIUM_INDEX_H
@@ -0,0 +1,149 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file mutual_gravity.h
+ * @brief Declaration of the MutualGravity abstract class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_MUTUAL_GRAVITY_H
+#define INERTIAFX_CORE_ENGINE_MUTUAL_GRAVITY_H
+
+#include "iforce_generator.h"
+#include "thread_pool.h"
+#include <cstddef>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class MutualGravity
+         * @brief Base of the force generators making every entity attract every other one.
+         *
+         * Each pair of entities i, j at distance r feels G m_i m_j r / (r^2 + eps^2)^(3/2),
+         * where eps is a Plummer softening length that keeps close encounters finite.
+         * Entities of zero inverse mass have no mass here: they neither attract nor feel a force.
+         */
+        class MutualGravity : public IForceGenerator
+        {
+          public:
+            /**
+             * @brief Newtonian constant of gravitation (CODATA 2018), in m^3 kg^-1 s^-2.
+             */
+            static constexpr double GRAVITATIONAL_CONSTANT = 6.67430e-11;
+
+            /**
+             * @brief Default destructor.
+             */
+            virtual ~MutualGravity() = default;
+
+            /**
+             * @copydoc IForceGenerator::setThreadPool(ThreadPool *)
+             */
+            void setThreadPool(ThreadPool *threadPool) override
+            {
+                _threadPool = threadPool;
+            }
+
+            /**
+             * @brief Sets the constant of gravitation, e.g. 1 for simulations in N-body units.
+             * @param gravitationalConstant The constant, in m^3 kg^-1 s^-2.
+             */
+            void setGravitationalConstant(double gravitationalConstant)
+            {
+                _gravitationalConstant = gravitationalConstant;
+            }
+
+            /**
+             * @brief Retrieves the constant of gravitation.
+             * @return The constant, in m^3 kg^-1 s^-2.
+             */
+            double getGravitationalConstant() const
+            {
+                return _gravitationalConstant;
+            }
+
+            /**
+             * @brief Sets the Plummer softening length.
+             * @param softening The length, in metres; 0 gives the exact Newtonian force.
+             */
+            void setSoftening(double softening)
+            {
+                _softening = softening;
+            }
+
+            /**
+             * @brief Retrieves the Plummer softening length.
+             * @return The length, in metres.
+             */
+            double getSoftening() const
+            {
+                return _softening;
+            }
+
+          protected:
+            /**
+             * @brief Constructs a generator with the SI constant and no softening.
+             */
+            MutualGravity() :
+                _threadPool(nullptr), _gravitationalConstant(GRAVITATIONAL_CONSTANT),
+                _softening(0.0)
+            {
+            }
+
+            /**
+             * @brief Runs body over [0, count), chunked on the thread pool when one is set.
+             * @param count Number of elements.
+             * @param body Function called once per chunk.
+             * @param minChunkSize Minimum number of elements per chunk.
+             */
+            void forEachChunk(std::size_t count, const ThreadPool::RangeFunction &body,
+                              std::size_t minChunkSize) const
+            {
+                if (_threadPool == nullptr)
+                {
+                    body(0, count);
+                    return;
+                }
+                _threadPool->parallelFor(count, body, minChunkSize);
+            }
+
+            /**
+             * @brief Mass of an entity from its inverse mass.
+             * @param inverseMass The inverse mass, in 1/kg.
+             * @return The mass, in kilograms, or 0 for a zero inverse mass.
+             */
+            static double getMass(double inverseMass)
+            {
+                return inverseMass > 0.0 ? 1.0 / inverseMass : 0.0;
+            }
+
+            ThreadPool *_threadPool;       /**< Pool running the chunks, or nullptr. */
+            double _gravitationalConstant; /**< G, in m^3 kg^-1 s^-2. */
+            double _softening;             /**< Plummer softening length, in metres. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_MUTUAL_GRAVITY_H
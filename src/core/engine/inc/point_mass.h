@@ -104,6 +104,32 @@ namespace Core
             PointMass(const Mass &mass, const Position &position, const Velocity &velocity,
                       const Acceleration &acceleration, const Force &netForce);
 
+            /**
+             * @brief Copy constructor; the copy counts as a new instance.
+             * @param other The point mass to copy.
+             */
+            PointMass(const PointMass &other);
+
+            /**
+             * @brief Copy assignment; the instance count is unchanged.
+             * @param other The point mass to copy.
+             * @return This point mass.
+             */
+            PointMass &operator=(const PointMass &other) = default;
+
+            /**
+             * @brief Move constructor; the new point mass counts as an instance.
+             * @param other The point mass to move from.
+             */
+            PointMass(PointMass &&other) noexcept;
+
+            /**
+             * @brief Move assignment; the instance count is unchanged.
+             * @param other The point mass to move from.
+             * @return This point mass.
+             */
+            PointMass &operator=(PointMass &&other) noexcept = default;
+
             /**
              * @brief Destructor.
              */
@@ -0,0 +1,131 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file run_handle.h
+ * @brief Declaration of the RunHandle class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_RUN_HANDLE_H
+#define INERTIAFX_CORE_ENGINE_RUN_HANDLE_H
+
+#include <cstdint>
+#include <thread>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        class Engine;
+
+        /**
+         * @class RunHandle
+         * @brief Controls a simulation started with Engine::runAsync().
+         *
+         * The handle owns the simulation thread. Destroying a handle that is still joinable
+         * stops the simulation and waits for it to finish.
+         * @note The engine must outlive the handle.
+         */
+        class RunHandle
+        {
+          public:
+            /**
+             * @brief Constructs an empty handle, not attached to any simulation.
+             */
+            RunHandle() noexcept;
+
+            /**
+             * @brief Stops the simulation, if still running, and joins its thread.
+             */
+            ~RunHandle();
+
+            RunHandle(const RunHandle &)            = delete;
+            RunHandle &operator=(const RunHandle &) = delete;
+
+            RunHandle(RunHandle &&other) noexcept;
+            RunHandle &operator=(RunHandle &&other) noexcept;
+
+            /**
+             * @brief Requests the simulation to stop after the current step.
+             * This is a non-blocking call.
+             */
+            void stop();
+
+            /**
+             * @brief Suspends the simulation before its next step.
+             */
+            void pause();
+
+            /**
+             * @brief Resumes a paused simulation.
+             */
+            void resume();
+
+            /**
+             * @brief Waits for the simulation to finish.
+             * @throws Rethrows any exception that ended the simulation.
+             */
+            void join();
+
+            /**
+             * @brief Checks whether the handle still owns a thread that has not been joined.
+             * @return True if join() must still be called.
+             */
+            bool joinable() const;
+
+            /**
+             * @brief Checks whether the simulation is still executing steps or paused.
+             * @return True until the simulation loop returns.
+             */
+            bool isRunning() const;
+
+            /**
+             * @brief Checks whether the simulation is paused.
+             * @return True if pause() was requested and not resumed.
+             */
+            bool isPaused() const;
+
+            /**
+             * @brief Retrieves the number of steps executed by the engine. Lock-free.
+             * @return The step count.
+             */
+            std::uint64_t getStepCount() const;
+
+            /**
+             * @brief Retrieves the simulation time reached by the engine. Lock-free.
+             * @return The simulation time in seconds.
+             */
+            double getSimulationTime() const;
+
+          private:
+            friend class Engine;
+
+            RunHandle(Engine &engine, std::thread thread);
+
+            Engine *_engine;     /**< Engine running the simulation, or nullptr. */
+            std::thread _thread; /**< Simulation thread. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_RUN_HANDLE_H
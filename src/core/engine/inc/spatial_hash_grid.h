@@ -0,0 +1,335 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spatial_hash_grid.h
+ * @brief Declaration of the SpatialHashGrid class.
+ *
+ * @details The grid buckets the entities of an EntityStore by the cubic cell holding their
+ * position. Cells are hashed into a table about twice the entity count, so only occupied cells
+ * cost memory, and the entity indices are kept sorted by bucket in one contiguous array: a radius
+ * query reads the few buckets its sphere overlaps, instead of every entity.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_SPATIAL_HASH_GRID_H
+#define INERTIAFX_CORE_ENGINE_SPATIAL_HASH_GRID_H
+
+#include "entity_store.h"
+#include "thread_pool.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class SpatialHashGrid
+         * @brief Uniform hash grid answering radius and k-nearest queries over entity positions.
+         *
+         * update() recomputes every entity's cell in parallel; the sorted layout is rebuilt only
+         * when an entity changed cell, which slow moving scenes rarely do from one step to the
+         * next. Queries read the current positions of the store but the cells of the last
+         * update(), so an entity that has since crossed into a cell the query does not visit is
+         * missed; World updates the grid at the start of each step.
+         */
+        class SpatialHashGrid
+        {
+          public:
+            /**
+             * @brief Cell size asking the grid to derive one from the entities.
+             */
+            static constexpr double AUTO_CELL_SIZE = 0.0;
+
+            /**
+             * @brief Minimum number of entities per parallel chunk.
+             */
+            static constexpr std::size_t MIN_CHUNK_SIZE = 4096;
+
+            /**
+             * @brief Constructs a disabled, empty grid.
+             * @param cellSize Edge of the cells, in metres, or AUTO_CELL_SIZE.
+             */
+            explicit SpatialHashGrid(double cellSize = AUTO_CELL_SIZE);
+
+            /**
+             * @brief Sets whether update() maintains the grid.
+             * @param enabled If false, update() does nothing and queries see the last state.
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * @brief Indicates whether update() maintains the grid.
+             * @return True if enabled.
+             */
+            bool isEnabled() const
+            {
+                return _enabled;
+            }
+
+            /**
+             * @brief Sets the cell edge; the next update() rebuilds the grid.
+             * @param cellSize Edge of the cells, in metres. With AUTO_CELL_SIZE it is twice the
+             * largest bounding radius, or, for point-like entities, the edge giving about one
+             * entity per cell over their bounding box.
+             */
+            void setCellSize(double cellSize);
+
+            /**
+             * @brief Retrieves the cell edge in use.
+             * @return The edge, in metres, chosen by the last rebuild.
+             */
+            double getCellSize() const
+            {
+                return _cellSize;
+            }
+
+            /**
+             * @brief Makes the next update() rebuild the grid, e.g. after entities were added.
+             */
+            void invalidate();
+
+            /**
+             * @brief Brings the grid up to date with the entity positions.
+             * @param store The entities. It must outlive the queries.
+             * @param threadPool Pool running the per-entity passes, or nullptr to run serially.
+             * @return True if the layout was rebuilt.
+             */
+            bool update(const EntityStore &store, ThreadPool *threadPool = nullptr);
+
+            /**
+             * @brief Rebuilds the grid from scratch, whether enabled or not.
+             * @param store The entities. It must outlive the queries.
+             * @param threadPool Pool running the per-entity passes, or nullptr to run serially.
+             */
+            void rebuild(const EntityStore &store, ThreadPool *threadPool = nullptr);
+
+            /**
+             * @brief Retrieves the number of entities indexed.
+             * @return The entity count of the last update.
+             */
+            std::size_t size() const
+            {
+                return _cells.size();
+            }
+
+            /**
+             * @brief Retrieves how many times the sorted layout was built.
+             * @return The layout count.
+             */
+            std::uint64_t getLayoutCount() const
+            {
+                return _layoutCount;
+            }
+
+            /**
+             * @brief Calls visit(index, distanceSquared) for each entity within radius of centre.
+             * @param centre The query point, in metres.
+             * @param radius The query radius, in metres.
+             * @param visit Callable taking the entity index and its squared distance.
+             *
+             * Entities are visited bucket by bucket, in no particular order.
+             */
+            template <typename Visitor>
+            void forEachInRadius(const std::array<double, 3> &centre, double radius,
+                                 Visitor &&visit) const;
+
+            /**
+             * @brief Collects the entities within radius of centre.
+             * @param centre The query point, in metres.
+             * @param radius The query radius, in metres.
+             * @param result Receives the entity indices, in no particular order.
+             */
+            void queryRadius(const std::array<double, 3> &centre, double radius,
+                             std::vector<std::size_t> &result) const;
+
+            /**
+             * @brief Collects the k entities nearest to centre.
+             * @param centre The query point, in metres.
+             * @param k Number of entities wanted; fewer are returned if the grid holds fewer.
+             * @param result Receives the entity indices, nearest first.
+             */
+            void queryNearest(const std::array<double, 3> &centre, std::size_t k,
+                              std::vector<std::size_t> &result) const;
+
+          private:
+            /**
+             * @brief Largest cell index magnitude, leaving room to step past it without overflow.
+             */
+            static constexpr std::int32_t CELL_LIMIT = 1 << 30;
+
+            /**
+             * @brief Integer coordinates of a cell.
+             */
+            struct Cell
+            {
+                std::int32_t x; /**< Cell index along x. */
+                std::int32_t y; /**< Cell index along y. */
+                std::int32_t z; /**< Cell index along z. */
+
+                bool operator==(const Cell &other) const = default;
+            };
+
+            /**
+             * @brief Cell index of a coordinate, clamped to +/-CELL_LIMIT.
+             */
+            std::int32_t toCell(double coordinate) const;
+
+            /**
+             * @brief Cell holding a point.
+             */
+            Cell cellOf(const std::array<double, 3> &point) const
+            {
+                return {toCell(point[0]), toCell(point[1]), toCell(point[2])};
+            }
+
+            /**
+             * @brief Bucket of a cell in the hash table.
+             */
+            std::size_t bucketOf(const Cell &cell) const
+            {
+                const std::uint32_t hash = (static_cast<std::uint32_t>(cell.x) * 73856093u) ^
+                                           (static_cast<std::uint32_t>(cell.y) * 19349663u) ^
+                                           (static_cast<std::uint32_t>(cell.z) * 83492791u);
+                return hash & _bucketMask;
+            }
+
+            /**
+             * @brief Calls visit(index, distanceSquared) for the entities of one cell within
+             * radiusSquared of centre.
+             */
+            template <typename Visitor>
+            void visitCell(const Cell &cell, const std::array<double, 3> &centre,
+                           double radiusSquared, Visitor &visit) const;
+
+            /**
+             * @brief Squared distance from centre to entity index.
+             */
+            double distanceSquared(const std::array<double, 3> &centre, std::size_t index) const
+            {
+                const Vector3Array &positions = _store->positions();
+                const double dx               = positions.x[index] - centre[0];
+                const double dy               = positions.y[index] - centre[1];
+                const double dz               = positions.z[index] - centre[2];
+                return dx * dx + dy * dy + dz * dz;
+            }
+
+            /**
+             * @brief Derives the cell edge from the entity radii and bounding box.
+             */
+            double chooseCellSize(const EntityStore &store) const;
+
+            /**
+             * @brief Recomputes the entity cells; returns true if any changed.
+             */
+            bool computeCells(const EntityStore &store, ThreadPool *threadPool);
+
+            /**
+             * @brief Sorts the entity indices by bucket.
+             */
+            void layout(ThreadPool *threadPool);
+
+            bool _enabled;              /**< update() maintains the grid. */
+            bool _dirty;                /**< The next update() rebuilds the grid. */
+            double _requestedCellSize;  /**< Configured edge, or AUTO_CELL_SIZE. */
+            double _cellSize;           /**< Edge in use, in metres. */
+            double _inverseCellSize;    /**< 1 / _cellSize. */
+            std::size_t _bucketMask;    /**< Hash table size minus one. */
+            std::uint64_t _layoutCount; /**< Layouts built. */
+
+            const EntityStore *_store;               /**< Entities of the last update. */
+            std::vector<Cell> _cells;                /**< Cell of each entity. */
+            std::vector<std::uint32_t> _bucketStart; /**< Start of each bucket in _sorted. */
+            std::vector<std::uint32_t> _sorted;      /**< Entity indices, grouped by bucket. */
+            Cell _minCell;                           /**< Lowest occupied cell on each axis. */
+            Cell _maxCell;                           /**< Highest occupied cell on each axis. */
+        };
+
+        template <typename Visitor>
+        void SpatialHashGrid::visitCell(const Cell &cell, const std::array<double, 3> &centre,
+                                        double radiusSquared, Visitor &visit) const
+        {
+            const std::size_t bucket = bucketOf(cell);
+            for (std::uint32_t k = _bucketStart[bucket]; k < _bucketStart[bucket + 1]; ++k)
+            {
+                // Other cells may share the bucket
+                const std::uint32_t index = _sorted[k];
+                if (!(_cells[index] == cell))
+                {
+                    continue;
+                }
+                const double d2 = distanceSquared(centre, index);
+                if (d2 <= radiusSquared)
+                {
+                    visit(static_cast<std::size_t>(index), d2);
+                }
+            }
+        }
+
+        template <typename Visitor>
+        void SpatialHashGrid::forEachInRadius(const std::array<double, 3> &centre, double radius,
+                                              Visitor &&visit) const
+        {
+            if (_store == nullptr || _cells.empty() || !(radius >= 0.0))
+            {
+                return;
+            }
+            const double radiusSquared = radius * radius;
+
+            const Cell low  = cellOf({centre[0] - radius, centre[1] - radius, centre[2] - radius});
+            const Cell high = cellOf({centre[0] + radius, centre[1] + radius, centre[2] + radius});
+
+            // A sphere spanning more cells than there are entities is cheaper to test directly
+            const double cellCount = (static_cast<double>(high.x) - low.x + 1.0) *
+                                     (static_cast<double>(high.y) - low.y + 1.0) *
+                                     (static_cast<double>(high.z) - low.z + 1.0);
+            if (cellCount > static_cast<double>(_cells.size()))
+            {
+                for (std::size_t index = 0; index < _cells.size(); ++index)
+                {
+                    const double d2 = distanceSquared(centre, index);
+                    if (d2 <= radiusSquared)
+                    {
+                        visit(index, d2);
+                    }
+                }
+                return;
+            }
+
+            for (std::int32_t x = low.x; x <= high.x; ++x)
+            {
+                for (std::int32_t y = low.y; y <= high.y; ++y)
+                {
+                    for (std::int32_t z = low.z; z <= high.z; ++z)
+                    {
+                        visitCell(Cell{x, y, z}, centre, radiusSquared, visit);
+                    }
+                }
+            }
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_SPATIAL_HASH_GRID_H
@@ -0,0 +1,156 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file thread_pool.h
+ * @brief Declaration of the ThreadPool class.
+ *
+ * @details Work-stealing pool used by the Engine to split per-entity phases into chunks. Every
+ * participant owns a task queue; idle participants steal from the others. Chunk boundaries only
+ * depend on the element count and the worker count, never on scheduling, so a chunked loop
+ * whose iterations are independent produces bit-identical results to the serial loop.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_ENGINE_THREAD_POOL_H
+#define INERTIAFX_CORE_ENGINE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        /**
+         * @class ThreadPool
+         * @brief Fixed-size work-stealing thread pool with deterministic range chunking.
+         */
+        class ThreadPool
+        {
+          public:
+            /**
+             * @brief Function processing the half-open index range [begin, end).
+             */
+            using RangeFunction = std::function<void(std::size_t, std::size_t)>;
+
+            /**
+             * @brief Constructs a new ThreadPool object.
+             * @param workerCount Number of threads taking part in parallelFor(), including the
+             * calling thread. It defaults to the hardware concurrency; 0 is treated as 1.
+             */
+            explicit ThreadPool(std::size_t workerCount = std::thread::hardware_concurrency());
+
+            /**
+             * @brief Stops and joins the worker threads.
+             */
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool &)            = delete;
+            ThreadPool &operator=(const ThreadPool &) = delete;
+
+            /**
+             * @brief Retrieves the number of threads taking part in parallelFor().
+             * @return The worker count, including the calling thread.
+             */
+            std::size_t getWorkerCount() const
+            {
+                return _queues.size();
+            }
+
+            /**
+             * @brief Retrieves the number of chunks parallelFor() splits a range into.
+             * @param count Number of elements.
+             * @param minChunkSize Minimum number of elements per chunk.
+             * @return The chunk count; it depends only on the arguments and the worker count.
+             */
+            std::size_t getChunkCount(std::size_t count, std::size_t minChunkSize = 1) const;
+
+            /**
+             * @brief Runs body over [0, count) split into chunks and waits for all of them.
+             * @param count Number of elements.
+             * @param body Function called once per chunk. Chunks must not depend on each other.
+             * @param minChunkSize Minimum number of elements per chunk. Ranges of at most this
+             * size run inline on the calling thread.
+             *
+             * The calling thread executes chunks as well while it waits. If chunks throw, the
+             * remaining ones still run and the first exception is rethrown once all have finished.
+             */
+            void parallelFor(std::size_t count, const RangeFunction &body,
+                             std::size_t minChunkSize = 1);
+
+          private:
+            /**
+             * @brief One parallelFor() call, shared by its chunk tasks.
+             */
+            struct Job
+            {
+                const RangeFunction *body;          /**< Function to run per chunk. */
+                std::size_t count;                  /**< Number of elements. */
+                std::size_t chunkCount;             /**< Number of chunks. */
+                std::atomic<std::size_t> remaining; /**< Chunks not yet finished. */
+                std::mutex errorMutex;              /**< Guards error. */
+                std::exception_ptr error;           /**< First exception thrown by a chunk. */
+            };
+
+            /**
+             * @brief One chunk of a job.
+             */
+            struct Task
+            {
+                Job *job;          /**< Owning job. */
+                std::size_t chunk; /**< Chunk index within the job. */
+            };
+
+            /**
+             * @brief Task queue owned by one participant.
+             */
+            struct TaskQueue
+            {
+                std::mutex mutex;       /**< Guards tasks. */
+                std::deque<Task> tasks; /**< Owner pops at the back, thieves at the front. */
+            };
+
+            bool tryPop(std::size_t queue, Task &task);
+            bool trySteal(std::size_t thief, Task &task);
+            void runTask(const Task &task);
+            void workerLoop(std::size_t index);
+
+            std::vector<std::unique_ptr<TaskQueue>> _queues; /**< Queue 0 serves callers. */
+            std::vector<std::thread> _workers;               /**< Background worker threads. */
+            std::mutex _sleepMutex;                          /**< Guards sleeping workers. */
+            std::condition_variable _wake;                   /**< Wakes idle workers. */
+            std::atomic<std::size_t> _queued;                /**< Tasks waiting or being pushed. */
+            bool _stopping;                                  /**< Set on destruction. */
+        };
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_ENGINE_THREAD_POOL_H
@@ -68,6 +68,19 @@ namespace Core
              */
             Water &operator=(const Water &other);
 
+            /**
+             * @brief Move constructor.
+             * @param other The Water object to move from; its material is taken over.
+             */
+            Water(Water &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The Water object to move from; its material is taken over.
+             * @return A reference to this object.
+             */
+            Water &operator=(Water &&other) noexcept;
+
             /**
              * @brief Default destructor.
              */
@@ -26,7 +26,12 @@
 #ifndef INERTIAFX_CORE_ENGINE_WORLD_H
 #define INERTIAFX_CORE_ENGINE_WORLD_H
 
+#include "bounding_volume_hierarchy.h"
+#include "entity_handle.h"
 #include "iworld.h"
+#include "medium_index.h"
+#include "spatial_hash_grid.h"
+#include "thread_pool.h"
 #include <vector>
 
 namespace InertiaFX
@@ -42,6 +47,11 @@ namespace Core
         class World : public IWorld
         {
           public:
+            /**
+             * @brief Minimum number of entities per parallel chunk of syncEntities().
+             */
+            static constexpr std::size_t SYNC_CHUNK_SIZE = 1024;
+
             /**
              * @brief Default destructor.
              */
@@ -100,7 +110,12 @@ namespace Core
              */
             void addEntity(std::unique_ptr<IEntity> entity) override
             {
-                _entities.push_back(std::move(entity));
+                // The entity state moves into the store; the world keeps a proxy to it
+                const std::size_t index = _entityStore.add(*entity);
+                _entities.push_back(
+                    std::make_unique<EntityHandle>(_entityStore, index, std::move(entity)));
+                _spatialHashGrid.invalidate();
+                _boundingVolumeHierarchy.invalidate();
             }
 
             /**
@@ -109,6 +124,8 @@ namespace Core
             void addMedium(std::unique_ptr<IMedium> medium) override
             {
                 _mediums.push_back(std::move(medium));
+                _boundingVolumeHierarchy.invalidate();
+                _mediumIndex.invalidate();
             }
 
             /**
@@ -119,6 +136,100 @@ namespace Core
                 return _gravity;
             }
 
+            /**
+             * @copydoc IWorld::getEntityStore()
+             */
+            EntityStore &getEntityStore() override
+            {
+                return _entityStore;
+            }
+
+            /**
+             * @copydoc IWorld::getEntityStore() const
+             */
+            const EntityStore &getEntityStore() const override
+            {
+                return _entityStore;
+            }
+
+            /**
+             * @copydoc IWorld::getSpatialHashGrid()
+             */
+            SpatialHashGrid &getSpatialHashGrid() override
+            {
+                return _spatialHashGrid;
+            }
+
+            /**
+             * @copydoc IWorld::getSpatialHashGrid() const
+             */
+            const SpatialHashGrid &getSpatialHashGrid() const override
+            {
+                return _spatialHashGrid;
+            }
+
+            /**
+             * @copydoc IWorld::getBoundingVolumeHierarchy()
+             */
+            BoundingVolumeHierarchy &getBoundingVolumeHierarchy() override
+            {
+                return _boundingVolumeHierarchy;
+            }
+
+            /**
+             * @copydoc IWorld::getBoundingVolumeHierarchy() const
+             */
+            const BoundingVolumeHierarchy &getBoundingVolumeHierarchy() const override
+            {
+                return _boundingVolumeHierarchy;
+            }
+
+            /**
+             * @copydoc IWorld::getMediumIndex()
+             */
+            MediumIndex &getMediumIndex() override
+            {
+                return _mediumIndex;
+            }
+
+            /**
+             * @copydoc IWorld::getMediumIndex() const
+             */
+            const MediumIndex &getMediumIndex() const override
+            {
+                return _mediumIndex;
+            }
+
+            /**
+             * @copydoc IWorld::updateSpatialIndices(ThreadPool *)
+             */
+            void updateSpatialIndices(ThreadPool *threadPool) override
+            {
+                _spatialHashGrid.update(_entityStore, threadPool);
+                _boundingVolumeHierarchy.update(_entities, _entityStore, _mediums, threadPool);
+                _mediumIndex.update(_mediums, _entityStore, threadPool);
+            }
+
+            /**
+             * @copydoc IWorld::syncEntities(ThreadPool *)
+             */
+            void syncEntities(ThreadPool *threadPool) override
+            {
+                // Every entity of the world is an EntityHandle, see addEntity()
+                auto sync = [this](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        static_cast<EntityHandle &>(*_entities[i]).sync();
+                    }
+                };
+                if (threadPool == nullptr)
+                {
+                    sync(0, _entities.size());
+                    return;
+                }
+                threadPool->parallelFor(_entities.size(), sync, SYNC_CHUNK_SIZE);
+            }
+
           protected:
             /**
              * @brief Default constructor.
@@ -138,8 +249,13 @@ namespace Core
             {
             }
 
+            EntityStore _entityStore;         /**< Structure-of-arrays state of the entities. */
+            SpatialHashGrid _spatialHashGrid; /**< Neighbour index over entity positions. */
+            BoundingVolumeHierarchy
+                _boundingVolumeHierarchy; /**< AABB trees over entities and mediums. */
+            MediumIndex _mediumIndex;     /**< Medium of each entity. */
             std::vector<std::unique_ptr<IEntity>>
-                _entities; /**< Vector of unique pointers to entities in the world. */
+                _entities; /**< Vector of proxies (EntityHandle) to entities in the world. */
             std::vector<std::unique_ptr<IMedium>>
                 _mediums;   /**< Vector of unique pointers to mediums in the world. */
             Volume _volume; /**< Volume of the world. */
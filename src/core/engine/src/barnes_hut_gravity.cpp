@@ -0,0 +1,195 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file barnes_hut_gravity.cpp
+ * @brief Definition of the BarnesHutGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "barnes_hut_gravity.h"
+#include <cmath>
+#include <limits>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        BarnesHutGravity::BarnesHutGravity(double theta) :
+            _theta(theta), _leafCapacity(DEFAULT_LEAF_CAPACITY)
+        {
+        }
+
+        void BarnesHutGravity::apply(IWorld &world, [[maybe_unused]] double time)
+        {
+            EntityStore &store = world.getEntityStore();
+            _tree.build(store, _leafCapacity, _threadPool);
+            if (_tree.getBodyCount() == 0)
+            {
+                return;
+            }
+
+            // Children before parents: one parallel pass per level, deepest first
+            _cells.resize(_tree.getNodes().size());
+            for (std::size_t level = _tree.getLevelCount(); level-- > 0;)
+            {
+                const std::span<const std::uint32_t> nodes = _tree.getLevel(level);
+                forEachChunk(
+                    nodes.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                        for (std::size_t k = begin; k < end; ++k)
+                        {
+                            summarise(nodes[k]);
+                        }
+                    },
+                    MIN_CHUNK_SIZE);
+            }
+
+            forEachChunk(
+                _tree.getBodyCount(),
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t body = begin; body < end; ++body)
+                    {
+                        const std::array<double, 3> field = walk(body);
+                        const std::uint32_t index         = _tree.getEntityIndex(body);
+                        const double scale = _gravitationalConstant * _tree.getMasses()[body];
+                        store.forces().x[index] += scale * field[0];
+                        store.forces().y[index] += scale * field[1];
+                        store.forces().z[index] += scale * field[2];
+                    }
+                },
+                MIN_CHUNK_SIZE);
+        }
+
+        void BarnesHutGravity::summarise(std::uint32_t node)
+        {
+            const GravityOctree::Node &cell   = _tree.getNodes()[node];
+            const std::vector<double> &masses = _tree.getMasses();
+            double mass                       = 0.0;
+            std::array<double, 3> weighted    = {0.0, 0.0, 0.0};
+            if (cell.isLeaf())
+            {
+                for (std::uint32_t body = cell.first; body < cell.first + cell.count; ++body)
+                {
+                    mass += masses[body];
+                    weighted[0] += masses[body] * _tree.getX()[body];
+                    weighted[1] += masses[body] * _tree.getY()[body];
+                    weighted[2] += masses[body] * _tree.getZ()[body];
+                }
+            }
+            else
+            {
+                for (std::uint32_t child = 0; child < cell.childCount; ++child)
+                {
+                    const Cell &summary = _cells[cell.firstChild + child];
+                    mass += summary.mass;
+                    for (std::size_t axis = 0; axis < 3; ++axis)
+                    {
+                        weighted[axis] += summary.mass * summary.centreOfMass[axis];
+                    }
+                }
+            }
+
+            Cell &summary  = _cells[node];
+            summary.mass   = mass;
+            double offset2 = 0.0;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                summary.centreOfMass[axis] = weighted[axis] / mass;
+                const double offset        = summary.centreOfMass[axis] - cell.centre[axis];
+                offset2 += offset * offset;
+            }
+            summary.openingRadius = (_theta > 0.0)
+                                        ? 2.0 * cell.halfSize / _theta + std::sqrt(offset2)
+                                        : std::numeric_limits<double>::infinity();
+        }
+
+        std::array<double, 3> BarnesHutGravity::walk(std::size_t body) const
+        {
+            const std::vector<GravityOctree::Node> &nodes = _tree.getNodes();
+            const std::vector<double> &xs                 = _tree.getX();
+            const std::vector<double> &ys                 = _tree.getY();
+            const std::vector<double> &zs                 = _tree.getZ();
+            const std::vector<double> &masses             = _tree.getMasses();
+            const double x                                = xs[body];
+            const double y                                = ys[body];
+            const double z                                = zs[body];
+            const double softening2                       = _softening * _softening;
+            double ax                                     = 0.0;
+            double ay                                     = 0.0;
+            double az                                     = 0.0;
+            auto attract = [&](double dx, double dy, double dz, double mass) {
+                const double r2 = dx * dx + dy * dy + dz * dz + softening2;
+                if (r2 == 0.0)
+                {
+                    return;
+                }
+                const double inverseR = 1.0 / std::sqrt(r2);
+                const double weight   = mass * inverseR * inverseR * inverseR;
+                ax += weight * dx;
+                ay += weight * dy;
+                az += weight * dz;
+            };
+
+            // At most seven pending siblings per level, plus the root
+            std::array<std::uint32_t, 8 * (GravityOctree::MAX_DEPTH + 1)> stack;
+            std::size_t top = 0;
+            stack[top++]    = 0;
+            while (top > 0)
+            {
+                const std::uint32_t index       = stack[--top];
+                const GravityOctree::Node &node = nodes[index];
+                const Cell &summary             = _cells[index];
+                const double dx                 = summary.centreOfMass[0] - x;
+                const double dy                 = summary.centreOfMass[1] - y;
+                const double dz                 = summary.centreOfMass[2] - z;
+                const bool inside = std::abs(x - node.centre[0]) <= node.halfSize &&
+                                    std::abs(y - node.centre[1]) <= node.halfSize &&
+                                    std::abs(z - node.centre[2]) <= node.halfSize;
+                const double distance2 = dx * dx + dy * dy + dz * dz;
+                if (!inside && distance2 > summary.openingRadius * summary.openingRadius)
+                {
+                    attract(dx, dy, dz, summary.mass);
+                }
+                else if (node.isLeaf())
+                {
+                    for (std::uint32_t other = node.first; other < node.first + node.count;
+                         ++other)
+                    {
+                        if (other != body)
+                        {
+                            attract(xs[other] - x, ys[other] - y, zs[other] - z, masses[other]);
+                        }
+                    }
+                }
+                else
+                {
+                    for (std::uint32_t child = node.childCount; child-- > 0;)
+                    {
+                        stack[top++] = static_cast<std::uint32_t>(node.firstChild) + child;
+                    }
+                }
+            }
+            return {ax, ay, az};
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,127 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file bounding_volume.cpp
+ * @brief Definition of the bounding shapes of volumes.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "bounding_volume.h"
+#include <cmath>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        bool BoundingShape::contains(const std::array<double, 3> &centre,
+                                     const std::array<double, 3> &point) const
+        {
+            if (type == Volume::Type::Sphere)
+            {
+                const double dx = point[0] - centre[0];
+                const double dy = point[1] - centre[1];
+                const double dz = point[2] - centre[2];
+                return dx * dx + dy * dy + dz * dz <= halfExtents[0] * halfExtents[0];
+            }
+            return boundsAt(centre).contains(point);
+        }
+
+        bool BoundingShape::overlaps(const std::array<double, 3> &centre, const Aabb &box) const
+        {
+            if (type != Volume::Type::Sphere)
+            {
+                return boundsAt(centre).overlaps(box);
+            }
+
+            // Distance from the sphere centre to the nearest point of the box
+            double distanceSquared = 0.0;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const double nearest = std::clamp(centre[axis], box.min[axis], box.max[axis]);
+                const double delta   = centre[axis] - nearest;
+                distanceSquared += delta * delta;
+            }
+            return distanceSquared <= halfExtents[0] * halfExtents[0];
+        }
+
+        bool BoundingShape::intersectsRay(const std::array<double, 3> &centre,
+                                          const std::array<double, 3> &origin,
+                                          const std::array<double, 3> &direction,
+                                          double maxDistance, double &distance) const
+        {
+            if (type != Volume::Type::Sphere)
+            {
+                const std::array<double, 3> inverseDirection = {
+                    1.0 / direction[0], 1.0 / direction[1], 1.0 / direction[2]};
+                return boundsAt(centre).intersectsRay(origin, inverseDirection, maxDistance,
+                                                      distance);
+            }
+
+            // Solve |origin + t * direction - centre| = radius for the smallest t >= 0
+            const std::array<double, 3> offset = {origin[0] - centre[0], origin[1] - centre[1],
+                                                  origin[2] - centre[2]};
+            const double b = offset[0] * direction[0] + offset[1] * direction[1] +
+                             offset[2] * direction[2];
+            const double c = offset[0] * offset[0] + offset[1] * offset[1] +
+                             offset[2] * offset[2] - halfExtents[0] * halfExtents[0];
+            if (c <= 0.0)
+            {
+                distance = 0.0;
+                return true;
+            }
+            const double discriminant = b * b - c;
+            if (b > 0.0 || discriminant < 0.0)
+            {
+                return false;
+            }
+            distance = -b - std::sqrt(discriminant);
+            return distance <= maxDistance;
+        }
+
+        BoundingShape getBoundingShape(const Volume &volume)
+        {
+            const double multiplier = DecimalPrefix::getMultiplier(volume.getPrefix());
+            if (volume.getType() == Volume::Type::Sphere)
+            {
+                const double radius = volume.getSphereDimensions() * multiplier;
+                return {Volume::Type::Sphere, {radius, radius, radius}};
+            }
+            const auto [length, width, height] = volume.getBoxDimensions();
+            return {Volume::Type::Box,
+                    {0.5 * length * multiplier, 0.5 * width * multiplier,
+                     0.5 * height * multiplier}};
+        }
+
+        double getBoundingRadius(const Volume &volume)
+        {
+            // The dimensions are kept in the prefix the volume was given in
+            const double multiplier = DecimalPrefix::getMultiplier(volume.getPrefix());
+            if (volume.getType() == Volume::Type::Sphere)
+            {
+                return volume.getSphereDimensions() * multiplier;
+            }
+            const auto [length, width, height] = volume.getBoxDimensions();
+            return 0.5 * multiplier * std::sqrt(length * length + width * width + height * height);
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,243 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file bounding_volume_hierarchy.cpp
+ * @brief Definition of the BoundingVolumeHierarchy class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "bounding_volume_hierarchy.h"
+#include <algorithm>
+#include <cmath>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        BoundingVolumeHierarchy::BoundingVolumeHierarchy(double margin) :
+            _enabled(false), _dirty(true), _margin(margin), _reinsertCount(0), _store(nullptr),
+            _entityTree(margin), _mediumTree(margin)
+        {
+        }
+
+        void BoundingVolumeHierarchy::setEnabled(bool enabled)
+        {
+            _enabled = enabled;
+            _dirty   = true;
+        }
+
+        void BoundingVolumeHierarchy::setMargin(double margin)
+        {
+            _margin = margin;
+            _dirty  = true;
+        }
+
+        void BoundingVolumeHierarchy::invalidate()
+        {
+            _dirty = true;
+        }
+
+        bool BoundingVolumeHierarchy::update(
+            const std::vector<std::unique_ptr<IEntity>> &entities, const EntityStore &store,
+            const std::vector<std::unique_ptr<IMedium>> &mediums, ThreadPool *threadPool)
+        {
+            if (!_enabled)
+            {
+                return false;
+            }
+            if (_dirty || _store != &store || _entityProxies.size() != store.size() ||
+                _mediumProxies.size() != mediums.size())
+            {
+                rebuild(entities, store, mediums);
+                return true;
+            }
+
+            // Find the entities out of their fat box in parallel; the tree is updated serially
+            const std::size_t count = _entityProxies.size();
+            auto findEscaped        = [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const Aabb box = _entityShapes[i].boundsAt(entityCentre(i));
+                    _entityEscaped[i] =
+                        _entityTree.getFatAabb(_entityProxies[i]).contains(box) ? 0 : 1;
+                }
+            };
+            if (threadPool == nullptr)
+            {
+                findEscaped(0, count);
+            }
+            else
+            {
+                threadPool->parallelFor(count, findEscaped, MIN_CHUNK_SIZE);
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (_entityEscaped[i])
+                {
+                    _entityTree.moveProxy(_entityProxies[i],
+                                          _entityShapes[i].boundsAt(entityCentre(i)));
+                    ++_reinsertCount;
+                }
+            }
+
+            updateMediums(mediums);
+            return false;
+        }
+
+        void BoundingVolumeHierarchy::rebuild(const std::vector<std::unique_ptr<IEntity>> &entities,
+                                              const EntityStore &store,
+                                              const std::vector<std::unique_ptr<IMedium>> &mediums)
+        {
+            _store = &store;
+            std::vector<Aabb> boxes(store.size());
+            _entityShapes.resize(store.size());
+            _entityEscaped.assign(store.size(), 0);
+            for (std::size_t i = 0; i < store.size(); ++i)
+            {
+                _entityShapes[i] = getBoundingShape(entities[i]->getVolume());
+                boxes[i]         = _entityShapes[i].boundsAt(entityCentre(i));
+            }
+            _entityTree.clear();
+            _entityTree.setMargin(_margin);
+            _entityTree.createProxies(boxes, _entityProxies);
+
+            boxes.resize(mediums.size());
+            _mediumShapes.resize(mediums.size());
+            _mediumCentres.resize(mediums.size());
+            for (std::size_t i = 0; i < mediums.size(); ++i)
+            {
+                _mediumShapes[i]  = getBoundingShape(mediums[i]->getVolume());
+                _mediumCentres[i] = mediums[i]->getPosition().getValue();
+                boxes[i]          = _mediumShapes[i].boundsAt(_mediumCentres[i]);
+            }
+            _mediumTree.clear();
+            _mediumTree.setMargin(_margin);
+            _mediumTree.createProxies(boxes, _mediumProxies);
+            _dirty = false;
+        }
+
+        void BoundingVolumeHierarchy::updateMediums(
+            const std::vector<std::unique_ptr<IMedium>> &mediums)
+        {
+            for (std::size_t i = 0; i < mediums.size(); ++i)
+            {
+                _mediumShapes[i]  = getBoundingShape(mediums[i]->getVolume());
+                _mediumCentres[i] = mediums[i]->getPosition().getValue();
+                // A medium that shrank keeps its old box until it leaves it
+                if (_mediumTree.moveProxy(_mediumProxies[i],
+                                          _mediumShapes[i].boundsAt(_mediumCentres[i])))
+                {
+                    ++_reinsertCount;
+                }
+            }
+        }
+
+        void BoundingVolumeHierarchy::queryOverlap(const Aabb &box, std::vector<Hit> &result) const
+        {
+            result.clear();
+            if (_store == nullptr)
+            {
+                return;
+            }
+            _entityTree.forEachOverlap(box, [&](std::int32_t proxyId) {
+                const std::size_t index = _entityTree.getUserData(proxyId);
+                if (_entityShapes[index].overlaps(entityCentre(index), box))
+                {
+                    result.push_back({Kind::Entity, index, 0.0});
+                }
+            });
+            _mediumTree.forEachOverlap(box, [&](std::int32_t proxyId) {
+                const std::size_t index = _mediumTree.getUserData(proxyId);
+                if (_mediumShapes[index].overlaps(_mediumCentres[index], box))
+                {
+                    result.push_back({Kind::Medium, index, 0.0});
+                }
+            });
+        }
+
+        void BoundingVolumeHierarchy::queryPoint(const std::array<double, 3> &point,
+                                                 std::vector<Hit> &result) const
+        {
+            result.clear();
+            if (_store == nullptr)
+            {
+                return;
+            }
+            _entityTree.forEachContaining(point, [&](std::int32_t proxyId) {
+                const std::size_t index = _entityTree.getUserData(proxyId);
+                if (_entityShapes[index].contains(entityCentre(index), point))
+                {
+                    result.push_back({Kind::Entity, index, 0.0});
+                }
+            });
+            _mediumTree.forEachContaining(point, [&](std::int32_t proxyId) {
+                const std::size_t index = _mediumTree.getUserData(proxyId);
+                if (_mediumShapes[index].contains(_mediumCentres[index], point))
+                {
+                    result.push_back({Kind::Medium, index, 0.0});
+                }
+            });
+        }
+
+        void BoundingVolumeHierarchy::queryRay(const std::array<double, 3> &origin,
+                                               const std::array<double, 3> &direction,
+                                               double maxDistance, std::vector<Hit> &result) const
+        {
+            result.clear();
+            const double length = std::sqrt(direction[0] * direction[0] +
+                                            direction[1] * direction[1] +
+                                            direction[2] * direction[2]);
+            if (_store == nullptr || !(length > 0.0) || !(maxDistance >= 0.0))
+            {
+                return;
+            }
+            const std::array<double, 3> unit = {direction[0] / length, direction[1] / length,
+                                                direction[2] / length};
+
+            double distance = 0.0;
+            _entityTree.forEachRayHit(origin, unit, maxDistance, [&](std::int32_t proxyId, double) {
+                const std::size_t index = _entityTree.getUserData(proxyId);
+                if (_entityShapes[index].intersectsRay(entityCentre(index), origin, unit,
+                                                       maxDistance, distance))
+                {
+                    result.push_back({Kind::Entity, index, distance});
+                }
+            });
+            _mediumTree.forEachRayHit(origin, unit, maxDistance, [&](std::int32_t proxyId, double) {
+                const std::size_t index = _mediumTree.getUserData(proxyId);
+                if (_mediumShapes[index].intersectsRay(_mediumCentres[index], origin, unit,
+                                                       maxDistance, distance))
+                {
+                    result.push_back({Kind::Medium, index, distance});
+                }
+            });
+            std::sort(result.begin(), result.end(), [](const Hit &a, const Hit &b) {
+                if (a.distance != b.distance)
+                {
+                    return a.distance < b.distance;
+                }
+                return (a.kind != b.kind) ? a.kind < b.kind : a.index < b.index;
+            });
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
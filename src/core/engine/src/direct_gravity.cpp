@@ -0,0 +1,89 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file direct_gravity.cpp
+ * @brief Definition of the DirectGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "direct_gravity.h"
+#include <cmath>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        void DirectGravity::apply(IWorld &world, [[maybe_unused]] double time)
+        {
+            EntityStore &store      = world.getEntityStore();
+            const std::size_t count = store.size();
+            _masses.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                _masses[i] = getMass(store.inverseMasses()[i]);
+            }
+
+            const double *x         = store.positions().x.data();
+            const double *y         = store.positions().y.data();
+            const double *z         = store.positions().z.data();
+            const double *masses    = _masses.data();
+            const double softening2 = _softening * _softening;
+            forEachChunk(
+                count,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        if (masses[i] == 0.0)
+                        {
+                            continue;
+                        }
+                        double ax = 0.0;
+                        double ay = 0.0;
+                        double az = 0.0;
+                        for (std::size_t j = 0; j < count; ++j)
+                        {
+                            const double dx = x[j] - x[i];
+                            const double dy = y[j] - y[i];
+                            const double dz = z[j] - z[i];
+                            const double r2 = dx * dx + dy * dy + dz * dz + softening2;
+                            // Skips the entity itself and coincident unsoftened pairs
+                            if (r2 == 0.0)
+                            {
+                                continue;
+                            }
+                            const double inverseR = 1.0 / std::sqrt(r2);
+                            const double weight   = masses[j] * inverseR * inverseR * inverseR;
+                            ax += weight * dx;
+                            ay += weight * dy;
+                            az += weight * dz;
+                        }
+                        const double scale = _gravitationalConstant * masses[i];
+                        store.forces().x[i] += scale * ax;
+                        store.forces().y[i] += scale * ay;
+                        store.forces().z[i] += scale * az;
+                    }
+                },
+                MIN_CHUNK_SIZE);
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,462 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file dynamic_aabb_tree.cpp
+ * @brief Definition of the DynamicAabbTree class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "dynamic_aabb_tree.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        namespace
+        {
+            /**
+             * @brief Number of centroid bins per split in rebuild().
+             */
+            constexpr std::size_t SAH_BINS = 16;
+        }  // namespace
+
+        DynamicAabbTree::DynamicAabbTree(double margin) :
+            _root(NULL_NODE), _freeList(NULL_NODE), _proxyCount(0), _margin(margin)
+        {
+        }
+
+        std::int32_t DynamicAabbTree::createProxy(const Aabb &box, std::uint32_t userData)
+        {
+            const std::int32_t proxyId = allocateNode();
+            _nodes[proxyId].box        = box.expanded(_margin);
+            _nodes[proxyId].userData   = userData;
+            _nodes[proxyId].height     = 0;
+            insertLeaf(proxyId);
+            ++_proxyCount;
+            return proxyId;
+        }
+
+        void DynamicAabbTree::createProxies(const std::vector<Aabb> &boxes,
+                                            std::vector<std::int32_t> &proxyIds)
+        {
+            // Leaves are linked by rebuild(), which also folds in the existing proxies
+            proxyIds.resize(boxes.size());
+            _nodes.reserve(_nodes.size() + 2 * boxes.size());
+            for (std::size_t i = 0; i < boxes.size(); ++i)
+            {
+                const std::int32_t proxyId = allocateNode();
+                _nodes[proxyId].box        = boxes[i].expanded(_margin);
+                _nodes[proxyId].userData   = static_cast<std::uint32_t>(i);
+                proxyIds[i]                = proxyId;
+            }
+            _proxyCount += boxes.size();
+            rebuild();
+        }
+
+        void DynamicAabbTree::destroyProxy(std::int32_t proxyId)
+        {
+            assert(_nodes[proxyId].isLeaf() && _nodes[proxyId].height == 0);
+            removeLeaf(proxyId);
+            freeNode(proxyId);
+            --_proxyCount;
+        }
+
+        bool DynamicAabbTree::moveProxy(std::int32_t proxyId, const Aabb &box)
+        {
+            if (_nodes[proxyId].box.contains(box))
+            {
+                return false;
+            }
+            removeLeaf(proxyId);
+            _nodes[proxyId].box = box.expanded(_margin);
+            insertLeaf(proxyId);
+            return true;
+        }
+
+        void DynamicAabbTree::clear()
+        {
+            _nodes.clear();
+            _root       = NULL_NODE;
+            _freeList   = NULL_NODE;
+            _proxyCount = 0;
+        }
+
+        std::int32_t DynamicAabbTree::allocateNode()
+        {
+            std::int32_t node;
+            if (_freeList == NULL_NODE)
+            {
+                node = static_cast<std::int32_t>(_nodes.size());
+                _nodes.emplace_back();
+            }
+            else
+            {
+                node      = _freeList;
+                _freeList = _nodes[node].parent;
+            }
+            _nodes[node].parent   = NULL_NODE;
+            _nodes[node].left     = NULL_NODE;
+            _nodes[node].right    = NULL_NODE;
+            _nodes[node].height   = 0;
+            _nodes[node].userData = 0;
+            return node;
+        }
+
+        void DynamicAabbTree::freeNode(std::int32_t node)
+        {
+            _nodes[node].parent = _freeList;
+            _nodes[node].height = -1;
+            _freeList           = node;
+        }
+
+        void DynamicAabbTree::insertLeaf(std::int32_t leaf)
+        {
+            if (_root == NULL_NODE)
+            {
+                _root               = leaf;
+                _nodes[leaf].parent = NULL_NODE;
+                return;
+            }
+
+            // Descend towards the sibling whose pairing with the leaf costs the least area
+            const Aabb leafBox = _nodes[leaf].box;
+            std::int32_t index = _root;
+            while (!_nodes[index].isLeaf())
+            {
+                const Node &node           = _nodes[index];
+                const double area          = node.box.surfaceArea();
+                const double combinedArea  = node.box.merged(leafBox).surfaceArea();
+                const double cost          = 2.0 * combinedArea;
+                const double inheritedCost = 2.0 * (combinedArea - area);
+
+                auto childCost = [&](std::int32_t child) {
+                    const Aabb &childBox = _nodes[child].box;
+                    const double merged  = childBox.merged(leafBox).surfaceArea();
+                    return inheritedCost +
+                           (_nodes[child].isLeaf() ? merged : merged - childBox.surfaceArea());
+                };
+                const double leftCost  = childCost(node.left);
+                const double rightCost = childCost(node.right);
+                if (cost < leftCost && cost < rightCost)
+                {
+                    break;
+                }
+                index = (leftCost < rightCost) ? node.left : node.right;
+            }
+
+            // Replace the sibling by a new parent of the sibling and the leaf
+            const std::int32_t sibling   = index;
+            const std::int32_t oldParent = _nodes[sibling].parent;
+            const std::int32_t newParent = allocateNode();
+            _nodes[newParent].parent     = oldParent;
+            _nodes[newParent].box        = leafBox.merged(_nodes[sibling].box);
+            _nodes[newParent].height     = _nodes[sibling].height + 1;
+            _nodes[newParent].left       = sibling;
+            _nodes[newParent].right      = leaf;
+            _nodes[sibling].parent       = newParent;
+            _nodes[leaf].parent          = newParent;
+            if (oldParent == NULL_NODE)
+            {
+                _root = newParent;
+            }
+            else if (_nodes[oldParent].left == sibling)
+            {
+                _nodes[oldParent].left = newParent;
+            }
+            else
+            {
+                _nodes[oldParent].right = newParent;
+            }
+
+            refitFrom(_nodes[leaf].parent);
+        }
+
+        void DynamicAabbTree::removeLeaf(std::int32_t leaf)
+        {
+            if (leaf == _root)
+            {
+                _root = NULL_NODE;
+                return;
+            }
+
+            // The sibling takes the place of the parent
+            const std::int32_t parent      = _nodes[leaf].parent;
+            const std::int32_t grandParent = _nodes[parent].parent;
+            const std::int32_t sibling =
+                (_nodes[parent].left == leaf) ? _nodes[parent].right : _nodes[parent].left;
+            _nodes[sibling].parent = grandParent;
+            freeNode(parent);
+            if (grandParent == NULL_NODE)
+            {
+                _root = sibling;
+                return;
+            }
+            if (_nodes[grandParent].left == parent)
+            {
+                _nodes[grandParent].left = sibling;
+            }
+            else
+            {
+                _nodes[grandParent].right = sibling;
+            }
+            refitFrom(grandParent);
+        }
+
+        void DynamicAabbTree::refitFrom(std::int32_t node)
+        {
+            while (node != NULL_NODE)
+            {
+                node                = balance(node);
+                const Node &left    = _nodes[_nodes[node].left];
+                const Node &right   = _nodes[_nodes[node].right];
+                _nodes[node].box    = left.box.merged(right.box);
+                _nodes[node].height = 1 + std::max(left.height, right.height);
+                node                = _nodes[node].parent;
+            }
+        }
+
+        std::int32_t DynamicAabbTree::balance(std::int32_t a)
+        {
+            if (_nodes[a].isLeaf() || _nodes[a].height < 2)
+            {
+                return a;
+            }
+            const std::int32_t b    = _nodes[a].left;
+            const std::int32_t c    = _nodes[a].right;
+            const std::int32_t skew = _nodes[c].height - _nodes[b].height;
+            if (skew >= -1 && skew <= 1)
+            {
+                return a;
+            }
+
+            // Rotate the taller child up: it takes the place of a, which keeps the shorter
+            // grandchild and hands the taller one to the rotated child
+            const bool rightTaller = skew > 1;
+            const std::int32_t up  = rightTaller ? c : b;
+            const std::int32_t f   = _nodes[up].left;
+            const std::int32_t g   = _nodes[up].right;
+
+            _nodes[up].parent = _nodes[a].parent;
+            _nodes[a].parent  = up;
+            if (_nodes[up].parent == NULL_NODE)
+            {
+                _root = up;
+            }
+            else if (_nodes[_nodes[up].parent].left == a)
+            {
+                _nodes[_nodes[up].parent].left = up;
+            }
+            else
+            {
+                _nodes[_nodes[up].parent].right = up;
+            }
+
+            const bool fTaller       = _nodes[f].height > _nodes[g].height;
+            const std::int32_t keep  = fTaller ? f : g;
+            const std::int32_t given = fTaller ? g : f;
+            _nodes[up].left          = a;
+            _nodes[up].right         = keep;
+            if (rightTaller)
+            {
+                _nodes[a].right = given;
+            }
+            else
+            {
+                _nodes[a].left = given;
+            }
+            _nodes[given].parent = a;
+
+            const Node &aLeft  = _nodes[_nodes[a].left];
+            const Node &aRight = _nodes[_nodes[a].right];
+            _nodes[a].box      = aLeft.box.merged(aRight.box);
+            _nodes[a].height   = 1 + std::max(aLeft.height, aRight.height);
+            _nodes[up].box     = _nodes[a].box.merged(_nodes[keep].box);
+            _nodes[up].height  = 1 + std::max(_nodes[a].height, _nodes[keep].height);
+            return up;
+        }
+
+        void DynamicAabbTree::rebuild()
+        {
+            std::vector<std::int32_t> leaves;
+            leaves.reserve(_proxyCount);
+            for (std::size_t node = 0; node < _nodes.size(); ++node)
+            {
+                if (_nodes[node].height < 0)
+                {
+                    continue;
+                }
+                if (_nodes[node].isLeaf())
+                {
+                    leaves.push_back(static_cast<std::int32_t>(node));
+                }
+                else
+                {
+                    freeNode(static_cast<std::int32_t>(node));
+                }
+            }
+            if (leaves.empty())
+            {
+                _root = NULL_NODE;
+                return;
+            }
+            _root                = build(leaves.data(), leaves.data() + leaves.size());
+            _nodes[_root].parent = NULL_NODE;
+        }
+
+        std::int32_t DynamicAabbTree::build(std::int32_t *first, std::int32_t *last)
+        {
+            const std::ptrdiff_t count = last - first;
+            if (count == 1)
+            {
+                return *first;
+            }
+
+            // Split along the widest axis of the leaf centres
+            Aabb centres = {_nodes[*first].box.centre(), _nodes[*first].box.centre()};
+            for (const std::int32_t *leaf = first; leaf != last; ++leaf)
+            {
+                const std::array<double, 3> centre = _nodes[*leaf].box.centre();
+                centres                            = centres.merged({centre, centre});
+            }
+            std::size_t axis = 0;
+            for (std::size_t a = 1; a < 3; ++a)
+            {
+                if (centres.max[a] - centres.min[a] > centres.max[axis] - centres.min[axis])
+                {
+                    axis = a;
+                }
+            }
+            const double low    = centres.min[axis];
+            const double extent = centres.max[axis] - low;
+
+            std::int32_t *middle = first + count / 2;
+            if (extent > 0.0)
+            {
+                // Bin the leaves by centre and pick the bin boundary of least SAH cost
+                const double scale = static_cast<double>(SAH_BINS) / extent;
+                auto binOf         = [&](std::int32_t leaf) {
+                    const double position = (_nodes[leaf].box.centre()[axis] - low) * scale;
+                    // Also sends NaN to the first bin
+                    if (!(position > 0.0))
+                    {
+                        return std::size_t{0};
+                    }
+                    return std::min(static_cast<std::size_t>(std::min(position, 1e9)),
+                                    SAH_BINS - 1);
+                };
+                std::array<Aabb, SAH_BINS> binBoxes;
+                std::array<std::size_t, SAH_BINS> binCounts = {};
+                for (const std::int32_t *leaf = first; leaf != last; ++leaf)
+                {
+                    const std::size_t bin = binOf(*leaf);
+                    binBoxes[bin] = binCounts[bin] ? binBoxes[bin].merged(_nodes[*leaf].box)
+                                                   : _nodes[*leaf].box;
+                    ++binCounts[bin];
+                }
+
+                std::array<double, SAH_BINS> leftCost = {};
+                Aabb box                              = {};
+                std::size_t seen                      = 0;
+                for (std::size_t bin = 0; bin + 1 < SAH_BINS; ++bin)
+                {
+                    if (binCounts[bin])
+                    {
+                        box = seen ? box.merged(binBoxes[bin]) : binBoxes[bin];
+                        seen += binCounts[bin];
+                    }
+                    leftCost[bin] = seen ? box.surfaceArea() * static_cast<double>(seen) : 0.0;
+                }
+                double bestCost       = std::numeric_limits<double>::infinity();
+                std::size_t bestSplit = SAH_BINS;
+                seen                  = 0;
+                for (std::size_t bin = SAH_BINS - 1; bin > 0; --bin)
+                {
+                    if (binCounts[bin])
+                    {
+                        box = seen ? box.merged(binBoxes[bin]) : binBoxes[bin];
+                        seen += binCounts[bin];
+                    }
+                    const std::size_t leftCount = static_cast<std::size_t>(count) - seen;
+                    if (seen == 0 || leftCount == 0)
+                    {
+                        continue;
+                    }
+                    const double cost =
+                        leftCost[bin - 1] + box.surfaceArea() * static_cast<double>(seen);
+                    if (cost < bestCost)
+                    {
+                        bestCost  = cost;
+                        bestSplit = bin;
+                    }
+                }
+                if (bestSplit < SAH_BINS)
+                {
+                    middle = std::partition(first, last, [&](std::int32_t leaf) {
+                        return binOf(leaf) < bestSplit;
+                    });
+                }
+            }
+            else
+            {
+                // Coincident centres: any even split will do
+                std::nth_element(first, middle, last);
+            }
+
+            const std::int32_t left  = build(first, middle);
+            const std::int32_t right = build(middle, last);
+            const std::int32_t node  = allocateNode();
+            _nodes[node].left        = left;
+            _nodes[node].right       = right;
+            _nodes[node].box         = _nodes[left].box.merged(_nodes[right].box);
+            _nodes[node].height      = 1 + std::max(_nodes[left].height, _nodes[right].height);
+            _nodes[left].parent      = node;
+            _nodes[right].parent     = node;
+            return node;
+        }
+
+        double DynamicAabbTree::getAreaRatio() const
+        {
+            if (_root == NULL_NODE)
+            {
+                return 0.0;
+            }
+            const double rootArea = _nodes[_root].box.surfaceArea();
+            if (rootArea <= 0.0)
+            {
+                return 0.0;
+            }
+            double innerArea = 0.0;
+            for (const Node &node : _nodes)
+            {
+                if (node.height > 0)
+                {
+                    innerArea += node.box.surfaceArea();
+                }
+            }
+            return innerArea / rootArea;
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -25,7 +25,12 @@
 
 #include "Engine.h"
 #include "empty_space.h"
+#include "log_macros.h"
 #include "logger.h"
+#include "quantity_format.h"
+#include "trace_macros.h"
+#include <stdexcept>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -33,16 +38,22 @@ namespace Core
 {
     namespace Engine
     {
-        Engine::Engine()
+        Engine::Engine() :
+            _stop(false), _paused(false), _running(false), _simulationTime(0.0), _stepCount(0),
+            _forcesValid(false), _forcesRevision(0)
         {
             // Initialize the default logger and world
             _logger = std::make_unique<Logger>();
             _world  = std::make_unique<EmptySpace>();
+            setWorkerCount(std::thread::hardware_concurrency());
         }
 
         Engine::Engine(std::unique_ptr<ILogger> logger, std::unique_ptr<IWorld> world) :
-            _logger(std::move(logger)), _world(std::move(world))
+            _logger(std::move(logger)), _world(std::move(world)), _stop(false), _paused(false),
+            _running(false), _simulationTime(0.0), _stepCount(0), _forcesValid(false),
+            _forcesRevision(0)
         {
+            setWorkerCount(std::thread::hardware_concurrency());
         }
 
         void Engine::setLogger(std::unique_ptr<ILogger> logger)
@@ -52,69 +63,281 @@ namespace Core
 
         void Engine::setWorld(std::unique_ptr<IWorld> world)
         {
-            _world = std::move(world);
+            _world       = std::move(world);
+            _forcesValid = false;
         }
 
         void Engine::run()
         {
-            _logger->log(LogLevel::Info, "Engine started running.");
-            _logger->log(LogLevel::Info, "Run Time: Inf, Time Step: 1 s.");
+            IFX_TRACE_ZONE("engine", "Engine::run");
+            IFX_LOG_INFO(_logger.get(), "Engine started running.");
+            IFX_LOG_INFO(_logger.get(), "Run Time: Inf, Time Step: 1 s.");
 
             unsigned int tInstant = 0;
             unsigned int tStep    = 1;  // 1 second time step
 
-            while (!_stop)
+            while (continueRunning())
             {
                 // Perform a time step in the simulation
                 timeStep(static_cast<double>(tStep));
                 tInstant += tStep;
             }
-            _logger->log(LogLevel::Info, "Engine stopped running.");
+            IFX_LOG_INFO(_logger.get(), "Engine stopped running.");
         }
 
         void Engine::run(Time runTime, Time timeStep)
         {
-            _logger->log(LogLevel::Info, "Engine started running.");
-            _logger->log(LogLevel::Info, "Run Time: %d %s, Time Step: %d %s.", runTime.getValue(),
-                         runTime.getUnitSymbol().c_str(), timeStep.getValue(),
-                         timeStep.getUnitSymbol().c_str());
+            IFX_TRACE_ZONE("engine", "Engine::run");
+            IFX_LOG_INFO(_logger.get(), "Engine started running.");
+            IFX_LOG_FORMAT_INFO(_logger.get(), "Run Time: {}, Time Step: {}.", runTime, timeStep);
 
             double tInstant = 0;
             double tStep    = timeStep.getValue();
 
-            while (!_stop && (tInstant <= runTime.getValue()))
+            // Take the steps ending within the run time; the tolerance absorbs the rounding of the
+            // accumulated instants, so 2 s in 0.1 s steps is 20 steps
+            const double tEnd = runTime.getValue() + 1e-9 * tStep;
+            while (continueRunning() && (tInstant + tStep <= tEnd))
             {
                 // Perform a time step in the simulation
-                this->timeStep(tInstant);
+                this->timeStep(tStep);
                 tInstant += tStep;
             }
-            _logger->log(LogLevel::Info, "Engine stopped running.");
+            IFX_LOG_INFO(_logger.get(), "Engine stopped running.");
         }
 
         void Engine::run(unsigned int runTime, unsigned int timeStep)
         {
-            _logger->log(LogLevel::Info, "Engine started running.");
-            _logger->log(LogLevel::Info, "Run Time: %d s, Time Step: %d s.", runTime, timeStep);
+            IFX_TRACE_ZONE("engine", "Engine::run");
+            IFX_LOG_INFO(_logger.get(), "Engine started running.");
+            IFX_LOG_INFO(_logger.get(), "Run Time: %u s, Time Step: %u s.", runTime, timeStep);
 
             unsigned int tInstant = 0;
-            unsigned int tStep    = 1;
+            unsigned int tStep    = timeStep;
 
-            while (!_stop && (tInstant <= runTime))
+            // Take the steps ending within the run time
+            while (continueRunning() && (tInstant + tStep <= runTime))
             {
                 // Perform a time step in the simulation
                 this->timeStep(static_cast<double>(tStep));
                 tInstant += tStep;
             }
-            _logger->log(LogLevel::Info, "Engine stopped running.");
+            IFX_LOG_INFO(_logger.get(), "Engine stopped running.");
+        }
+
+        RunHandle Engine::runAsync()
+        {
+            return launch([this] { run(); });
+        }
+
+        RunHandle Engine::runAsync(Time runTime, Time timeStep)
+        {
+            return launch([this, runTime, timeStep] { run(runTime, timeStep); });
+        }
+
+        RunHandle Engine::runAsync(unsigned int runTime, unsigned int timeStep)
+        {
+            return launch([this, runTime, timeStep] { run(runTime, timeStep); });
+        }
+
+        RunHandle Engine::launch(std::function<void()> loop)
+        {
+            if (_running.exchange(true))
+            {
+                throw std::logic_error("Engine is already running asynchronously.");
+            }
+
+            // Clear the flags here rather than on the new thread, so a stop() issued right after
+            // runAsync() returns is never lost
+            _stop     = false;
+            _paused   = false;
+            _runError = nullptr;
+
+            std::thread thread([this, loop = std::move(loop)] {
+                IFX_TRACE_THREAD_NAME("Engine");
+                try
+                {
+                    loop();
+                }
+                catch (...)
+                {
+                    _runError = std::current_exception();
+                }
+                _running = false;
+            });
+            return RunHandle(*this, std::move(thread));
         }
 
         void Engine::stop()
         {
-            _stop = true;
+            {
+                std::lock_guard<std::mutex> lock(_pauseMutex);
+                _stop = true;
+            }
+            _pauseChanged.notify_all();
+        }
+
+        void Engine::pause()
+        {
+            _paused = true;
+        }
+
+        void Engine::resume()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_pauseMutex);
+                _paused = false;
+            }
+            _pauseChanged.notify_all();
+        }
+
+        bool Engine::isPaused() const
+        {
+            return _paused;
+        }
+
+        bool Engine::isRunning() const
+        {
+            return _running;
+        }
+
+        std::uint64_t Engine::getStepCount() const
+        {
+            return _stepCount.load(std::memory_order_relaxed);
+        }
+
+        bool Engine::continueRunning()
+        {
+            if (_paused)
+            {
+                std::unique_lock<std::mutex> lock(_pauseMutex);
+                _pauseChanged.wait(lock, [this] { return !_paused || _stop; });
+            }
+            return !_stop;
+        }
+
+        void Engine::setIntegrator(IntegratorType type)
+        {
+            _integrator.setType(type);
+            _forcesValid = false;
+        }
+
+        IntegratorType Engine::getIntegrator() const
+        {
+            return _integrator.getType();
+        }
+
+        void Engine::setWorkerCount(std::size_t workerCount)
+        {
+            // Detach the old pool from the integrator and generators before it is destroyed
+            _integrator.setThreadPool(nullptr);
+            for (const std::unique_ptr<IForceGenerator> &generator : _forceGenerators)
+            {
+                generator->setThreadPool(nullptr);
+            }
+            _threadPool = std::make_unique<ThreadPool>(workerCount);
+            _integrator.setThreadPool(_threadPool.get());
+            for (const std::unique_ptr<IForceGenerator> &generator : _forceGenerators)
+            {
+                generator->setThreadPool(_threadPool.get());
+            }
+        }
+
+        std::size_t Engine::getWorkerCount() const
+        {
+            return _threadPool->getWorkerCount();
+        }
+
+        void Engine::addForceGenerator(std::unique_ptr<IForceGenerator> generator)
+        {
+            generator->setThreadPool(_threadPool.get());
+            _forceGenerators.push_back(std::move(generator));
+            _forcesValid = false;
+        }
+
+        void Engine::addPostStepHook(PostStepHook hook)
+        {
+            _postStepHooks.push_back(std::move(hook));
+        }
+
+        double Engine::getSimulationTime() const
+        {
+            return _simulationTime.load(std::memory_order_relaxed);
         }
 
         void Engine::timeStep(double timeStep)
         {
+            IFX_TRACE_ZONE("engine", "Engine::timeStep");
+            const double startTime = _simulationTime.load(std::memory_order_relaxed);
+            {
+                IFX_TRACE_ZONE("engine", "spatialIndex");
+                _world->updateSpatialIndices(_threadPool.get());
+            }
+            // Velocity Verlet ends each step with the forces of the new state; they are reused
+            // unless the store was changed since
+            EntityStore &store = _world->getEntityStore();
+            if (!_forcesValid || store.getRevision() != _forcesRevision)
+            {
+                evaluateForces(startTime);
+            }
+            {
+                IFX_TRACE_ZONE("engine", "integrate");
+                _integrator.integrate(store, startTime, timeStep,
+                                      [this](double time) { evaluateForces(time); });
+            }
+            _forcesValid    = _integrator.getType() == IntegratorType::VelocityVerlet;
+            _forcesRevision = store.getRevision();
+
+            // Publish the progress for lock-free readers on other threads
+            const double endTime = startTime + timeStep;
+            _simulationTime.store(endTime, std::memory_order_relaxed);
+            const std::uint64_t step = _stepCount.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (_logger)
+            {
+                _logger->setSimulationStamp(endTime, step);
+            }
+
+            {
+                IFX_TRACE_ZONE("engine", "syncEntities");
+                _world->syncEntities(_threadPool.get());
+            }
+
+            IFX_TRACE_ZONE("engine", "postStepHooks");
+            for (const PostStepHook &hook : _postStepHooks)
+            {
+                hook(*_world, endTime);
+            }
+        }
+
+        void Engine::evaluateForces(double time)
+        {
+            IFX_TRACE_ZONE("engine", "evaluateForces");
+            EntityStore &store          = _world->getEntityStore();
+            const std::size_t n         = store.size();
+            const double *inverseMasses = store.inverseMasses().data();
+            const auto gravity          = _world->getGravity().getValue();
+
+            // Clear the net forces and apply the world gravity in one pass. The gravity is a field
+            // strength (N/kg), so each entity feels m * g
+            _integrator.forEachChunk(n, [&](std::size_t begin, std::size_t end) {
+                IFX_TRACE_ZONE("engine", "gravity");
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *force = store.forces()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        force[i] = inverseMasses[i] > 0.0 ? gravity[axis] / inverseMasses[i] : 0.0;
+                    }
+                }
+            });
+
+            // Generators are user code and run one at a time, after the chunked pass has finished;
+            // they may run their own chunks on the pool
+            for (const std::unique_ptr<IForceGenerator> &generator : _forceGenerators)
+            {
+                IFX_TRACE_ZONE("engine", "forceGenerator");
+                generator->apply(*_world, time);
+            }
         }
 
     }  // namespace Engine
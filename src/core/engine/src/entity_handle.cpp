@@ -0,0 +1,177 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file entity_handle.cpp
+ * @brief Definition of the EntityHandle class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "entity_handle.h"
+#include <utility>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        EntityHandle::EntityHandle(EntityStore &store, std::size_t index,
+                                   std::unique_ptr<IEntity> entity) :
+            _store(&store), _index(index), _entity(std::move(entity))
+        {
+            sync();
+        }
+
+        void EntityHandle::sync()
+        {
+            _position.setValue(_store->positions().get(_index));
+            _velocity.setValue(_store->velocities().get(_index));
+            _acceleration.setValue(_store->accelerations().get(_index));
+            _force.setValue(_store->forces().get(_index));
+        }
+
+        std::unique_ptr<IEntity> EntityHandle::clone() const
+        {
+            std::unique_ptr<IEntity> copy = _entity->clone();
+            copy->setPosition(_store->positions().get(_index));
+            copy->setVelocity(_store->velocities().get(_index));
+            copy->setAcceleration(_store->accelerations().get(_index));
+            copy->setForce(_store->forces().get(_index));
+            if (isFixed())
+            {
+                copy->fixEntity();
+            }
+            return copy;
+        }
+
+        const Position &EntityHandle::getPosition() const
+        {
+            return _position;
+        }
+
+        void EntityHandle::setPosition(const Position &position)
+        {
+            _store->positions().set(_index, position.getValue());
+            _store->markModified();
+            _position.setValue(position.getValue());
+        }
+
+        void EntityHandle::setPosition(const std::array<double, 3> position)
+        {
+            _store->positions().set(_index, position);
+            _store->markModified();
+            _position.setValue(position);
+        }
+
+        const Velocity &EntityHandle::getVelocity() const
+        {
+            return _velocity;
+        }
+
+        void EntityHandle::setVelocity(const Velocity &velocity)
+        {
+            _store->velocities().set(_index, velocity.getValue());
+            _store->markModified();
+            _velocity.setValue(velocity.getValue());
+        }
+
+        void EntityHandle::setVelocity(const std::array<double, 3> velocity)
+        {
+            _store->velocities().set(_index, velocity);
+            _store->markModified();
+            _velocity.setValue(velocity);
+        }
+
+        const Acceleration &EntityHandle::getAcceleration() const
+        {
+            return _acceleration;
+        }
+
+        void EntityHandle::setAcceleration(const Acceleration &acceleration)
+        {
+            _store->accelerations().set(_index, acceleration.getValue());
+            _store->markModified();
+            _acceleration.setValue(acceleration.getValue());
+        }
+
+        void EntityHandle::setAcceleration(const std::array<double, 3> acceleration)
+        {
+            _store->accelerations().set(_index, acceleration);
+            _store->markModified();
+            _acceleration.setValue(acceleration);
+        }
+
+        const Force &EntityHandle::getForce() const
+        {
+            return _force;
+        }
+
+        void EntityHandle::setForce(const Force &force)
+        {
+            _store->forces().set(_index, force.getValue());
+            _store->markModified();
+            _force.setValue(force.getValue());
+        }
+
+        void EntityHandle::setForce(const std::array<double, 3> force)
+        {
+            _store->forces().set(_index, force);
+            _store->markModified();
+            _force.setValue(force);
+        }
+
+        void EntityHandle::addForce(const Force &force)
+        {
+            _store->forces().add(_index, force.getValue());
+            _store->markModified();
+            _force.setValue(_store->forces().get(_index));
+        }
+
+        void EntityHandle::addForce(const std::array<double, 3> force)
+        {
+            _store->forces().add(_index, force);
+            _store->markModified();
+            _force.setValue(_store->forces().get(_index));
+        }
+
+        const Mass &EntityHandle::getMass() const
+        {
+            return _entity->getMass();
+        }
+
+        const Volume &EntityHandle::getVolume() const
+        {
+            return _entity->getVolume();
+        }
+
+        bool EntityHandle::isFixed() const
+        {
+            return _store->fixed()[_index] != 0;
+        }
+
+        void EntityHandle::fixEntity()
+        {
+            _store->fixed()[_index] = 1;
+            _store->markModified();
+            _entity->fixEntity();
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
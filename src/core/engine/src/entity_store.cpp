@@ -0,0 +1,68 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file entity_store.cpp
+ * @brief Definition of the EntityStore class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "entity_store.h"
+#include "bounding_volume.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        EntityStore::EntityStore() : _revision(0)
+        {
+        }
+
+        std::size_t EntityStore::add(const IEntity &entity)
+        {
+            const std::size_t index = size();
+            const double mass       = entity.getMass().getValue();
+
+            _positions.push_back(entity.getPosition().getValue());
+            _velocities.push_back(entity.getVelocity().getValue());
+            _accelerations.push_back(entity.getAcceleration().getValue());
+            _forces.push_back(entity.getForce().getValue());
+            _inverseMasses.push_back(mass > 0.0 ? 1.0 / mass : 0.0);
+            _radii.push_back(getBoundingRadius(entity.getVolume()));
+            _fixed.push_back(entity.isFixed() ? 1 : 0);
+            markModified();
+
+            return index;
+        }
+
+        void EntityStore::reserve(std::size_t capacity)
+        {
+            _positions.reserve(capacity);
+            _velocities.reserve(capacity);
+            _accelerations.reserve(capacity);
+            _forces.reserve(capacity);
+            _inverseMasses.reserve(capacity);
+            _radii.reserve(capacity);
+            _fixed.reserve(capacity);
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,512 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file fmm_gravity.cpp
+ * @brief Definition of the FmmGravity class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "fmm_gravity.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        // Notation: for a cell of centre z, the multipole moments are M_a = sum_j m_j (x_j - z)^a
+        // over multi-indices a, and T_a(r) are the Taylor coefficients of 1/|r - y| in y, so
+        // that the potential sum_j m_j / |x - x_j| is sum_a M_a T_a(x - z) far from the cell.
+        // Near a cell of centre z, the potential is the local expansion sum_a L_a (x - z)^a.
+
+        FmmGravity::FmmGravity(std::size_t order, double theta) :
+            _order(0), _theta(theta), _leafCapacity(DEFAULT_LEAF_CAPACITY), _m2lCount(0)
+        {
+            setOrder(order);
+        }
+
+        void FmmGravity::setOrder(std::size_t order)
+        {
+            _order = std::clamp<std::size_t>(order, 1, MAX_ORDER);
+            buildTables();
+        }
+
+        void FmmGravity::apply(IWorld &world, [[maybe_unused]] double time)
+        {
+            EntityStore &store = world.getEntityStore();
+            _tree.build(store, _leafCapacity, _threadPool);
+            _m2lCount = 0;
+            if (_tree.getBodyCount() == 0)
+            {
+                return;
+            }
+
+            const std::size_t nodeCount = _tree.getNodes().size();
+            const std::size_t terms     = _terms.size();
+            _centres.resize(nodeCount);
+            _radii.resize(nodeCount);
+            _multipoles.resize(nodeCount * terms);
+            _locals.resize(nodeCount * terms);
+            _nearLists.resize(nodeCount);
+            auto makeScratch = [terms]() {
+                Scratch scratch;
+                scratch.monomials.resize(terms);
+                scratch.derivatives.resize(terms);
+                return scratch;
+            };
+
+            // Upward pass: P2M in the leaves, M2M towards the root, deepest level first
+            for (std::size_t level = _tree.getLevelCount(); level-- > 0;)
+            {
+                const std::span<const std::uint32_t> nodes = _tree.getLevel(level);
+                forEachChunk(
+                    nodes.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch = makeScratch();
+                        for (std::size_t k = begin; k < end; ++k)
+                        {
+                            upward(nodes[k], scratch);
+                        }
+                    },
+                    MIN_CHUNK_SIZE);
+            }
+
+            // Downward pass: L2L and M2L from the root, then L2P and P2P in the leaves
+            std::atomic<std::size_t> m2lCount{0};
+            for (std::size_t level = 0; level < _tree.getLevelCount(); ++level)
+            {
+                const std::span<const std::uint32_t> nodes = _tree.getLevel(level);
+                forEachChunk(
+                    nodes.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch   = makeScratch();
+                        std::size_t count = 0;
+                        for (std::size_t k = begin; k < end; ++k)
+                        {
+                            count += downward(nodes[k], store, scratch);
+                        }
+                        m2lCount += count;
+                    },
+                    MIN_CHUNK_SIZE);
+            }
+            _m2lCount = m2lCount;
+        }
+
+        void FmmGravity::buildTables()
+        {
+            const std::size_t p = _order;
+            _terms.clear();
+            for (std::uint32_t n = 0; n <= p; ++n)
+            {
+                for (std::uint32_t x = n + 1; x-- > 0;)
+                {
+                    for (std::uint32_t y = n - x + 1; y-- > 0;)
+                    {
+                        _terms.push_back({x, y, n - x - y});
+                    }
+                }
+            }
+            _termIndex.assign((p + 1) * (p + 1) * (p + 1), 0);
+            for (std::size_t term = 0; term < _terms.size(); ++term)
+            {
+                const std::array<std::uint32_t, 3> &a = _terms[term];
+                _termIndex[(a[0] * (p + 1) + a[1]) * (p + 1) + a[2]] =
+                    static_cast<std::uint32_t>(term);
+            }
+
+            std::vector<std::vector<double>> binomial(p + 1, std::vector<double>(p + 1, 0.0));
+            for (std::size_t n = 0; n <= p; ++n)
+            {
+                binomial[n][0] = 1.0;
+                for (std::size_t k = 1; k <= n; ++k)
+                {
+                    binomial[n][k] = binomial[n - 1][k - 1] + (k < n ? binomial[n - 1][k] : 0.0);
+                }
+            }
+
+            _recurrence.clear();
+            _shiftTerms.clear();
+            _conversions.clear();
+            _gradientTerms.clear();
+            for (std::size_t term = 0; term < _terms.size(); ++term)
+            {
+                const std::array<std::uint32_t, 3> &a = _terms[term];
+                const std::uint32_t degree            = a[0] + a[1] + a[2];
+
+                // Indices of a - e_i and a - 2 e_i, for the recurrence of T
+                std::array<std::int32_t, 6> lower = {-1, -1, -1, -1, -1, -1};
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    for (std::uint32_t step = 1; step <= 2 && step <= a[axis]; ++step)
+                    {
+                        std::array<std::uint32_t, 3> b = a;
+                        b[axis] -= step;
+                        lower[3 * (step - 1) + axis] =
+                            static_cast<std::int32_t>(getTermIndex(b[0], b[1], b[2]));
+                    }
+                }
+                _recurrence.push_back(lower);
+
+                // (d + s)^a = sum over b <= a of C(a, b) s^(a - b) d^b
+                for (std::uint32_t x = 0; x <= a[0]; ++x)
+                {
+                    for (std::uint32_t y = 0; y <= a[1]; ++y)
+                    {
+                        for (std::uint32_t z = 0; z <= a[2]; ++z)
+                        {
+                            _shiftTerms.push_back(
+                                {static_cast<std::uint32_t>(term),
+                                 static_cast<std::uint32_t>(getTermIndex(x, y, z)),
+                                 static_cast<std::uint32_t>(
+                                     getTermIndex(a[0] - x, a[1] - y, a[2] - z)),
+                                 binomial[a[0]][x] * binomial[a[1]][y] * binomial[a[2]][z]});
+                        }
+                    }
+                }
+
+                // L_b = (-1)^|b| sum over a of C(a + b, a) T_(a + b) M_a, truncated at order p
+                for (std::size_t other = 0; other < _terms.size(); ++other)
+                {
+                    const std::array<std::uint32_t, 3> &b = _terms[other];
+                    if (degree + b[0] + b[1] + b[2] > p)
+                    {
+                        break;
+                    }
+                    const double sign = (degree % 2 == 0) ? 1.0 : -1.0;
+                    _conversions.push_back(
+                        {static_cast<std::uint32_t>(term), static_cast<std::uint32_t>(other),
+                         static_cast<std::uint32_t>(
+                             getTermIndex(a[0] + b[0], a[1] + b[1], a[2] + b[2])),
+                         sign * binomial[a[0] + b[0]][b[0]] * binomial[a[1] + b[1]][b[1]] *
+                             binomial[a[2] + b[2]][b[2]]});
+                }
+
+                for (std::uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    if (a[axis] > 0)
+                    {
+                        std::array<std::uint32_t, 3> b = a;
+                        --b[axis];
+                        _gradientTerms.push_back(
+                            {static_cast<std::uint32_t>(term),
+                             static_cast<std::uint32_t>(getTermIndex(b[0], b[1], b[2])), axis,
+                             static_cast<double>(a[axis])});
+                    }
+                }
+            }
+        }
+
+        std::size_t FmmGravity::getTermIndex(std::size_t x, std::size_t y, std::size_t z) const
+        {
+            return _termIndex[(x * (_order + 1) + y) * (_order + 1) + z];
+        }
+
+        void FmmGravity::computeMonomials(const std::array<double, 3> &d, double *monomials) const
+        {
+            std::array<std::array<double, MAX_ORDER + 1>, 3> powers;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                powers[axis][0] = 1.0;
+                for (std::size_t n = 1; n <= _order; ++n)
+                {
+                    powers[axis][n] = powers[axis][n - 1] * d[axis];
+                }
+            }
+            for (std::size_t term = 0; term < _terms.size(); ++term)
+            {
+                const std::array<std::uint32_t, 3> &a = _terms[term];
+                monomials[term] = powers[0][a[0]] * powers[1][a[1]] * powers[2][a[2]];
+            }
+        }
+
+        void FmmGravity::computeDerivatives(const std::array<double, 3> &r,
+                                            double *derivatives) const
+        {
+            // |a| r^2 T_a = (2|a| - 1) sum_i r_i T_(a - e_i) - (|a| - 1) sum_i T_(a - 2 e_i)
+            const double r2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+            derivatives[0]  = 1.0 / std::sqrt(r2);
+            for (std::size_t term = 1; term < _terms.size(); ++term)
+            {
+                const std::array<std::uint32_t, 3> &a     = _terms[term];
+                const std::array<std::int32_t, 6> &lower = _recurrence[term];
+                const double degree = static_cast<double>(a[0] + a[1] + a[2]);
+                double first        = 0.0;
+                double second       = 0.0;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    if (lower[axis] >= 0)
+                    {
+                        first += r[axis] * derivatives[lower[axis]];
+                    }
+                    if (lower[3 + axis] >= 0)
+                    {
+                        second += derivatives[lower[3 + axis]];
+                    }
+                }
+                derivatives[term] =
+                    ((2.0 * degree - 1.0) * first - (degree - 1.0) * second) / (degree * r2);
+            }
+        }
+
+        void FmmGravity::upward(std::uint32_t node, Scratch &scratch)
+        {
+            const GravityOctree::Node &cell = _tree.getNodes()[node];
+            const std::size_t terms         = _terms.size();
+            double *multipole               = &_multipoles[node * terms];
+            std::array<double, 3> &centre   = _centres[node];
+            std::fill(multipole, multipole + terms, 0.0);
+
+            if (cell.isLeaf())
+            {
+                // P2M about the centre of mass
+                const std::vector<double> &masses = _tree.getMasses();
+                const std::vector<double> &xs     = _tree.getX();
+                const std::vector<double> &ys     = _tree.getY();
+                const std::vector<double> &zs     = _tree.getZ();
+                double mass                       = 0.0;
+                centre                            = {0.0, 0.0, 0.0};
+                for (std::uint32_t body = cell.first; body < cell.first + cell.count; ++body)
+                {
+                    mass += masses[body];
+                    centre[0] += masses[body] * xs[body];
+                    centre[1] += masses[body] * ys[body];
+                    centre[2] += masses[body] * zs[body];
+                }
+                double radius2 = 0.0;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    centre[axis] /= mass;
+                }
+                for (std::uint32_t body = cell.first; body < cell.first + cell.count; ++body)
+                {
+                    const std::array<double, 3> d = {xs[body] - centre[0], ys[body] - centre[1],
+                                                     zs[body] - centre[2]};
+                    radius2 = std::max(radius2, d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                    computeMonomials(d, scratch.monomials.data());
+                    for (std::size_t term = 0; term < terms; ++term)
+                    {
+                        multipole[term] += masses[body] * scratch.monomials[term];
+                    }
+                }
+                _radii[node] = std::sqrt(radius2);
+                return;
+            }
+
+            // M2M about the centre of mass of the children; M_0 is the mass
+            double mass = 0.0;
+            centre      = {0.0, 0.0, 0.0};
+            for (std::uint32_t child = cell.firstChild; child < cell.firstChild + cell.childCount;
+                 ++child)
+            {
+                const double childMass = _multipoles[child * terms];
+                mass += childMass;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    centre[axis] += childMass * _centres[child][axis];
+                }
+            }
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                centre[axis] /= mass;
+            }
+
+            double radius = 0.0;
+            for (std::uint32_t child = cell.firstChild; child < cell.firstChild + cell.childCount;
+                 ++child)
+            {
+                const std::array<double, 3> s = {_centres[child][0] - centre[0],
+                                                 _centres[child][1] - centre[1],
+                                                 _centres[child][2] - centre[2]};
+                radius = std::max(radius, std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]) +
+                                              _radii[child]);
+                computeMonomials(s, scratch.monomials.data());
+                const double *moments = &_multipoles[child * terms];
+                for (const ShiftTerm &shift : _shiftTerms)
+                {
+                    multipole[shift.to] +=
+                        shift.coefficient * scratch.monomials[shift.monomial] * moments[shift.from];
+                }
+            }
+
+            // The farthest corner of the cell bounds the radius too
+            double corner2 = 0.0;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const double reach = std::abs(centre[axis] - cell.centre[axis]) + cell.halfSize;
+                corner2 += reach * reach;
+            }
+            _radii[node] = std::min(radius, std::sqrt(corner2));
+        }
+
+        std::size_t FmmGravity::downward(std::uint32_t node, EntityStore &store, Scratch &scratch)
+        {
+            const std::vector<GravityOctree::Node> &nodes = _tree.getNodes();
+            const GravityOctree::Node &cell               = nodes[node];
+            const std::size_t terms                       = _terms.size();
+            double *local                                 = &_locals[node * terms];
+            std::fill(local, local + terms, 0.0);
+
+            // L2L from the parent, whose unresolved cells are the candidates here
+            scratch.stack.clear();
+            if (cell.parent == GravityOctree::NO_PARENT)
+            {
+                scratch.stack.push_back(node);
+            }
+            else
+            {
+                const std::array<double, 3> t = {_centres[node][0] - _centres[cell.parent][0],
+                                                 _centres[node][1] - _centres[cell.parent][1],
+                                                 _centres[node][2] - _centres[cell.parent][2]};
+                computeMonomials(t, scratch.monomials.data());
+                const double *parent = &_locals[cell.parent * terms];
+                for (const ShiftTerm &shift : _shiftTerms)
+                {
+                    local[shift.from] +=
+                        shift.coefficient * scratch.monomials[shift.monomial] * parent[shift.to];
+                }
+                const std::vector<std::uint32_t> &candidates = _nearLists[cell.parent];
+                scratch.stack.assign(candidates.begin(), candidates.end());
+            }
+
+            // Sort the candidates into separated cells, direct leaves and cells left to the
+            // children, opening the larger of two cells that are not separated
+            std::vector<std::uint32_t> &near = _nearLists[node];
+            near.clear();
+            scratch.separated.clear();
+            scratch.direct.clear();
+            while (!scratch.stack.empty())
+            {
+                const std::uint32_t other = scratch.stack.back();
+                scratch.stack.pop_back();
+                const GravityOctree::Node &source = nodes[other];
+                if (isSeparated(other, node))
+                {
+                    scratch.separated.push_back(other);
+                }
+                else if (source.isLeaf() && cell.isLeaf())
+                {
+                    scratch.direct.push_back(other);
+                }
+                else if (!source.isLeaf() && (cell.isLeaf() || _radii[other] > _radii[node]))
+                {
+                    for (std::uint32_t child = source.childCount; child-- > 0;)
+                    {
+                        scratch.stack.push_back(static_cast<std::uint32_t>(source.firstChild) +
+                                                child);
+                    }
+                }
+                else
+                {
+                    near.push_back(other);
+                }
+            }
+
+            // M2L
+            for (std::uint32_t other : scratch.separated)
+            {
+                const std::array<double, 3> r = {_centres[node][0] - _centres[other][0],
+                                                 _centres[node][1] - _centres[other][1],
+                                                 _centres[node][2] - _centres[other][2]};
+                computeDerivatives(r, scratch.derivatives.data());
+                const double *multipole = &_multipoles[other * terms];
+                for (const ConversionTerm &conversion : _conversions)
+                {
+                    local[conversion.local] += conversion.coefficient *
+                                               scratch.derivatives[conversion.sum] *
+                                               multipole[conversion.multipole];
+                }
+            }
+
+            if (cell.isLeaf())
+            {
+                evaluate(node, store, scratch);
+            }
+            return scratch.separated.size();
+        }
+
+        bool FmmGravity::isSeparated(std::uint32_t a, std::uint32_t b) const
+        {
+            const double dx = _centres[a][0] - _centres[b][0];
+            const double dy = _centres[a][1] - _centres[b][1];
+            const double dz = _centres[a][2] - _centres[b][2];
+            const double reach = _radii[a] + _radii[b];
+            return reach < _theta * std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+
+        void FmmGravity::evaluate(std::uint32_t leaf, EntityStore &store, Scratch &scratch) const
+        {
+            const std::vector<GravityOctree::Node> &nodes = _tree.getNodes();
+            const GravityOctree::Node &cell               = nodes[leaf];
+            const std::vector<double> &masses             = _tree.getMasses();
+            const std::vector<double> &xs                 = _tree.getX();
+            const std::vector<double> &ys                 = _tree.getY();
+            const std::vector<double> &zs                 = _tree.getZ();
+            const double *local                           = &_locals[leaf * _terms.size()];
+            const double softening2                       = _softening * _softening;
+            for (std::uint32_t body = cell.first; body < cell.first + cell.count; ++body)
+            {
+                // L2P: the field is the gradient of the local expansion
+                const std::array<double, 3> y = {xs[body] - _centres[leaf][0],
+                                                 ys[body] - _centres[leaf][1],
+                                                 zs[body] - _centres[leaf][2]};
+                computeMonomials(y, scratch.monomials.data());
+                std::array<double, 3> field = {0.0, 0.0, 0.0};
+                for (const GradientTerm &gradient : _gradientTerms)
+                {
+                    field[gradient.axis] += gradient.coefficient * local[gradient.local] *
+                                            scratch.monomials[gradient.monomial];
+                }
+
+                // P2P
+                for (std::uint32_t other : scratch.direct)
+                {
+                    const GravityOctree::Node &source = nodes[other];
+                    for (std::uint32_t j = source.first; j < source.first + source.count; ++j)
+                    {
+                        const double dx = xs[j] - xs[body];
+                        const double dy = ys[j] - ys[body];
+                        const double dz = zs[j] - zs[body];
+                        const double r2 = dx * dx + dy * dy + dz * dz + softening2;
+                        // Skips the body itself and coincident unsoftened pairs
+                        if (r2 == 0.0)
+                        {
+                            continue;
+                        }
+                        const double inverseR = 1.0 / std::sqrt(r2);
+                        const double weight   = masses[j] * inverseR * inverseR * inverseR;
+                        field[0] += weight * dx;
+                        field[1] += weight * dy;
+                        field[2] += weight * dz;
+                    }
+                }
+
+                const std::uint32_t index = _tree.getEntityIndex(body);
+                const double scale        = _gravitationalConstant * masses[body];
+                store.forces().x[index] += scale * field[0];
+                store.forces().y[index] += scale * field[1];
+                store.forces().z[index] += scale * field[2];
+            }
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
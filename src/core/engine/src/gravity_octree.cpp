@@ -0,0 +1,371 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file gravity_octree.cpp
+ * @brief Definition of the GravityOctree class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "gravity_octree.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        namespace
+        {
+            /**
+             * @brief Depth of the cells whose subtrees are built as parallel tasks.
+             */
+            constexpr std::uint32_t SUBTREE_LEVEL = 2;
+
+            /**
+             * @brief Minimum number of bodies per parallel chunk of the per-body passes.
+             */
+            constexpr std::size_t MIN_CHUNK_SIZE = 4096;
+
+            /**
+             * @brief Runs body over [0, count), chunked on the pool when there is one.
+             */
+            void forEachChunk(ThreadPool *threadPool, std::size_t count,
+                              const ThreadPool::RangeFunction &body, std::size_t minChunkSize)
+            {
+                if (threadPool == nullptr)
+                {
+                    body(0, count);
+                    return;
+                }
+                threadPool->parallelFor(count, body, minChunkSize);
+            }
+
+            /**
+             * @brief Spreads the low 21 bits of value three bits apart.
+             */
+            std::uint64_t spreadBits(std::uint64_t value)
+            {
+                value &= 0x1fffff;
+                value = (value | value << 32) & 0x1f00000000ffff;
+                value = (value | value << 16) & 0x1f0000ff0000ff;
+                value = (value | value << 8) & 0x100f00f00f00f00f;
+                value = (value | value << 4) & 0x10c30c30c30c30c3;
+                value = (value | value << 2) & 0x1249249249249249;
+                return value;
+            }
+        }  // namespace
+
+        GravityOctree::GravityOctree() : _leafCapacity(1), _origin{0.0, 0.0, 0.0}, _rootSize(1.0)
+        {
+        }
+
+        void GravityOctree::build(const EntityStore &store, std::size_t leafCapacity,
+                                  ThreadPool *threadPool)
+        {
+            _leafCapacity = std::max<std::size_t>(leafCapacity, 1);
+            sortBodies(store, threadPool);
+            buildNodes(threadPool);
+            listLevels();
+        }
+
+        void GravityOctree::sortBodies(const EntityStore &store, ThreadPool *threadPool)
+        {
+            const Vector3Array &positions = store.positions();
+            _keys.clear();
+            for (std::size_t i = 0; i < store.size(); ++i)
+            {
+                if (store.inverseMasses()[i] > 0.0 && std::isfinite(positions.x[i]) &&
+                    std::isfinite(positions.y[i]) && std::isfinite(positions.z[i]))
+                {
+                    _keys.push_back({0, static_cast<std::uint32_t>(i)});
+                }
+            }
+            const std::size_t count = _keys.size();
+
+            // Root cell: the bounding cube of the bodies
+            constexpr double INF       = std::numeric_limits<double>::infinity();
+            std::array<double, 3> low  = {INF, INF, INF};
+            std::array<double, 3> high = {-INF, -INF, -INF};
+            std::mutex boundsMutex;
+            forEachChunk(
+                threadPool, count,
+                [&](std::size_t begin, std::size_t end) {
+                    std::array<double, 3> chunkLow  = {INF, INF, INF};
+                    std::array<double, 3> chunkHigh = {-INF, -INF, -INF};
+                    for (std::size_t k = begin; k < end; ++k)
+                    {
+                        for (std::size_t axis = 0; axis < 3; ++axis)
+                        {
+                            const double value = positions[axis][_keys[k].index];
+                            chunkLow[axis]     = std::min(chunkLow[axis], value);
+                            chunkHigh[axis]    = std::max(chunkHigh[axis], value);
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(boundsMutex);
+                    for (std::size_t axis = 0; axis < 3; ++axis)
+                    {
+                        low[axis]  = std::min(low[axis], chunkLow[axis]);
+                        high[axis] = std::max(high[axis], chunkHigh[axis]);
+                    }
+                },
+                MIN_CHUNK_SIZE);
+            if (count == 0)
+            {
+                return;
+            }
+            const double extent =
+                std::max({high[0] - low[0], high[1] - low[1], high[2] - low[2]});
+            _origin   = low;
+            _rootSize = (extent > 0.0) ? extent * (1.0 + 1e-12) : 1.0;
+
+            // Morton codes, then sort; the index breaks ties so the order is unique
+            const double cells = static_cast<double>(1u << MAX_DEPTH);
+            forEachChunk(
+                threadPool, count,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t k = begin; k < end; ++k)
+                    {
+                        std::uint64_t code = 0;
+                        for (std::size_t axis = 0; axis < 3; ++axis)
+                        {
+                            const double cell = (positions[axis][_keys[k].index] - _origin[axis]) *
+                                                cells / _rootSize;
+                            const double clamped = std::clamp(cell, 0.0, cells - 1.0);
+                            code |= spreadBits(static_cast<std::uint64_t>(clamped)) << axis;
+                        }
+                        _keys[k].code = code;
+                    }
+                },
+                MIN_CHUNK_SIZE);
+
+            const std::size_t parts =
+                (threadPool == nullptr) ? 1 : std::min(threadPool->getWorkerCount(), count);
+            auto partBound = [&](std::size_t part) { return count * part / parts; };
+            forEachChunk(
+                threadPool, parts,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t part = begin; part < end; ++part)
+                    {
+                        std::sort(_keys.begin() + partBound(part),
+                                  _keys.begin() + partBound(part + 1));
+                    }
+                },
+                1);
+            for (std::size_t width = 1; width < parts; width *= 2)
+            {
+                const std::size_t merges = (parts + 2 * width - 1) / (2 * width);
+                forEachChunk(
+                    threadPool, merges,
+                    [&](std::size_t begin, std::size_t end) {
+                        for (std::size_t merge = begin; merge < end; ++merge)
+                        {
+                            const std::size_t first  = 2 * width * merge;
+                            const std::size_t middle = std::min(first + width, parts);
+                            const std::size_t last   = std::min(first + 2 * width, parts);
+                            std::inplace_merge(_keys.begin() + partBound(first),
+                                               _keys.begin() + partBound(middle),
+                                               _keys.begin() + partBound(last));
+                        }
+                    },
+                    1);
+            }
+
+            // Gather the bodies in curve order, for the tree walks
+            _x.resize(count);
+            _y.resize(count);
+            _z.resize(count);
+            _masses.resize(count);
+            forEachChunk(
+                threadPool, count,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t k = begin; k < end; ++k)
+                    {
+                        const std::uint32_t index = _keys[k].index;
+                        _x[k]                     = positions.x[index];
+                        _y[k]                     = positions.y[index];
+                        _z[k]                     = positions.z[index];
+                        _masses[k]                = 1.0 / store.inverseMasses()[index];
+                    }
+                },
+                MIN_CHUNK_SIZE);
+        }
+
+        void GravityOctree::buildNodes(ThreadPool *threadPool)
+        {
+            _nodes.clear();
+            if (_keys.empty())
+            {
+                return;
+            }
+            const double half = 0.5 * _rootSize;
+            Node root         = {};
+            root.centre       = {_origin[0] + half, _origin[1] + half, _origin[2] + half};
+            root.halfSize     = half;
+            root.count        = static_cast<std::uint32_t>(_keys.size());
+            root.firstChild   = -1;
+            root.parent       = NO_PARENT;
+            _nodes.push_back(root);
+
+            // The top levels serially, then one task per remaining subtree
+            std::vector<Subtree> subtrees;
+            buildNode(_nodes, 0, SUBTREE_LEVEL, &subtrees);
+            std::vector<std::vector<Node>> locals(subtrees.size());
+            forEachChunk(
+                threadPool, subtrees.size(),
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t task = begin; task < end; ++task)
+                    {
+                        std::vector<Node> &local = locals[task];
+                        local.assign(1, _nodes[subtrees[task].node]);
+                        buildNode(local, 0, MAX_DEPTH + 1, nullptr);
+                    }
+                },
+                1);
+
+            // Append each subtree below the top levels, its local root replacing the placeholder
+            std::vector<std::size_t> offsets(subtrees.size());
+            std::size_t total = _nodes.size();
+            for (std::size_t task = 0; task < subtrees.size(); ++task)
+            {
+                offsets[task] = total;
+                total += locals[task].size() - 1;
+            }
+            _nodes.resize(total);
+            forEachChunk(
+                threadPool, subtrees.size(),
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t task = begin; task < end; ++task)
+                    {
+                        const std::vector<Node> &local = locals[task];
+                        const std::uint32_t root       = subtrees[task].node;
+                        auto place = [&](std::size_t k) {
+                            return (k == 0) ? root
+                                            : static_cast<std::uint32_t>(offsets[task] + k - 1);
+                        };
+                        for (std::size_t k = 0; k < local.size(); ++k)
+                        {
+                            Node node = local[k];
+                            if (node.firstChild >= 0)
+                            {
+                                node.firstChild = static_cast<std::int32_t>(place(node.firstChild));
+                            }
+                            if (k > 0)
+                            {
+                                node.parent = place(node.parent);
+                            }
+                            _nodes[place(k)] = node;
+                        }
+                    }
+                },
+                1);
+        }
+
+        void GravityOctree::buildNode(std::vector<Node> &nodes, std::uint32_t node,
+                                      std::uint32_t splitLimit,
+                                      std::vector<Subtree> *subtrees) const
+        {
+            const std::uint32_t level = nodes[node].level;
+            if (nodes[node].count <= _leafCapacity || level == MAX_DEPTH)
+            {
+                return;
+            }
+            if (level == splitLimit)
+            {
+                subtrees->push_back({node, level});
+                return;
+            }
+
+            // The bodies of each octant are contiguous along the curve
+            const std::uint32_t shift    = 3 * (MAX_DEPTH - 1 - level);
+            const double childHalf       = 0.5 * nodes[node].halfSize;
+            const std::size_t firstChild = nodes.size();
+            const std::uint32_t end      = nodes[node].first + nodes[node].count;
+            std::uint32_t begin          = nodes[node].first;
+            for (std::uint32_t octant = 0; octant < 8 && begin < end; ++octant)
+            {
+                const auto split = std::partition_point(
+                    _keys.begin() + begin, _keys.begin() + end,
+                    [&](const Key &key) { return ((key.code >> shift) & 7) <= octant; });
+                const std::uint32_t stop = static_cast<std::uint32_t>(split - _keys.begin());
+                if (stop == begin)
+                {
+                    continue;
+                }
+                Node child = {};
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    const double sign  = ((octant >> axis) & 1) ? 1.0 : -1.0;
+                    child.centre[axis] = nodes[node].centre[axis] + sign * childHalf;
+                }
+                child.halfSize   = childHalf;
+                child.first      = begin;
+                child.count      = stop - begin;
+                child.firstChild = -1;
+                child.parent     = node;
+                child.level      = level + 1;
+                nodes.push_back(child);
+                begin = stop;
+            }
+            nodes[node].firstChild = static_cast<std::int32_t>(firstChild);
+            nodes[node].childCount = static_cast<std::uint32_t>(nodes.size() - firstChild);
+
+            for (std::size_t child = firstChild; child < firstChild + nodes[node].childCount;
+                 ++child)
+            {
+                buildNode(nodes, static_cast<std::uint32_t>(child), splitLimit, subtrees);
+            }
+        }
+
+        void GravityOctree::listLevels()
+        {
+            // Counting sort of the cells by level, keeping the node order within each level
+            _levelStarts.clear();
+            _levelOrder.resize(_nodes.size());
+            if (_nodes.empty())
+            {
+                return;
+            }
+            std::uint32_t depth = 0;
+            for (const Node &node : _nodes)
+            {
+                depth = std::max(depth, node.level);
+            }
+            _levelStarts.assign(depth + 2, 0);
+            for (const Node &node : _nodes)
+            {
+                ++_levelStarts[node.level + 1];
+            }
+            for (std::size_t level = 1; level < _levelStarts.size(); ++level)
+            {
+                _levelStarts[level] += _levelStarts[level - 1];
+            }
+            std::vector<std::size_t> next(_levelStarts.begin(), _levelStarts.end() - 1);
+            for (std::size_t node = 0; node < _nodes.size(); ++node)
+            {
+                _levelOrder[next[_nodes[node].level]++] = static_cast<std::uint32_t>(node);
+            }
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
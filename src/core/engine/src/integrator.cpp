@@ -0,0 +1,264 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file integrator.cpp
+ * @brief Definition of the Integrator class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "integrator.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        Integrator::Integrator(IntegratorType type) : _type(type), _threadPool(nullptr)
+        {
+        }
+
+        void Integrator::integrate(EntityStore &store, double time, double timeStep,
+                                   const ForceEvaluator &evaluateForces)
+        {
+            computeAccelerations(store);
+
+            switch (_type)
+            {
+                case IntegratorType::ExplicitEuler:
+                    explicitEuler(store, timeStep);
+                    break;
+                case IntegratorType::SemiImplicitEuler:
+                    semiImplicitEuler(store, timeStep);
+                    break;
+                case IntegratorType::VelocityVerlet:
+                    velocityVerlet(store, time, timeStep, evaluateForces);
+                    break;
+                case IntegratorType::RungeKutta4:
+                    rungeKutta4(store, time, timeStep, evaluateForces);
+                    break;
+            }
+        }
+
+        void Integrator::computeAccelerations(EntityStore &store)
+        {
+            const double *inverseMasses = store.inverseMasses().data();
+            const std::uint8_t *fixed   = store.fixed().data();
+
+            forEachChunk(store.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    const double *force  = store.forces()[axis].data();
+                    double *acceleration = store.accelerations()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        acceleration[i] = fixed[i] ? 0.0 : force[i] * inverseMasses[i];
+                    }
+                }
+            });
+        }
+
+        void Integrator::forEachChunk(std::size_t count, const ThreadPool::RangeFunction &body)
+        {
+            if (_threadPool == nullptr)
+            {
+                body(0, count);
+                return;
+            }
+            _threadPool->parallelFor(count, body, MIN_CHUNK_SIZE);
+        }
+
+        void Integrator::explicitEuler(EntityStore &store, double timeStep)
+        {
+            const std::uint8_t *fixed = store.fixed().data();
+
+            forEachChunk(store.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *position           = store.positions()[axis].data();
+                    double *velocity           = store.velocities()[axis].data();
+                    const double *acceleration = store.accelerations()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        const double dt = fixed[i] ? 0.0 : timeStep;
+                        position[i] += velocity[i] * dt;
+                        velocity[i] += acceleration[i] * dt;
+                    }
+                }
+            });
+        }
+
+        void Integrator::semiImplicitEuler(EntityStore &store, double timeStep)
+        {
+            const std::uint8_t *fixed = store.fixed().data();
+
+            forEachChunk(store.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *position           = store.positions()[axis].data();
+                    double *velocity           = store.velocities()[axis].data();
+                    const double *acceleration = store.accelerations()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        const double dt = fixed[i] ? 0.0 : timeStep;
+                        velocity[i] += acceleration[i] * dt;
+                        position[i] += velocity[i] * dt;
+                    }
+                }
+            });
+        }
+
+        void Integrator::velocityVerlet(EntityStore &store, double time, double timeStep,
+                                        const ForceEvaluator &evaluateForces)
+        {
+            const std::uint8_t *fixed = store.fixed().data();
+
+            // Half kick with the old acceleration, then drift
+            forEachChunk(store.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *position           = store.positions()[axis].data();
+                    double *velocity           = store.velocities()[axis].data();
+                    const double *acceleration = store.accelerations()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        const double dt = fixed[i] ? 0.0 : timeStep;
+                        velocity[i] += 0.5 * acceleration[i] * dt;
+                        position[i] += velocity[i] * dt;
+                    }
+                }
+            });
+
+            // Half kick with the acceleration at the new positions
+            evaluateForces(time + timeStep);
+            computeAccelerations(store);
+            forEachChunk(store.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *velocity           = store.velocities()[axis].data();
+                    const double *acceleration = store.accelerations()[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        const double dt = fixed[i] ? 0.0 : timeStep;
+                        velocity[i] += 0.5 * acceleration[i] * dt;
+                    }
+                }
+            });
+        }
+
+        void Integrator::rungeKutta4(EntityStore &store, double time, double timeStep,
+                                     const ForceEvaluator &evaluateForces)
+        {
+            const std::size_t n       = store.size();
+            const std::uint8_t *fixed = store.fixed().data();
+
+            _startPositions.resize(n);
+            _startVelocities.resize(n);
+            _positionSlopes.resize(n);
+            _velocitySlopes.resize(n);
+
+            // Stage 1 slopes come from the state at the start of the step
+            forEachChunk(n, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    const double *position     = store.positions()[axis].data();
+                    const double *velocity     = store.velocities()[axis].data();
+                    const double *acceleration = store.accelerations()[axis].data();
+                    double *startPosition      = _startPositions[axis].data();
+                    double *startVelocity      = _startVelocities[axis].data();
+                    double *positionSlope      = _positionSlopes[axis].data();
+                    double *velocitySlope      = _velocitySlopes[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        startPosition[i] = position[i];
+                        startVelocity[i] = velocity[i];
+                        positionSlope[i] = velocity[i];
+                        velocitySlope[i] = acceleration[i];
+                    }
+                }
+            });
+
+            // Stages 2 to 4: move to the trial state built from the previous stage slopes,
+            // evaluate there and accumulate the weighted slopes
+            constexpr double stageFraction[3] = {0.5, 0.5, 1.0};
+            constexpr double stageWeight[3]   = {2.0, 2.0, 1.0};
+            for (std::size_t stage = 0; stage < 3; ++stage)
+            {
+                const double h = stageFraction[stage] * timeStep;
+                forEachChunk(n, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t axis = 0; axis < 3; ++axis)
+                    {
+                        double *position            = store.positions()[axis].data();
+                        double *velocity            = store.velocities()[axis].data();
+                        const double *acceleration  = store.accelerations()[axis].data();
+                        const double *startPosition = _startPositions[axis].data();
+                        const double *startVelocity = _startVelocities[axis].data();
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            // The previous stage slope is the current velocity and acceleration
+                            const double dt = fixed[i] ? 0.0 : h;
+                            position[i]     = startPosition[i] + velocity[i] * dt;
+                            velocity[i]     = startVelocity[i] + acceleration[i] * dt;
+                        }
+                    }
+                });
+
+                evaluateForces(time + h);
+                computeAccelerations(store);
+
+                const double weight = stageWeight[stage];
+                forEachChunk(n, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t axis = 0; axis < 3; ++axis)
+                    {
+                        const double *velocity     = store.velocities()[axis].data();
+                        const double *acceleration = store.accelerations()[axis].data();
+                        double *positionSlope      = _positionSlopes[axis].data();
+                        double *velocitySlope      = _velocitySlopes[axis].data();
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            positionSlope[i] += weight * velocity[i];
+                            velocitySlope[i] += weight * acceleration[i];
+                        }
+                    }
+                });
+            }
+
+            // Combine: y1 = y0 + dt / 6 * (k1 + 2 k2 + 2 k3 + k4)
+            forEachChunk(n, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    double *position            = store.positions()[axis].data();
+                    double *velocity            = store.velocities()[axis].data();
+                    const double *startPosition = _startPositions[axis].data();
+                    const double *startVelocity = _startVelocities[axis].data();
+                    const double *positionSlope = _positionSlopes[axis].data();
+                    const double *velocitySlope = _velocitySlopes[axis].data();
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        const double dt = fixed[i] ? 0.0 : timeStep / 6.0;
+                        position[i]     = startPosition[i] + positionSlope[i] * dt;
+                        velocity[i]     = startVelocity[i] + velocitySlope[i] * dt;
+                    }
+                }
+            });
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
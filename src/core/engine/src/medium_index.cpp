@@ -0,0 +1,211 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file medium_index.cpp
+ * @brief Definition of the MediumIndex class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "medium_index.h"
+#include <algorithm>
+#include <atomic>
+#include <numbers>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        namespace
+        {
+            double getShapeVolume(const BoundingShape &shape)
+            {
+                const auto &[x, y, z] = shape.halfExtents;
+                if (shape.type == Volume::Type::Sphere)
+                {
+                    return (4.0 / 3.0) * std::numbers::pi * x * x * x;
+                }
+                return 8.0 * x * y * z;
+            }
+        }  // namespace
+
+        MediumIndex::MediumIndex() :
+            _enabled(false), _dirty(true), _lastLookupCount(0), _mediums(nullptr), _tree(0.0)
+        {
+        }
+
+        void MediumIndex::setEnabled(bool enabled)
+        {
+            _enabled = enabled;
+            _dirty   = true;
+        }
+
+        void MediumIndex::invalidate()
+        {
+            _dirty = true;
+        }
+
+        void MediumIndex::updateMediums(const std::vector<std::unique_ptr<IMedium>> &mediums)
+        {
+            const std::size_t count = mediums.size();
+            bool changed            = false;
+            if (_dirty || _mediums != &mediums || _proxies.size() != count)
+            {
+                _mediums = &mediums;
+                _shapes.resize(count);
+                _centres.resize(count);
+                _volumes.resize(count);
+                std::vector<Aabb> boxes(count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    _shapes[i]  = getBoundingShape(mediums[i]->getVolume());
+                    _centres[i] = mediums[i]->getPosition().getValue();
+                    _volumes[i] = getShapeVolume(_shapes[i]);
+                    boxes[i]    = _shapes[i].boundsAt(_centres[i]);
+                }
+                _tree.clear();
+                _tree.createProxies(boxes, _proxies);
+
+                // Medium indices may have changed meaning
+                _entityMediums.assign(_entityMediums.size(), NO_MEDIUM);
+                _dirty  = false;
+                changed = true;
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const BoundingShape shape          = getBoundingShape(mediums[i]->getVolume());
+                    const std::array<double, 3> centre = mediums[i]->getPosition().getValue();
+                    if (shape.type == _shapes[i].type &&
+                        shape.halfExtents == _shapes[i].halfExtents && centre == _centres[i])
+                    {
+                        continue;
+                    }
+                    _shapes[i]  = shape;
+                    _centres[i] = centre;
+                    _volumes[i] = getShapeVolume(shape);
+                    _tree.moveProxy(_proxies[i], shape.boundsAt(centre));
+                    changed = true;
+                }
+            }
+            if (!changed)
+            {
+                return;
+            }
+
+            // Entities in a medium no other one overlaps can keep it while they stay inside
+            _overlapped.assign(count, 0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Aabb box = _shapes[i].boundsAt(_centres[i]);
+                _tree.forEachOverlap(box, [&](std::int32_t proxyId) {
+                    if (_tree.getUserData(proxyId) != i)
+                    {
+                        _overlapped[i] = 1;
+                    }
+                });
+            }
+        }
+
+        void MediumIndex::update(const std::vector<std::unique_ptr<IMedium>> &mediums,
+                                 const EntityStore &store, ThreadPool *threadPool)
+        {
+            if (!_enabled)
+            {
+                return;
+            }
+            updateMediums(mediums);
+
+            const std::size_t count = store.size();
+            _entityMediums.resize(count, NO_MEDIUM);
+            _lastLookupCount = 0;
+            if (_shapes.empty())
+            {
+                std::fill(_entityMediums.begin(), _entityMediums.end(), NO_MEDIUM);
+                return;
+            }
+
+            const Vector3Array &positions = store.positions();
+            std::atomic<std::size_t> lookups(0);
+            auto locate = [&](std::size_t begin, std::size_t end) {
+                std::size_t chunkLookups = 0;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::array<double, 3> point = {positions.x[i], positions.y[i],
+                                                         positions.z[i]};
+                    const std::uint32_t cached        = _entityMediums[i];
+                    if (cached != NO_MEDIUM && !_overlapped[cached] && contains(cached, point))
+                    {
+                        continue;
+                    }
+                    _entityMediums[i] = findMedium(point);
+                    ++chunkLookups;
+                }
+                lookups.fetch_add(chunkLookups, std::memory_order_relaxed);
+            };
+            if (threadPool == nullptr)
+            {
+                locate(0, count);
+            }
+            else
+            {
+                threadPool->parallelFor(count, locate, MIN_CHUNK_SIZE);
+            }
+            _lastLookupCount = lookups.load(std::memory_order_relaxed);
+        }
+
+        const IMedium *MediumIndex::getEntityMedium(std::size_t entityIndex) const
+        {
+            const std::uint32_t index = getEntityMediumIndex(entityIndex);
+            return (index == NO_MEDIUM) ? nullptr : (*_mediums)[index].get();
+        }
+
+        std::uint32_t MediumIndex::findMedium(const std::array<double, 3> &point) const
+        {
+            std::uint32_t best = NO_MEDIUM;
+            _tree.forEachContaining(point, [&](std::int32_t proxyId) {
+                const std::uint32_t index = _tree.getUserData(proxyId);
+                if (contains(index, point) && (best == NO_MEDIUM || isInner(index, best)))
+                {
+                    best = index;
+                }
+            });
+            return best;
+        }
+
+        void MediumIndex::findMediums(const std::array<double, 3> &point,
+                                      std::vector<std::uint32_t> &result) const
+        {
+            result.clear();
+            _tree.forEachContaining(point, [&](std::int32_t proxyId) {
+                const std::uint32_t index = _tree.getUserData(proxyId);
+                if (contains(index, point))
+                {
+                    result.push_back(index);
+                }
+            });
+            std::sort(result.begin(), result.end(),
+                      [this](std::uint32_t a, std::uint32_t b) { return isInner(a, b); });
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
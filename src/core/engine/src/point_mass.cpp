@@ -24,6 +24,7 @@
  */
 
 #include "point_mass.h"
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -68,6 +69,16 @@ namespace Core
             PointMass::nInstances++;
         }
 
+        PointMass::PointMass(const PointMass &other) : Entity(other)
+        {
+            PointMass::nInstances++;
+        }
+
+        PointMass::PointMass(PointMass &&other) noexcept : Entity(std::move(other))
+        {
+            PointMass::nInstances++;
+        }
+
         PointMass::~PointMass()
         {
             PointMass::nInstances--;
@@ -0,0 +1,141 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file run_handle.cpp
+ * @brief Definition of the RunHandle class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "run_handle.h"
+#include "Engine.h"
+#include <exception>
+#include <utility>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        RunHandle::RunHandle() noexcept : _engine(nullptr)
+        {
+        }
+
+        RunHandle::RunHandle(Engine &engine, std::thread thread) :
+            _engine(&engine), _thread(std::move(thread))
+        {
+        }
+
+        RunHandle::~RunHandle()
+        {
+            // Never leave a running thread behind; errors are dropped as a destructor can't throw
+            if (_thread.joinable())
+            {
+                _engine->stop();
+                _thread.join();
+            }
+        }
+
+        RunHandle::RunHandle(RunHandle &&other) noexcept :
+            _engine(std::exchange(other._engine, nullptr)), _thread(std::move(other._thread))
+        {
+        }
+
+        RunHandle &RunHandle::operator=(RunHandle &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (_thread.joinable())
+                {
+                    _engine->stop();
+                    _thread.join();
+                }
+                _engine = std::exchange(other._engine, nullptr);
+                _thread = std::move(other._thread);
+            }
+            return *this;
+        }
+
+        void RunHandle::stop()
+        {
+            if (_engine != nullptr)
+            {
+                _engine->stop();
+            }
+        }
+
+        void RunHandle::pause()
+        {
+            if (_engine != nullptr)
+            {
+                _engine->pause();
+            }
+        }
+
+        void RunHandle::resume()
+        {
+            if (_engine != nullptr)
+            {
+                _engine->resume();
+            }
+        }
+
+        void RunHandle::join()
+        {
+            if (!_thread.joinable())
+            {
+                return;
+            }
+            _thread.join();
+
+            std::exception_ptr error = std::exchange(_engine->_runError, nullptr);
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        bool RunHandle::joinable() const
+        {
+            return _thread.joinable();
+        }
+
+        bool RunHandle::isRunning() const
+        {
+            return _engine != nullptr && _engine->isRunning();
+        }
+
+        bool RunHandle::isPaused() const
+        {
+            return _engine != nullptr && _engine->isPaused();
+        }
+
+        std::uint64_t RunHandle::getStepCount() const
+        {
+            return _engine != nullptr ? _engine->getStepCount() : 0;
+        }
+
+        double RunHandle::getSimulationTime() const
+        {
+            return _engine != nullptr ? _engine->getSimulationTime() : 0.0;
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
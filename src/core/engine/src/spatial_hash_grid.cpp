@@ -0,0 +1,343 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spatial_hash_grid.cpp
+ * @brief Definition of the SpatialHashGrid class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "spatial_hash_grid.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        namespace
+        {
+            void forEachChunk(ThreadPool *threadPool, std::size_t count,
+                              const ThreadPool::RangeFunction &body)
+            {
+                if (threadPool == nullptr)
+                {
+                    body(0, count);
+                    return;
+                }
+                threadPool->parallelFor(count, body, SpatialHashGrid::MIN_CHUNK_SIZE);
+            }
+        }  // namespace
+
+        SpatialHashGrid::SpatialHashGrid(double cellSize) :
+            _enabled(false), _dirty(true), _requestedCellSize(cellSize), _cellSize(1.0),
+            _inverseCellSize(1.0), _bucketMask(0), _layoutCount(0), _store(nullptr),
+            _minCell{0, 0, 0}, _maxCell{0, 0, 0}
+        {
+        }
+
+        void SpatialHashGrid::setEnabled(bool enabled)
+        {
+            _enabled = enabled;
+            _dirty   = true;
+        }
+
+        void SpatialHashGrid::setCellSize(double cellSize)
+        {
+            _requestedCellSize = cellSize;
+            _dirty             = true;
+        }
+
+        void SpatialHashGrid::invalidate()
+        {
+            _dirty = true;
+        }
+
+        bool SpatialHashGrid::update(const EntityStore &store, ThreadPool *threadPool)
+        {
+            if (!_enabled)
+            {
+                return false;
+            }
+            if (_dirty || _store != &store || _cells.size() != store.size())
+            {
+                rebuild(store, threadPool);
+                return true;
+            }
+            if (!computeCells(store, threadPool))
+            {
+                return false;
+            }
+            layout(threadPool);
+            return true;
+        }
+
+        void SpatialHashGrid::rebuild(const EntityStore &store, ThreadPool *threadPool)
+        {
+            _cellSize        = (_requestedCellSize > 0.0) ? _requestedCellSize
+                                                          : chooseCellSize(store);
+            _inverseCellSize = 1.0 / _cellSize;
+            _store           = &store;
+            _cells.resize(store.size());
+            computeCells(store, threadPool);
+            layout(threadPool);
+            _dirty = false;
+        }
+
+        std::int32_t SpatialHashGrid::toCell(double coordinate) const
+        {
+            const double cell = std::floor(coordinate * _inverseCellSize);
+            // NaN compares false both ways and ends up in cell 0
+            if (cell >= CELL_LIMIT)
+            {
+                return CELL_LIMIT;
+            }
+            if (cell <= -CELL_LIMIT)
+            {
+                return -CELL_LIMIT;
+            }
+            return (cell == cell) ? static_cast<std::int32_t>(cell) : 0;
+        }
+
+        double SpatialHashGrid::chooseCellSize(const EntityStore &store) const
+        {
+            const std::size_t count = store.size();
+            if (count == 0)
+            {
+                return 1.0;
+            }
+
+            // Twice the largest radius keeps any two touching entities in neighbouring cells
+            const auto &radii      = store.radii();
+            const double maxRadius = *std::max_element(radii.begin(), radii.end());
+            if (std::isfinite(maxRadius) && maxRadius > 0.0)
+            {
+                return 2.0 * maxRadius;
+            }
+
+            // Point-like entities: about one per cell over their bounding box
+            const Vector3Array &positions = store.positions();
+            double volume                 = 1.0;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const auto [low, high] =
+                    std::minmax_element(positions[axis].begin(), positions[axis].end());
+                volume *= std::max(*high - *low, std::numeric_limits<double>::min());
+            }
+            const double cellSize = std::cbrt(volume / static_cast<double>(count));
+            return (std::isfinite(cellSize) && cellSize > 1e-12) ? cellSize : 1.0;
+        }
+
+        bool SpatialHashGrid::computeCells(const EntityStore &store, ThreadPool *threadPool)
+        {
+            const double *x = store.positions().x.data();
+            const double *y = store.positions().y.data();
+            const double *z = store.positions().z.data();
+
+            constexpr std::int32_t MAX = std::numeric_limits<std::int32_t>::max();
+            constexpr std::int32_t MIN = std::numeric_limits<std::int32_t>::min();
+            std::atomic<bool> changed(false);
+            std::mutex boundsMutex;
+            _minCell = {MAX, MAX, MAX};
+            _maxCell = {MIN, MIN, MIN};
+
+            forEachChunk(threadPool, _cells.size(), [&](std::size_t begin, std::size_t end) {
+                bool chunkChanged = false;
+                Cell low          = {MAX, MAX, MAX};
+                Cell high         = {MIN, MIN, MIN};
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const Cell cell = {toCell(x[i]), toCell(y[i]), toCell(z[i])};
+                    chunkChanged    = chunkChanged || !(cell == _cells[i]);
+                    _cells[i]       = cell;
+                    low             = {std::min(low.x, cell.x), std::min(low.y, cell.y),
+                                       std::min(low.z, cell.z)};
+                    high            = {std::max(high.x, cell.x), std::max(high.y, cell.y),
+                                       std::max(high.z, cell.z)};
+                }
+                if (chunkChanged)
+                {
+                    changed.store(true, std::memory_order_relaxed);
+                }
+                std::lock_guard<std::mutex> lock(boundsMutex);
+                _minCell = {std::min(_minCell.x, low.x), std::min(_minCell.y, low.y),
+                            std::min(_minCell.z, low.z)};
+                _maxCell = {std::max(_maxCell.x, high.x), std::max(_maxCell.y, high.y),
+                            std::max(_maxCell.z, high.z)};
+            });
+            return changed.load(std::memory_order_relaxed);
+        }
+
+        void SpatialHashGrid::layout(ThreadPool *threadPool)
+        {
+            const std::size_t count = _cells.size();
+            std::size_t buckets     = 64;
+            while (buckets < 2 * count)
+            {
+                buckets *= 2;
+            }
+            _bucketMask = buckets - 1;
+            _bucketStart.assign(buckets + 1, 0);
+            _sorted.resize(count);
+
+            // Histogram in parallel; the counters are shared between chunks
+            std::uint32_t *counters = _bucketStart.data();
+            forEachChunk(threadPool, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    std::atomic_ref<std::uint32_t>(counters[bucketOf(_cells[i])])
+                        .fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+
+            // Bucket ends, then a backwards scatter turns them into starts and keeps each bucket
+            // in ascending index order, whatever the thread count
+            for (std::size_t b = 1; b < buckets; ++b)
+            {
+                _bucketStart[b] += _bucketStart[b - 1];
+            }
+            for (std::size_t i = count; i-- > 0;)
+            {
+                _sorted[--_bucketStart[bucketOf(_cells[i])]] = static_cast<std::uint32_t>(i);
+            }
+            _bucketStart[buckets] = static_cast<std::uint32_t>(count);
+            ++_layoutCount;
+        }
+
+        void SpatialHashGrid::queryRadius(const std::array<double, 3> &centre, double radius,
+                                          std::vector<std::size_t> &result) const
+        {
+            result.clear();
+            forEachInRadius(centre, radius,
+                            [&result](std::size_t index, double) { result.push_back(index); });
+        }
+
+        void SpatialHashGrid::queryNearest(const std::array<double, 3> &centre, std::size_t k,
+                                           std::vector<std::size_t> &result) const
+        {
+            result.clear();
+            if (_store == nullptr || _cells.empty() || k == 0)
+            {
+                return;
+            }
+            k = std::min(k, _cells.size());
+
+            // Max-heap of the k best (distanceSquared, index) pairs found so far
+            using Candidate = std::pair<double, std::size_t>;
+            std::vector<Candidate> heap;
+            heap.reserve(k + 1);
+            auto consider = [&heap, k](std::size_t index, double d2) {
+                const Candidate candidate(d2, index);
+                if (heap.size() < k)
+                {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end());
+                }
+                else if (candidate < heap.front())
+                {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            };
+
+            // Visit shells of cells at growing Chebyshev distance from the centre cell, clipped
+            // to the occupied cells. Whatever lies beyond shell r is at least r cells away.
+            const Cell origin         = cellOf(centre);
+            const double infinity     = std::numeric_limits<double>::infinity();
+            const std::int64_t budget = static_cast<std::int64_t>(_cells.size());
+            std::int64_t visited      = 0;
+            bool exhausted            = false;
+
+            // Shells nearer than the occupied cells are empty
+            auto gap = [](std::int64_t cell, std::int64_t low, std::int64_t high) {
+                return std::max<std::int64_t>({low - cell, cell - high, 0});
+            };
+            const std::int64_t first = std::max({gap(origin.x, _minCell.x, _maxCell.x),
+                                                 gap(origin.y, _minCell.y, _maxCell.y),
+                                                 gap(origin.z, _minCell.z, _maxCell.z)});
+            for (std::int64_t r = first; !exhausted; ++r)
+            {
+                const double reach = static_cast<double>(r - 1) * _cellSize;
+                if (r > 0 && heap.size() == k && heap.front().first <= reach * reach)
+                {
+                    break;
+                }
+                const std::int64_t x0 = std::max<std::int64_t>(origin.x - r, _minCell.x);
+                const std::int64_t x1 = std::min<std::int64_t>(origin.x + r, _maxCell.x);
+                const std::int64_t y0 = std::max<std::int64_t>(origin.y - r, _minCell.y);
+                const std::int64_t y1 = std::min<std::int64_t>(origin.y + r, _maxCell.y);
+                const std::int64_t z0 = std::max<std::int64_t>(origin.z - r, _minCell.z);
+                const std::int64_t z1 = std::min<std::int64_t>(origin.z + r, _maxCell.z);
+
+                exhausted = origin.x - r <= _minCell.x && origin.x + r >= _maxCell.x &&
+                            origin.y - r <= _minCell.y && origin.y + r >= _maxCell.y &&
+                            origin.z - r <= _minCell.z && origin.z + r >= _maxCell.z;
+
+                for (std::int64_t x = x0; x <= x1; ++x)
+                {
+                    for (std::int64_t y = y0; y <= y1; ++y)
+                    {
+                        // Inside the shell only the two z faces are new
+                        const bool face = (x == origin.x - r || x == origin.x + r ||
+                                           y == origin.y - r || y == origin.y + r);
+                        const std::int64_t step = (face || r == 0) ? 1 : 2 * r;
+                        for (std::int64_t z = face ? z0 : origin.z - r; z <= z1; z += step)
+                        {
+                            if (z < z0)
+                            {
+                                continue;
+                            }
+                            visitCell(Cell{static_cast<std::int32_t>(x),
+                                           static_cast<std::int32_t>(y),
+                                           static_cast<std::int32_t>(z)},
+                                      centre, infinity, consider);
+                            ++visited;
+                        }
+                    }
+                }
+
+                // Sparse neighbourhoods: scanning everything is cheaper than more shells
+                if (!exhausted && visited > budget)
+                {
+                    heap.clear();
+                    for (std::size_t index = 0; index < _cells.size(); ++index)
+                    {
+                        consider(index, distanceSquared(centre, index));
+                    }
+                    break;
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end());
+            result.reserve(heap.size());
+            for (const Candidate &candidate : heap)
+            {
+                result.push_back(candidate.second);
+            }
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
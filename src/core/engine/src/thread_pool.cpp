@@ -0,0 +1,211 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file thread_pool.cpp
+ * @brief Definition of the ThreadPool class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "thread_pool.h"
+#include "trace_macros.h"
+#include <algorithm>
+#include <string>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Engine
+    {
+        namespace
+        {
+            // Chunks per participant; spare chunks let idle threads steal and balance the load
+            constexpr std::size_t CHUNKS_PER_WORKER = 4;
+        }  // namespace
+
+        ThreadPool::ThreadPool(std::size_t workerCount) : _queued(0), _stopping(false)
+        {
+            workerCount = std::max<std::size_t>(workerCount, 1);
+            for (std::size_t i = 0; i < workerCount; ++i)
+            {
+                _queues.push_back(std::make_unique<TaskQueue>());
+            }
+
+            // The calling thread is participant 0, so only spawn the remaining ones
+            for (std::size_t i = 1; i < workerCount; ++i)
+            {
+                _workers.emplace_back(&ThreadPool::workerLoop, this, i);
+            }
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _stopping = true;
+            }
+            _wake.notify_all();
+
+            for (std::thread &worker : _workers)
+            {
+                worker.join();
+            }
+        }
+
+        std::size_t ThreadPool::getChunkCount(std::size_t count, std::size_t minChunkSize) const
+        {
+            minChunkSize                = std::max<std::size_t>(minChunkSize, 1);
+            const std::size_t bySize    = (count + minChunkSize - 1) / minChunkSize;
+            const std::size_t byWorkers = getWorkerCount() * CHUNKS_PER_WORKER;
+            return std::min(bySize, byWorkers);
+        }
+
+        void ThreadPool::parallelFor(std::size_t count, const RangeFunction &body,
+                                     std::size_t minChunkSize)
+        {
+            const std::size_t chunkCount = getChunkCount(count, minChunkSize);
+            if (chunkCount == 0)
+            {
+                return;
+            }
+            if (chunkCount == 1 || _workers.empty())
+            {
+                body(0, count);
+                return;
+            }
+
+            Job job{&body, count, chunkCount, chunkCount, {}, nullptr};
+
+            // Count the chunks before publishing them: a worker popping one early must not take
+            // the unsigned counter below zero, which would keep idle workers awake
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _queued.fetch_add(chunkCount, std::memory_order_relaxed);
+            }
+
+            // Deal the chunks round-robin so every participant starts with local work
+            for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                TaskQueue &queue = *_queues[chunk % _queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(Task{&job, chunk});
+            }
+            _wake.notify_all();
+
+            // Help until every chunk of this job has finished
+            while (job.remaining.load(std::memory_order_acquire) > 0)
+            {
+                Task task;
+                if (tryPop(0, task) || trySteal(0, task))
+                {
+                    runTask(task);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            // No task refers to the job any more, so it is safe to unwind
+            if (job.error)
+            {
+                std::rethrow_exception(job.error);
+            }
+        }
+
+        bool ThreadPool::tryPop(std::size_t queue, Task &task)
+        {
+            TaskQueue &own = *_queues[queue];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.tasks.empty())
+            {
+                return false;
+            }
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            _queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool ThreadPool::trySteal(std::size_t thief, Task &task)
+        {
+            const std::size_t n = _queues.size();
+            for (std::size_t offset = 1; offset < n; ++offset)
+            {
+                TaskQueue &victim = *_queues[(thief + offset) % n];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    _queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void ThreadPool::runTask(const Task &task)
+        {
+            IFX_TRACE_ZONE("pool", "chunk");
+            Job &job                = *task.job;
+            const std::size_t begin = job.count * task.chunk / job.chunkCount;
+            const std::size_t end   = job.count * (task.chunk + 1) / job.chunkCount;
+            try
+            {
+                (*job.body)(begin, end);
+            }
+            catch (...)
+            {
+                // Keep the first exception for parallelFor(); the chunk still counts as finished
+                std::lock_guard<std::mutex> lock(job.errorMutex);
+                if (!job.error)
+                {
+                    job.error = std::current_exception();
+                }
+            }
+            job.remaining.fetch_sub(1, std::memory_order_release);
+        }
+
+        void ThreadPool::workerLoop(std::size_t index)
+        {
+            IFX_TRACE_THREAD_NAME("Worker " + std::to_string(index));
+            while (true)
+            {
+                Task task;
+                if (tryPop(index, task) || trySteal(index, task))
+                {
+                    runTask(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _wake.wait(lock, [this] {
+                    return _stopping || _queued.load(std::memory_order_relaxed) > 0;
+                });
+                if (_stopping && _queued.load(std::memory_order_relaxed) == 0)
+                {
+                    return;
+                }
+            }
+        }
+    }  // namespace Engine
+}  // namespace Core
+}  // namespace InertiaFX
@@ -25,6 +25,7 @@
 
 #include "water.h"
 #include "liquid.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -62,15 +63,27 @@ namespace Core
         Water &Water::operator=(const Water &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                // If there's an existing owned object, remove it
-                _material.reset();
+            Medium::operator=(other);
+            return *this;
+        }
 
-                // Deep-copy from other
-                _material = other._material ? std::unique_ptr<IMaterial>(other._material->clone()) :
-                                              nullptr;
-            }
+        /**
+         * @brief Move constructor.
+         * @param other The Water object to move from; its material is taken over.
+         */
+        Water::Water(Water &&other) noexcept : Medium(std::move(other))
+        {
+        }
+
+        /**
+         * @brief Move assignment operator.
+         * @param other The Water object to move from; its material is taken over.
+         * @return A reference to this object.
+         */
+        Water &Water::operator=(Water &&other) noexcept
+        {
+            // Move assignment operator
+            Medium::operator=(std::move(other));
             return *this;
         }
     }  // namespace Engine
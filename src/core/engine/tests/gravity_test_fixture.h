@@ -0,0 +1,83 @@
+#ifndef INERTIAFX_CORE_ENGINE_TESTS_GRAVITY_TEST_FIXTURE_H
+#define INERTIAFX_CORE_ENGINE_TESTS_GRAVITY_TEST_FIXTURE_H
+
+#include "empty_space.h"
+#include "mutual_gravity.h"
+#include "point_mass.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Test fixture with a random cluster of point masses in N-body units, shared by the mutual gravity
+// generators
+class GravityTest : public ::testing::Test
+{
+  protected:
+    void addBodies(std::size_t count)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+        std::uniform_real_distribution<double> mass(0.5, 2.0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            world.addEntity(std::make_unique<PointMass>(
+                Mass(mass(generator), DecimalPrefix::Name::base),
+                Position({coordinate(generator), coordinate(generator), coordinate(generator)},
+                         DecimalPrefix::Name::base)));
+        }
+    }
+
+    // Net forces after applying only the given generator
+    Vector3Array evaluate(MutualGravity &gravity)
+    {
+        EntityStore &store = world.getEntityStore();
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            std::fill(store.forces()[axis].begin(), store.forces()[axis].end(), 0.0);
+        }
+        gravity.setGravitationalConstant(1.0);
+        gravity.apply(world, 0.0);
+        return store.forces();
+    }
+
+    // Largest force error relative to the largest reference force
+    static double maxRelativeError(const Vector3Array &forces, const Vector3Array &reference)
+    {
+        double error = 0.0;
+        double scale = 0.0;
+        for (std::size_t i = 0; i < reference.x.size(); ++i)
+        {
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                error = std::max(error, std::abs(forces[axis][i] - reference[axis][i]));
+                scale = std::max(scale, std::abs(reference[axis][i]));
+            }
+        }
+        return error / scale;
+    }
+
+    // Root mean square of the force errors relative to the reference forces
+    static double rmsRelativeError(const Vector3Array &forces, const Vector3Array &reference)
+    {
+        double error = 0.0;
+        double norm  = 0.0;
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            for (std::size_t i = 0; i < reference.x.size(); ++i)
+            {
+                error += std::pow(forces[axis][i] - reference[axis][i], 2);
+                norm += std::pow(reference[axis][i], 2);
+            }
+        }
+        return std::sqrt(error / norm);
+    }
+
+    EmptySpace world;
+};
+
+#endif  // INERTIAFX_CORE_ENGINE_TESTS_GRAVITY_TEST_FIXTURE_H
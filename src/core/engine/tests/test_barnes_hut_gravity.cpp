@@ -0,0 +1,22 @@
+#include "barnes_hut_gravity.h"
+#include "direct_gravity.h"
+#include "gravity_test_fixture.h"
+
+class BarnesHutGravityTest : public GravityTest
+{
+};
+
+// Test a zero opening angle reproduces the direct sum and larger ones stay close to it
+TEST_F(BarnesHutGravityTest, MatchesDirectSum)
+{
+    addBodies(2000);
+    DirectGravity direct;
+    const Vector3Array reference = evaluate(direct);
+
+    BarnesHutGravity exact(0.0);
+    EXPECT_LT(maxRelativeError(evaluate(exact), reference), 1e-12);
+
+    BarnesHutGravity approximate(0.5);
+    EXPECT_LT(maxRelativeError(evaluate(approximate), reference), 1e-2);
+    EXPECT_GT(approximate.getNodeCount(), 1u);
+}
@@ -0,0 +1,243 @@
+#include "Engine.h"
+#include "bounding_volume_hierarchy.h"
+#include "dynamic_aabb_tree.h"
+#include "empty_space.h"
+#include "entity.h"
+#include "file_logger.h"
+#include "point_mass.h"
+#include "water.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Entity with any volume
+class Body : public Entity
+{
+  public:
+    Body(const Volume &volume, const Position &position,
+         const Velocity &velocity = Velocity({0.0, 0.0, 0.0}, DecimalPrefix::Name::base)) :
+        Entity(Mass(1.0, DecimalPrefix::Name::base), volume, position, velocity)
+    {
+    }
+
+    std::unique_ptr<IEntity> clone() const override
+    {
+        return std::make_unique<Body>(*this);
+    }
+};
+
+// Test fixture with boxes of sizes spanning four orders of magnitude
+class DynamicAabbTreeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+        std::uniform_real_distribution<double> exponent(-2.0, 2.0);
+        for (std::size_t i = 0; i < 2000; ++i)
+        {
+            const std::array<double, 3> centre = {coordinate(generator), coordinate(generator),
+                                                  coordinate(generator)};
+            const double half                  = 0.5 * std::pow(10.0, exponent(generator));
+            boxes.push_back({{centre[0] - half, centre[1] - half, centre[2] - half},
+                             {centre[0] + half, centre[1] + half, centre[2] + half}});
+        }
+    }
+
+    std::vector<std::uint32_t> overlapping(const DynamicAabbTree &tree, const Aabb &box) const
+    {
+        std::vector<std::uint32_t> result;
+        tree.forEachOverlap(
+            box, [&](std::int32_t proxyId) { result.push_back(tree.getUserData(proxyId)); });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<std::uint32_t> bruteForce(const DynamicAabbTree &tree,
+                                          const std::vector<std::int32_t> &proxies,
+                                          const Aabb &box) const
+    {
+        std::vector<std::uint32_t> result;
+        for (const std::int32_t proxyId : proxies)
+        {
+            if (proxyId != DynamicAabbTree::NULL_NODE && tree.getFatAabb(proxyId).overlaps(box))
+            {
+                result.push_back(tree.getUserData(proxyId));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<Aabb> boxes;
+};
+
+// Test overlap queries match a full scan through inserts, moves, removals and a rebuild
+TEST_F(DynamicAabbTreeTest, OverlapMatchesBruteForce)
+{
+    DynamicAabbTree tree(0.5);
+    std::vector<std::int32_t> proxies;
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+    {
+        proxies.push_back(tree.createProxy(boxes[i], static_cast<std::uint32_t>(i)));
+    }
+    EXPECT_EQ(tree.getProxyCount(), boxes.size());
+    EXPECT_LE(tree.getHeight(), 2 * static_cast<int>(std::log2(boxes.size())) + 2);
+
+    const std::vector<Aabb> queries = {{{-10.0, -10.0, -10.0}, {10.0, 10.0, 10.0}},
+                                       {{50.0, -100.0, 0.0}, {51.0, 100.0, 1.0}},
+                                       {{-300.0, -300.0, -300.0}, {300.0, 300.0, 300.0}}};
+    for (const Aabb &query : queries)
+    {
+        EXPECT_EQ(overlapping(tree, query), bruteForce(tree, proxies, query));
+    }
+
+    // Small moves stay inside the fat boxes; large ones reinsert
+    const Aabb nudged = {{boxes[0].min[0] + 0.2, boxes[0].min[1], boxes[0].min[2]},
+                         {boxes[0].max[0] + 0.2, boxes[0].max[1], boxes[0].max[2]}};
+    EXPECT_FALSE(tree.moveProxy(proxies[0], nudged));
+    for (std::size_t i = 0; i < boxes.size(); i += 3)
+    {
+        const Aabb moved = {{-boxes[i].max[0], boxes[i].min[1], boxes[i].min[2]},
+                            {-boxes[i].min[0], boxes[i].max[1], boxes[i].max[2]}};
+        tree.moveProxy(proxies[i], moved);
+    }
+    for (std::size_t i = 1; i < boxes.size(); i += 5)
+    {
+        tree.destroyProxy(proxies[i]);
+        proxies[i] = DynamicAabbTree::NULL_NODE;
+    }
+    for (const Aabb &query : queries)
+    {
+        EXPECT_EQ(overlapping(tree, query), bruteForce(tree, proxies, query));
+    }
+
+    // Rebuilding keeps the proxy ids and gives a tree at least as cheap to query
+    const double incrementalRatio = tree.getAreaRatio();
+    tree.rebuild();
+    EXPECT_LE(tree.getAreaRatio(), incrementalRatio);
+    for (const Aabb &query : queries)
+    {
+        EXPECT_EQ(overlapping(tree, query), bruteForce(tree, proxies, query));
+    }
+}
+
+// Test point and ray queries visit the fat boxes containing or crossed by them
+TEST_F(DynamicAabbTreeTest, PointAndRayQueries)
+{
+    DynamicAabbTree tree(0.0);
+    tree.createProxy({{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}, 0);
+    tree.createProxy({{5.0, 0.0, 0.0}, {6.0, 1.0, 1.0}}, 1);
+    tree.createProxy({{0.5, 0.5, 0.5}, {9.0, 9.0, 9.0}}, 2);
+
+    std::vector<std::uint32_t> found;
+    tree.forEachContaining({0.75, 0.75, 0.75}, [&](std::int32_t proxyId) {
+        found.push_back(tree.getUserData(proxyId));
+    });
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, (std::vector<std::uint32_t>{0u, 2u}));
+
+    // Ray along x at y = z = 0.25 misses box 2
+    std::vector<std::pair<std::uint32_t, double>> hits;
+    tree.forEachRayHit({-2.0, 0.25, 0.25}, {1.0, 0.0, 0.0}, 100.0,
+                       [&](std::int32_t proxyId, double entry) {
+                           hits.emplace_back(tree.getUserData(proxyId), entry);
+                       });
+    std::sort(hits.begin(), hits.end());
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_EQ(hits[0].first, 0u);
+    EXPECT_DOUBLE_EQ(hits[0].second, 2.0);
+    EXPECT_EQ(hits[1].first, 1u);
+    EXPECT_DOUBLE_EQ(hits[1].second, 7.0);
+
+    hits.clear();
+    tree.forEachRayHit({-2.0, 0.25, 0.25}, {1.0, 0.0, 0.0}, 5.0,
+                       [&](std::int32_t proxyId, double entry) {
+                           hits.emplace_back(tree.getUserData(proxyId), entry);
+                       });
+    EXPECT_EQ(hits.size(), 1u);
+}
+
+// Test the world hierarchy tests the exact entity and medium shapes
+TEST(BoundingVolumeHierarchyTest, QueriesUseExactShapes)
+{
+    EmptySpace world;
+    world.addEntity(std::make_unique<Body>(Volume(1.0, DecimalPrefix::Name::base),
+                                           Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world.addEntity(std::make_unique<Body>(Volume(2.0, 2.0, 2.0, DecimalPrefix::Name::base),
+                                           Position({10.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world.addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base),
+        Position({20.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world.addMedium(
+        std::make_unique<Water>(Position({0.0, 0.0, -9.9}, DecimalPrefix::Name::base),
+                                Volume(20.0, 20.0, 20.0, DecimalPrefix::Name::base)));
+    BoundingVolumeHierarchy &bvh = world.getBoundingVolumeHierarchy();
+    bvh.setEnabled(true);
+    world.updateSpatialIndices(nullptr);
+    EXPECT_EQ(bvh.getEntityTree().getProxyCount(), 3u);
+    EXPECT_EQ(bvh.getMediumTree().getProxyCount(), 1u);
+
+    using Hit  = BoundingVolumeHierarchy::Hit;
+    using Kind = BoundingVolumeHierarchy::Kind;
+    std::vector<Hit> hits;
+
+    // The corner of the sphere's bounding box is outside the sphere, but in the water
+    bvh.queryPoint({0.9, 0.9, 0.0}, hits);
+    EXPECT_EQ(hits, (std::vector<Hit>{{Kind::Medium, 0, 0.0}}));
+    bvh.queryPoint({0.5, 0.5, -0.5}, hits);
+    EXPECT_EQ(hits, (std::vector<Hit>{{Kind::Entity, 0, 0.0}, {Kind::Medium, 0, 0.0}}));
+
+    bvh.queryOverlap({{10.9, 0.9, 0.9}, {12.0, 2.0, 2.0}}, hits);
+    EXPECT_EQ(hits, (std::vector<Hit>{{Kind::Entity, 1, 0.0}}));
+
+    // A ray along -x meets the point mass, the box, the water and the sphere
+    bvh.queryRay({30.0, 0.0, 0.0}, {-2.0, 0.0, 0.0}, 100.0, hits);
+    ASSERT_EQ(hits.size(), 4u);
+    EXPECT_EQ(hits[0].index, 2u);
+    EXPECT_NEAR(hits[0].distance, 10.0, 1e-12);
+    EXPECT_EQ(hits[1].index, 1u);
+    EXPECT_NEAR(hits[1].distance, 19.0, 1e-12);
+    EXPECT_EQ(hits[2].kind, Kind::Medium);
+    EXPECT_NEAR(hits[2].distance, 20.0, 1e-12);
+    EXPECT_EQ(hits[3].index, 0u);
+    EXPECT_NEAR(hits[3].distance, 29.0, 1e-12);
+}
+
+// Test the engine moves entity proxies only once they leave their fat box
+TEST(BoundingVolumeHierarchyTest, EngineRefitsMovingEntities)
+{
+    auto world = std::make_unique<EmptySpace>();
+    world->addEntity(std::make_unique<Body>(Volume(0.5, DecimalPrefix::Name::base),
+                                            Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                            Velocity({0.0, 0.0, -5.0}, DecimalPrefix::Name::base)));
+    world->getBoundingVolumeHierarchy().setEnabled(true);
+    world->getBoundingVolumeHierarchy().setMargin(1.0);
+    const IWorld *view = world.get();
+
+    auto logger = std::make_unique<FileLogger>("test_dynamic_aabb_tree.log", LogLevel::Info, true);
+    logger->disable();
+    Engine engine(std::move(logger), std::move(world));
+    engine.timeStep(0.1);
+    EXPECT_EQ(view->getBoundingVolumeHierarchy().getReinsertCount(), 0u);
+
+    // Leaves the 1 m margin after 0.2 s
+    for (int step = 0; step < 10; ++step)
+    {
+        engine.timeStep(0.1);
+    }
+    EXPECT_GE(view->getBoundingVolumeHierarchy().getReinsertCount(), 1u);
+    engine.timeStep(0.0);
+
+    std::vector<BoundingVolumeHierarchy::Hit> hits;
+    const double z = view->getEntityStore().positions().z[0];
+    view->getBoundingVolumeHierarchy().queryPoint({0.0, 0.0, z + 0.4}, hits);
+    EXPECT_EQ(hits.size(), 1u);
+}
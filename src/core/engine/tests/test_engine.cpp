@@ -2,7 +2,14 @@
 #include "empty_space.h"
 #include "file_logger.h"
 #include "logger.h"
+#include "memory_sink.h"
+#include "trace.h"
+#include "trace_macros.h"
+#include <chrono>
+#include <sstream>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
 
 using namespace InertiaFX::Core::Engine;
 
@@ -25,8 +32,10 @@ TEST(EngineTest, RunWithoutTimeAndStopDoesNotThrow)
     auto logger = std::make_unique<FileLogger>("test_engine_run1.log", LogLevel::Info, true);
     auto world  = std::make_unique<EmptySpace>();
     Engine engine(std::move(logger), std::move(world));
-    engine.run();
-    engine.stop();
+    RunHandle handle = engine.runAsync();
+    handle.stop();
+    EXPECT_NO_THROW(handle.join());
+    EXPECT_FALSE(handle.isRunning());
 }
 
 TEST(EngineTest, RunWithTimeAndStepDoesNotThrow)
@@ -46,3 +55,133 @@ TEST(EngineTest, RunWithUnsignedIntDoesNotThrow)
     Engine engine(std::move(logger), std::move(world));
     EXPECT_NO_THROW(engine.run(10, 1));
 }
+
+TEST(EngineTest, RunAsyncPublishesProgress)
+{
+    auto logger = std::make_unique<FileLogger>("test_engine_run4.log", LogLevel::Info, true);
+    auto world  = std::make_unique<EmptySpace>();
+    Engine engine(std::move(logger), std::move(world));
+    RunHandle handle = engine.runAsync(10, 1);
+    handle.join();
+
+    // Ten one-second steps reach the run time exactly
+    EXPECT_EQ(handle.getStepCount(), 10u);
+    EXPECT_DOUBLE_EQ(handle.getSimulationTime(), 10.0);
+    EXPECT_FALSE(handle.joinable());
+}
+
+TEST(EngineTest, RunStopsAtTheRunTime)
+{
+    auto logger = std::make_unique<FileLogger>("test_engine_run8.log", LogLevel::Info, true);
+    Engine engine(std::move(logger), std::make_unique<EmptySpace>());
+
+    // 0.1 s does not add up exactly to 2 s, yet no step is lost or added
+    engine.run(Time(2, DecimalPrefix::Name::base), Time(100, DecimalPrefix::Name::milli));
+    EXPECT_EQ(engine.getStepCount(), 20u);
+    EXPECT_NEAR(engine.getSimulationTime(), 2.0, 1e-12);
+}
+
+TEST(EngineTest, PauseHoldsTheStepCount)
+{
+    auto logger = std::make_unique<FileLogger>("test_engine_run5.log", LogLevel::Info, true);
+    auto world  = std::make_unique<EmptySpace>();
+    Engine engine(std::move(logger), std::move(world));
+    RunHandle handle = engine.runAsync();
+
+    while (handle.getStepCount() == 0)
+    {
+        std::this_thread::yield();
+    }
+    handle.pause();
+    EXPECT_TRUE(handle.isPaused());
+
+    // At most the step in flight completes after pause() returns
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::uint64_t paused = handle.getStepCount();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(handle.getStepCount(), paused);
+
+    handle.resume();
+    while (handle.getStepCount() == paused)
+    {
+        std::this_thread::yield();
+    }
+    handle.stop();
+    handle.join();
+    EXPECT_GT(handle.getStepCount(), paused);
+}
+
+TEST(EngineTest, StopWakesAPausedRun)
+{
+    auto logger = std::make_unique<FileLogger>("test_engine_run6.log", LogLevel::Info, true);
+    auto world  = std::make_unique<EmptySpace>();
+    Engine engine(std::move(logger), std::move(world));
+    RunHandle handle = engine.runAsync();
+    handle.pause();
+    handle.stop();
+    EXPECT_NO_THROW(handle.join());
+}
+
+TEST(EngineTest, RunAsyncTwiceThrows)
+{
+    auto logger = std::make_unique<FileLogger>("test_engine_run7.log", LogLevel::Info, true);
+    auto world  = std::make_unique<EmptySpace>();
+    Engine engine(std::move(logger), std::move(world));
+    RunHandle first = engine.runAsync();
+    EXPECT_THROW(engine.runAsync(), std::logic_error);
+
+    // Destroying the handle stops and joins the run, so the engine can be reused
+    first = RunHandle();
+    RunHandle second = engine.runAsync(5, 1);
+    second.join();
+    EXPECT_FALSE(engine.isRunning());
+}
+
+TEST(EngineTest, StampsLogWithSimulationProgress)
+{
+    auto logger = std::make_unique<Logger>();
+    logger->clearSinks();
+    logger->setStamps(LogStamp::Simulation);
+    auto &sink = static_cast<MemorySink &>(logger->addSink(std::make_unique<MemorySink>(8)));
+    Engine engine(std::move(logger), std::make_unique<EmptySpace>());
+
+    // Three one-second steps
+    engine.run(3, 1);
+    EXPECT_EQ(sink.getLines().front(), "[Info] Engine started running.\n");
+    EXPECT_EQ(sink.getLines().back(), "[t=3 s] [step 3] [Info] Engine stopped running.\n");
+}
+
+TEST(EngineTest, LogsRunTimeWithUnits)
+{
+    auto logger = std::make_unique<Logger>();
+    logger->clearSinks();
+    logger->setStamps(0);
+    auto &sink = static_cast<MemorySink &>(logger->addSink(std::make_unique<MemorySink>(8)));
+    Engine engine(std::move(logger), std::make_unique<EmptySpace>());
+
+    engine.run(Time(2, DecimalPrefix::Name::base), Time(500, DecimalPrefix::Name::milli));
+    EXPECT_EQ(sink.getLines()[1], "[Info] Run Time: 2 s, Time Step: 500 ms.\n");
+}
+
+TEST(EngineTest, TracesStepPhasesWhenCompiledIn)
+{
+    Tracer::instance().clear();
+    Tracer::instance().enable();
+    auto logger = std::make_unique<Logger>();
+    logger->disable();
+    Engine engine(std::move(logger), std::make_unique<EmptySpace>());
+    engine.run(2, 1);
+    Tracer::instance().disable();
+
+    std::ostringstream trace;
+    Tracer::instance().writeChromeTrace(trace);
+#if IFX_TRACING_ENABLED
+    EXPECT_NE(trace.str().find("\"name\":\"Engine::run\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"name\":\"Engine::timeStep\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"name\":\"integrate\""), std::string::npos);
+#else
+    // The zones compile to nothing
+    EXPECT_EQ(Tracer::instance().getEventCount(), 0u);
+#endif
+    Tracer::instance().clear();
+}
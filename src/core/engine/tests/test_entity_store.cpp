@@ -0,0 +1,118 @@
+#include "empty_space.h"
+#include "entity_handle.h"
+#include "entity_store.h"
+#include "point_mass.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Test fixture for the EntityStore and its proxies
+class EntityStoreTest : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<PointMass> makePointMass(double mass, std::array<double, 3> position)
+    {
+        return std::make_unique<PointMass>(Mass(mass, DecimalPrefix::Name::base),
+                                           Position(position, DecimalPrefix::Name::base),
+                                           Velocity({1.0, 0.0, 0.0}, DecimalPrefix::Name::base));
+    }
+};
+
+// Test arrays start on a cache line so loops can use aligned loads
+TEST_F(EntityStoreTest, ArraysAreAligned)
+{
+    EntityStore store;
+    store.add(*makePointMass(1.0, {0.0, 0.0, 0.0}));
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(store.positions().x.data()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(store.velocities().z.data()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(store.inverseMasses().data()) % 64, 0u);
+}
+
+// Test adding entities copies their state into the arrays
+TEST_F(EntityStoreTest, AddCopiesState)
+{
+    EntityStore store;
+    store.reserve(2);
+    EXPECT_EQ(store.add(*makePointMass(2.0, {1.0, 2.0, 3.0})), 0u);
+    EXPECT_EQ(store.add(*makePointMass(0.0, {4.0, 5.0, 6.0})), 1u);
+
+    EXPECT_EQ(store.size(), 2u);
+    EXPECT_DOUBLE_EQ(store.positions().y[0], 2.0);
+    EXPECT_DOUBLE_EQ(store.positions().z[1], 6.0);
+    EXPECT_DOUBLE_EQ(store.velocities().x[1], 1.0);
+    EXPECT_DOUBLE_EQ(store.inverseMasses()[0], 0.5);
+    EXPECT_DOUBLE_EQ(store.inverseMasses()[1], 0.0);
+    EXPECT_EQ(store.fixed()[0], 0);
+}
+
+// Test the world hands out proxies that read and write the store
+TEST_F(EntityStoreTest, WorldEntitiesAreProxies)
+{
+    EmptySpace world;
+    world.addEntity(makePointMass(2.0, {1.0, 2.0, 3.0}));
+    world.addEntity(makePointMass(4.0, {7.0, 8.0, 9.0}));
+
+    EntityStore &store = world.getEntityStore();
+    ASSERT_EQ(store.size(), 2u);
+    ASSERT_EQ(world.getTotalNumberOfEntities(), 2u);
+
+    IEntity &second = *world.getEntities()[1];
+    EXPECT_DOUBLE_EQ(second.getMass().getValue(), 4.0);
+
+    // Writes through the store are visible through the proxy once synced
+    store.positions().x[1] = 10.0;
+    EXPECT_DOUBLE_EQ(second.getPosition().getValue()[0], 7.0);
+    world.syncEntities(nullptr);
+    EXPECT_DOUBLE_EQ(second.getPosition().getValue()[0], 10.0);
+
+    // Writes through the proxy land in the store
+    second.setVelocity({0.0, -1.0, 0.0});
+    second.addForce({1.0, 2.0, 3.0});
+    second.addForce(Force({1.0, 0.0, 0.0}, DecimalPrefix::Name::base));
+    EXPECT_DOUBLE_EQ(store.velocities().y[1], -1.0);
+    EXPECT_DOUBLE_EQ(store.forces().x[1], 2.0);
+    EXPECT_DOUBLE_EQ(second.getForce().getValue()[2], 3.0);
+
+    second.fixEntity();
+    EXPECT_TRUE(second.isFixed());
+    EXPECT_EQ(store.fixed()[1], 1);
+    EXPECT_FALSE(world.getEntities()[0]->isFixed());
+}
+
+// Test cloning a proxy yields a detached entity with the current state
+TEST_F(EntityStoreTest, CloneIsDetached)
+{
+    EmptySpace world;
+    world.addEntity(makePointMass(2.0, {1.0, 2.0, 3.0}));
+    world.getEntityStore().positions().z[0] = 30.0;
+
+    std::unique_ptr<IEntity> copy = world.getEntities()[0]->clone();
+    ASSERT_NE(dynamic_cast<PointMass *>(copy.get()), nullptr);
+    EXPECT_DOUBLE_EQ(copy->getPosition().getValue()[2], 30.0);
+
+    copy->setPosition({0.0, 0.0, 0.0});
+    EXPECT_DOUBLE_EQ(world.getEntityStore().positions().z[0], 30.0);
+}
+
+// Test the added entity stays reachable, but its own state is detached from the simulation
+TEST_F(EntityStoreTest, HandleWrapsTheAddedEntity)
+{
+    EmptySpace world;
+    std::unique_ptr<PointMass> added = makePointMass(2.0, {1.0, 2.0, 3.0});
+    PointMass *kept                  = added.get();
+    world.addEntity(std::move(added));
+
+    const IEntity &listed = *world.getEntities()[0];
+    EXPECT_EQ(dynamic_cast<const PointMass *>(&listed), nullptr);
+    const auto *handle = dynamic_cast<const EntityHandle *>(&listed);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(dynamic_cast<const PointMass *>(&handle->getEntity()), kept);
+
+    kept->setPosition({5.0, 5.0, 5.0});
+    EXPECT_DOUBLE_EQ(listed.getPosition().getValue()[0], 1.0);
+    EXPECT_DOUBLE_EQ(world.getEntityStore().positions().x[0], 1.0);
+}
@@ -0,0 +1,33 @@
+#include "direct_gravity.h"
+#include "fmm_gravity.h"
+#include "gravity_test_fixture.h"
+
+class FmmGravityTest : public GravityTest
+{
+};
+
+// Test the error against the direct sum falls as the expansion order rises
+TEST_F(FmmGravityTest, ConvergesWithOrder)
+{
+    addBodies(1000);
+    DirectGravity direct;
+    const Vector3Array reference = evaluate(direct);
+
+    FmmGravity gravity(1);
+    gravity.setLeafCapacity(8);
+    double previous = rmsRelativeError(evaluate(gravity), reference);
+    EXPECT_GT(gravity.getM2LCount(), 0u);
+    for (std::size_t order : {2, 4, 6})
+    {
+        gravity.setOrder(order);
+        const double error = rmsRelativeError(evaluate(gravity), reference);
+        EXPECT_LT(error, previous) << "order " << order;
+        previous = error;
+    }
+    EXPECT_LT(previous, 1e-3);
+
+    gravity.setOrder(FmmGravity::MAX_ORDER + 5);
+    EXPECT_EQ(gravity.getOrder(), FmmGravity::MAX_ORDER);
+    gravity.setOrder(0);
+    EXPECT_EQ(gravity.getOrder(), 1u);
+}
@@ -0,0 +1,184 @@
+#include "Engine.h"
+#include "empty_space.h"
+#include "file_logger.h"
+#include "point_mass.h"
+#include "world.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace InertiaFX::Core::Engine;
+
+// World with gravity along -z, in N/kg
+class UniformGravity : public World
+{
+  public:
+    UniformGravity() :
+        World(Volume(1000.0, 1000.0, 1000.0, DecimalPrefix::Name::base),
+              Force({0.0, 0.0, -10.0}, DecimalPrefix::Name::base))
+    {
+    }
+};
+
+// Linear spring pulling every entity towards the origin, F = -k x
+class Spring : public IForceGenerator
+{
+  public:
+    explicit Spring(double stiffness) : _stiffness(stiffness)
+    {
+    }
+
+    void apply(IWorld &world, double) override
+    {
+        EntityStore &store = world.getEntityStore();
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            for (std::size_t i = 0; i < store.size(); ++i)
+            {
+                store.forces()[axis][i] -= _stiffness * store.positions()[axis][i];
+            }
+        }
+    }
+
+  private:
+    double _stiffness;
+};
+
+// Generator adding no force, counting its evaluations
+class CountingGenerator : public IForceGenerator
+{
+  public:
+    explicit CountingGenerator(int &calls) : _calls(calls)
+    {
+    }
+
+    void apply(IWorld &, double) override
+    {
+        ++_calls;
+    }
+
+  private:
+    int &_calls;
+};
+
+// Test fixture running an engine with one or two point masses
+class IntegratorTest : public ::testing::TestWithParam<IntegratorType>
+{
+  protected:
+    std::unique_ptr<Engine> makeEngine(std::unique_ptr<IWorld> world)
+    {
+        auto logger = std::make_unique<FileLogger>("test_integrator.log", LogLevel::Info, true);
+        auto engine = std::make_unique<Engine>(std::move(logger), std::move(world));
+        engine->setIntegrator(GetParam());
+        return engine;
+    }
+
+    std::unique_ptr<PointMass> makePointMass(std::array<double, 3> position,
+                                             std::array<double, 3> velocity)
+    {
+        return std::make_unique<PointMass>(Mass(2.0, DecimalPrefix::Name::base),
+                                           Position(position, DecimalPrefix::Name::base),
+                                           Velocity(velocity, DecimalPrefix::Name::base));
+    }
+};
+
+// Test a projectile under uniform gravity; within tolerance of the first order schemes
+TEST_P(IntegratorTest, FreeFall)
+{
+    auto world = std::make_unique<UniformGravity>();
+    world->addEntity(makePointMass({0.0, 0.0, 100.0}, {1.0, 0.0, 0.0}));
+    IWorld *worldPtr = world.get();
+    auto engine      = makeEngine(std::move(world));
+
+    const double dt = 1e-3;
+    for (int i = 0; i < 1000; ++i)
+    {
+        engine->timeStep(dt);
+    }
+
+    const IEntity &entity = *worldPtr->getEntities()[0];
+    EXPECT_NEAR(engine->getSimulationTime(), 1.0, 1e-9);
+    EXPECT_NEAR(entity.getPosition().getValue()[0], 1.0, 1e-9);
+    EXPECT_NEAR(entity.getPosition().getValue()[2], 100.0 - 5.0, 1e-2);
+    EXPECT_NEAR(entity.getVelocity().getValue()[2], -10.0, 1e-9);
+    EXPECT_NEAR(entity.getAcceleration().getValue()[2], -10.0, 1e-9);
+}
+
+// Test fixed entities neither move nor accelerate
+TEST_P(IntegratorTest, FixedEntityStaysPut)
+{
+    auto world = std::make_unique<UniformGravity>();
+    world->addEntity(makePointMass({1.0, 2.0, 3.0}, {5.0, 0.0, 0.0}));
+    world->getEntities()[0]->fixEntity();
+    IWorld *worldPtr = world.get();
+    auto engine      = makeEngine(std::move(world));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        engine->timeStep(0.1);
+    }
+
+    const IEntity &entity = *worldPtr->getEntities()[0];
+    EXPECT_DOUBLE_EQ(entity.getPosition().getValue()[0], 1.0);
+    EXPECT_DOUBLE_EQ(entity.getPosition().getValue()[2], 3.0);
+    EXPECT_DOUBLE_EQ(entity.getVelocity().getValue()[0], 5.0);
+}
+
+// Test force generators and post-step hooks take part in the step
+TEST_P(IntegratorTest, SpringOscillatorAndHooks)
+{
+    auto world = std::make_unique<EmptySpace>();
+    world->addEntity(makePointMass({1.0, 0.0, 0.0}, {0.0, 0.0, 0.0}));
+    IWorld *worldPtr = world.get();
+    auto engine      = makeEngine(std::move(world));
+
+    // m = 2 kg, k = 8 N/m, so omega = 2 rad/s
+    engine->addForceGenerator(std::make_unique<Spring>(8.0));
+    int hookCalls = 0;
+    engine->addPostStepHook([&hookCalls](IWorld &, double) { ++hookCalls; });
+
+    const double dt = 1e-3;
+    const int steps = 1000;
+    for (int i = 0; i < steps; ++i)
+    {
+        engine->timeStep(dt);
+    }
+
+    EXPECT_EQ(hookCalls, steps);
+    const double expected = std::cos(2.0 * engine->getSimulationTime());
+    const double actual   = worldPtr->getEntities()[0]->getPosition().getValue()[0];
+    const bool firstOrder = GetParam() == IntegratorType::ExplicitEuler ||
+                            GetParam() == IntegratorType::SemiImplicitEuler;
+    EXPECT_NEAR(actual, expected, firstOrder ? 1e-2 : 1e-6);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllIntegrators, IntegratorTest,
+                         ::testing::Values(IntegratorType::ExplicitEuler,
+                                           IntegratorType::SemiImplicitEuler,
+                                           IntegratorType::VelocityVerlet,
+                                           IntegratorType::RungeKutta4));
+
+// Test velocity Verlet reuses the forces of the previous step unless the state was changed
+TEST(IntegratorReuseTest, VelocityVerletEvaluatesOncePerStep)
+{
+    auto world = std::make_unique<UniformGravity>();
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base), Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    IWorld *worldPtr = world.get();
+    auto logger      = std::make_unique<FileLogger>("test_integrator.log", LogLevel::Info, true);
+    Engine engine(std::move(logger), std::move(world));
+    engine.setIntegrator(IntegratorType::VelocityVerlet);
+    int calls = 0;
+    engine.addForceGenerator(std::make_unique<CountingGenerator>(calls));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        engine.timeStep(1e-3);
+    }
+    EXPECT_EQ(calls, 11);
+
+    // A write through an entity makes the next step start from fresh forces
+    worldPtr->getEntities()[0]->setVelocity({1.0, 0.0, 0.0});
+    engine.timeStep(1e-3);
+    EXPECT_EQ(calls, 13);
+}
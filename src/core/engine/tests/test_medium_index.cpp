@@ -0,0 +1,124 @@
+#include "Engine.h"
+#include "empty_space.h"
+#include "file_logger.h"
+#include "medium_index.h"
+#include "point_mass.h"
+#include "water.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Test fixture with two separate pools and a sphere of water nested in the first
+class MediumIndexTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mediums.push_back(
+            std::make_unique<Water>(Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                    Volume(10.0, 10.0, 10.0, DecimalPrefix::Name::base)));
+        mediums.push_back(
+            std::make_unique<Water>(Position({20.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                    Volume(10.0, 10.0, 10.0, DecimalPrefix::Name::base)));
+        mediums.push_back(
+            std::make_unique<Water>(Position({2.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                    Volume(1.0, DecimalPrefix::Name::base)));
+        index.setEnabled(true);
+    }
+
+    void addEntity(std::array<double, 3> position)
+    {
+        PointMass entity(Mass(1.0, DecimalPrefix::Name::base),
+                         Position(position, DecimalPrefix::Name::base));
+        store.add(entity);
+    }
+
+    std::vector<std::unique_ptr<IMedium>> mediums;
+    EntityStore store;
+    MediumIndex index;
+};
+
+// Test point lookups return the innermost medium first
+TEST_F(MediumIndexTest, FindsInnermostMedium)
+{
+    index.update(mediums, store);
+
+    EXPECT_EQ(index.findMedium({0.0, 0.0, 0.0}), 0u);
+    EXPECT_EQ(index.findMedium({2.5, 0.0, 0.0}), 2u);
+    EXPECT_EQ(index.findMedium({24.0, 4.0, -4.0}), 1u);
+    EXPECT_EQ(index.findMedium({10.0, 0.0, 0.0}), MediumIndex::NO_MEDIUM);
+    // Inside the bounding box of the sphere, outside the sphere
+    EXPECT_EQ(index.findMedium({2.9, 0.9, 0.0}), 0u);
+
+    std::vector<std::uint32_t> found;
+    index.findMediums({2.5, 0.0, 0.0}, found);
+    EXPECT_EQ(found, (std::vector<std::uint32_t>{2u, 0u}));
+}
+
+// Test entities keep their cached medium until they leave it
+TEST_F(MediumIndexTest, CachedMediumIsRevalidated)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        addEntity({20.0 + 0.04 * i, 0.0, 0.0});
+    }
+    addEntity({2.0, 0.0, 0.0});
+    addEntity({50.0, 0.0, 0.0});
+
+    index.update(mediums, store);
+    EXPECT_EQ(index.getLastLookupCount(), store.size());
+    EXPECT_EQ(index.getEntityMedium(0), mediums[1].get());
+    EXPECT_EQ(index.getEntityMediumIndex(100), 2u);
+    EXPECT_EQ(index.getEntityMedium(101), nullptr);
+
+    // Only the entities in an overlapped medium or in none are searched again
+    index.update(mediums, store);
+    EXPECT_EQ(index.getLastLookupCount(), 2u);
+
+    // Leaving the second pool
+    store.positions().x[0] = 30.0;
+    index.update(mediums, store);
+    EXPECT_EQ(index.getLastLookupCount(), 3u);
+    EXPECT_EQ(index.getEntityMediumIndex(0), MediumIndex::NO_MEDIUM);
+    EXPECT_EQ(index.getEntityMediumIndex(1), 1u);
+}
+
+// Test moved mediums are picked up without a rebuild
+TEST_F(MediumIndexTest, MovedMedium)
+{
+    addEntity({20.0, 0.0, 0.0});
+    index.update(mediums, store);
+    EXPECT_EQ(index.getEntityMediumIndex(0), 1u);
+
+    mediums[2]->setPosition(Position({20.0, 0.0, 0.0}, DecimalPrefix::Name::base));
+    index.update(mediums, store);
+    EXPECT_EQ(index.getEntityMediumIndex(0), 2u);
+    EXPECT_EQ(index.findMedium({2.0, 0.0, 0.0}), 0u);
+}
+
+// Test the engine keeps the medium of each world entity up to date
+TEST(MediumIndexWorldTest, EngineTracksEntityMedium)
+{
+    auto world = std::make_unique<EmptySpace>();
+    world->addMedium(std::make_unique<Water>(Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+                                             Volume(2.0, 2.0, 2.0, DecimalPrefix::Name::base)));
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base), Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+        Velocity({10.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world->getMediumIndex().setEnabled(true);
+    const IWorld *view = world.get();
+
+    auto logger = std::make_unique<FileLogger>("test_medium_index.log", LogLevel::Info, true);
+    logger->disable();
+    Engine engine(std::move(logger), std::move(world));
+    engine.timeStep(0.05);
+    EXPECT_EQ(view->getMediumIndex().getEntityMedium(0), view->getMediums()[0].get());
+
+    // Leaves the water at x = 1 m
+    engine.timeStep(0.1);
+    engine.timeStep(0.0);
+    EXPECT_EQ(view->getMediumIndex().getEntityMedium(0), nullptr);
+}
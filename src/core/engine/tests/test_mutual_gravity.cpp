@@ -0,0 +1,76 @@
+#include "Engine.h"
+#include "barnes_hut_gravity.h"
+#include "file_logger.h"
+#include "fmm_gravity.h"
+#include "gravity_test_fixture.h"
+
+// Typed over the approximate mutual gravity generators
+template <typename Gravity>
+class MutualGravityTest : public GravityTest
+{
+};
+
+using Approximations = ::testing::Types<BarnesHutGravity, FmmGravity>;
+TYPED_TEST_SUITE(MutualGravityTest, Approximations);
+
+// Test two bodies attract with Newton's law and equal and opposite forces
+TYPED_TEST(MutualGravityTest, TwoBodies)
+{
+    this->world.addEntity(std::make_unique<PointMass>(
+        Mass(2.0, DecimalPrefix::Name::base),
+        Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    this->world.addEntity(std::make_unique<PointMass>(
+        Mass(3.0, DecimalPrefix::Name::base),
+        Position({2.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+
+    TypeParam gravity;
+    gravity.setLeafCapacity(1);
+    const Vector3Array forces = this->evaluate(gravity);
+    EXPECT_DOUBLE_EQ(forces.x[0], 1.5);
+    EXPECT_DOUBLE_EQ(forces.x[1], -1.5);
+    EXPECT_DOUBLE_EQ(forces.y[0], 0.0);
+}
+
+// Test the forces do not depend on the thread pool
+TYPED_TEST(MutualGravityTest, ParallelMatchesSerial)
+{
+    this->addBodies(5000);
+    TypeParam gravity;
+    const Vector3Array serial = this->evaluate(gravity);
+
+    ThreadPool pool(4);
+    gravity.setThreadPool(&pool);
+    const Vector3Array parallel = this->evaluate(gravity);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        for (std::size_t i = 0; i < serial.x.size(); ++i)
+        {
+            ASSERT_EQ(parallel[axis][i], serial[axis][i]);
+        }
+    }
+}
+
+// Test the engine steps a bound pair registered as a force generator
+TYPED_TEST(MutualGravityTest, EngineAppliesGravity)
+{
+    auto world = std::make_unique<EmptySpace>();
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base),
+        Position({-1.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base),
+        Position({1.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    const IWorld *view = world.get();
+
+    auto logger = std::make_unique<FileLogger>("test_mutual_gravity.log", LogLevel::Info, true);
+    logger->disable();
+    Engine engine(std::move(logger), std::move(world));
+    engine.setWorkerCount(2);
+    auto gravity = std::make_unique<TypeParam>();
+    gravity->setGravitationalConstant(1.0);
+    engine.addForceGenerator(std::move(gravity));
+    engine.timeStep(0.01);
+
+    EXPECT_GT(view->getEntities()[0]->getVelocity().getValue()[0], 0.0);
+    EXPECT_LT(view->getEntities()[1]->getVelocity().getValue()[0], 0.0);
+}
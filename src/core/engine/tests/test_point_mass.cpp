@@ -7,6 +7,8 @@
 #include <array>
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::Engine;
 using namespace InertiaFX::Core::SI;
@@ -170,3 +172,42 @@ TEST_F(PointMassTest, InstanceCountWithDestruction)
     delete pointMass2;
     EXPECT_EQ(PointMass::nInstances, 0);
 }
+
+TEST_F(PointMassTest, InstanceCountWithCopies)
+{
+    EXPECT_EQ(PointMass::nInstances, 0);
+
+    {
+        PointMass original(mass, position);
+        PointMass copy(original);
+        std::unique_ptr<IEntity> clone = original.clone();
+        EXPECT_EQ(PointMass::nInstances, 3);
+
+        copy = original;
+        EXPECT_EQ(PointMass::nInstances, 3);
+    }
+
+    EXPECT_EQ(PointMass::nInstances, 0);
+}
+
+// Move operations must not throw so containers relocate instead of copying; Entity is abstract,
+// so its move constructor is checked through PointMass
+TEST_F(PointMassTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<PointMass>);
+    static_assert(std::is_nothrow_move_assignable_v<PointMass>);
+    static_assert(std::is_nothrow_move_assignable_v<Entity>);
+
+    {
+        PointMass source(mass, position);
+        PointMass moved(std::move(source));
+        EXPECT_TRUE(moved.getPosition() == position);
+        EXPECT_EQ(PointMass::nInstances, 2);
+
+        PointMass assigned(mass);
+        assigned = std::move(moved);
+        EXPECT_TRUE(assigned.getPosition() == position);
+        EXPECT_EQ(PointMass::nInstances, 3);
+    }
+    EXPECT_EQ(PointMass::nInstances, 0);
+}
@@ -0,0 +1,222 @@
+#include "Engine.h"
+#include "empty_space.h"
+#include "entity.h"
+#include "file_logger.h"
+#include "point_mass.h"
+#include "spatial_hash_grid.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Sphere shaped entity, to give the grid a bounding radius
+class Ball : public Entity
+{
+  public:
+    Ball(double radius, const Position &position) :
+        Entity(Mass(1.0, DecimalPrefix::Name::base), Volume(radius, DecimalPrefix::Name::base),
+               position)
+    {
+    }
+
+    std::unique_ptr<IEntity> clone() const override
+    {
+        return std::make_unique<Ball>(*this);
+    }
+};
+
+// Test fixture filling a store with entities at random positions
+class SpatialHashGridTest : public ::testing::Test
+{
+  protected:
+    void fill(std::size_t count, double extent)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> coordinate(-extent, extent);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            PointMass entity(Mass(1.0, DecimalPrefix::Name::base),
+                             Position({coordinate(generator), coordinate(generator),
+                                       coordinate(generator)},
+                                      DecimalPrefix::Name::base));
+            store.add(entity);
+        }
+    }
+
+    double distanceSquared(const std::array<double, 3> &centre, std::size_t index) const
+    {
+        const double dx = store.positions().x[index] - centre[0];
+        const double dy = store.positions().y[index] - centre[1];
+        const double dz = store.positions().z[index] - centre[2];
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    std::vector<std::size_t> bruteForceRadius(const std::array<double, 3> &centre,
+                                              double radius) const
+    {
+        std::vector<std::size_t> result;
+        for (std::size_t i = 0; i < store.size(); ++i)
+        {
+            if (distanceSquared(centre, i) <= radius * radius)
+            {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    EntityStore store;
+};
+
+// Test radius queries find exactly the entities a full scan finds
+TEST_F(SpatialHashGridTest, RadiusQueryMatchesBruteForce)
+{
+    fill(20000, 50.0);
+    ThreadPool pool(4);
+    SpatialHashGrid grid(2.0);
+    grid.rebuild(store, &pool);
+    EXPECT_EQ(grid.size(), store.size());
+
+    std::vector<std::size_t> result;
+    for (const double radius : {0.0, 1.0, 3.5, 12.0, 500.0})
+    {
+        for (const std::array<double, 3> &centre :
+             {std::array<double, 3>{0.0, 0.0, 0.0}, std::array<double, 3>{-49.0, 20.0, 7.5},
+              std::array<double, 3>{300.0, 0.0, 0.0}})
+        {
+            grid.queryRadius(centre, radius, result);
+            std::sort(result.begin(), result.end());
+            EXPECT_EQ(result, bruteForceRadius(centre, radius)) << "radius " << radius;
+        }
+    }
+}
+
+// Test k-nearest queries return the k closest entities, nearest first
+TEST_F(SpatialHashGridTest, NearestQueryMatchesBruteForce)
+{
+    fill(5000, 20.0);
+    SpatialHashGrid grid;
+    grid.rebuild(store);
+
+    std::vector<std::size_t> result;
+    for (const std::array<double, 3> &centre :
+         {std::array<double, 3>{0.0, 0.0, 0.0}, std::array<double, 3>{19.0, -19.0, 19.0},
+          std::array<double, 3>{1000.0, 1000.0, 0.0}})
+    {
+        for (const std::size_t k : {1u, 8u, 100u})
+        {
+            std::vector<std::size_t> expected(store.size());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+            {
+                expected[i] = i;
+            }
+            std::sort(expected.begin(), expected.end(), [&](std::size_t a, std::size_t b) {
+                return std::make_pair(distanceSquared(centre, a), a) <
+                       std::make_pair(distanceSquared(centre, b), b);
+            });
+            expected.resize(k);
+
+            grid.queryNearest(centre, k, result);
+            EXPECT_EQ(result, expected) << "k " << k;
+        }
+    }
+
+    grid.queryNearest({0.0, 0.0, 0.0}, store.size() + 10, result);
+    EXPECT_EQ(result.size(), store.size());
+}
+
+// Test update() only rebuilds the layout when an entity changed cell
+TEST_F(SpatialHashGridTest, UpdateRelayoutsOnlyOnCellChange)
+{
+    fill(1000, 10.0);
+    SpatialHashGrid grid(1.0);
+    EXPECT_FALSE(grid.update(store));
+    EXPECT_EQ(grid.getLayoutCount(), 0u);
+
+    grid.setEnabled(true);
+    EXPECT_TRUE(grid.update(store));
+    EXPECT_EQ(grid.getLayoutCount(), 1u);
+    EXPECT_FALSE(grid.update(store));
+    EXPECT_EQ(grid.getLayoutCount(), 1u);
+
+    // Move one entity across several cells
+    store.positions().x[7] += 5.0;
+    EXPECT_TRUE(grid.update(store));
+    EXPECT_EQ(grid.getLayoutCount(), 2u);
+
+    std::vector<std::size_t> result;
+    const std::array<double, 3> centre = {store.positions().x[7], store.positions().y[7],
+                                          store.positions().z[7]};
+    grid.queryRadius(centre, 0.0, result);
+    EXPECT_NE(std::find(result.begin(), result.end(), 7u), result.end());
+}
+
+// Test the cell size follows the entity radii, or the density of point-like entities
+TEST_F(SpatialHashGridTest, AutoCellSize)
+{
+    fill(1000, 5.0);
+    SpatialHashGrid grid;
+    grid.rebuild(store);
+    EXPECT_NEAR(grid.getCellSize(), 1.0, 0.05);
+
+    Ball ball(0.25, Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base));
+    store.add(ball);
+    EXPECT_DOUBLE_EQ(store.radii().back(), 0.25);
+    grid.rebuild(store);
+    EXPECT_DOUBLE_EQ(grid.getCellSize(), 0.5);
+
+    grid.setCellSize(3.0);
+    grid.rebuild(store);
+    EXPECT_DOUBLE_EQ(grid.getCellSize(), 3.0);
+}
+
+// Test non-finite positions do not break the grid
+TEST_F(SpatialHashGridTest, NonFinitePositions)
+{
+    fill(100, 1.0);
+    store.positions().x[3] = std::numeric_limits<double>::quiet_NaN();
+    store.positions().y[4] = std::numeric_limits<double>::infinity();
+    SpatialHashGrid grid(0.5);
+    grid.rebuild(store);
+
+    std::vector<std::size_t> result;
+    grid.queryRadius({0.0, 0.0, 0.0}, 10.0, result);
+    EXPECT_EQ(result.size(), 98u);
+    grid.queryNearest({0.0, 0.0, 0.0}, 100, result);
+    EXPECT_EQ(result.size(), 100u);
+}
+
+// Test the engine keeps the world grid up to date each step
+TEST_F(SpatialHashGridTest, EngineUpdatesWorldGrid)
+{
+    auto world = std::make_unique<EmptySpace>();
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base), Position({0.0, 0.0, 0.0}, DecimalPrefix::Name::base),
+        Velocity({10.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world->addEntity(std::make_unique<PointMass>(
+        Mass(1.0, DecimalPrefix::Name::base), Position({5.0, 0.0, 0.0}, DecimalPrefix::Name::base)));
+    world->getSpatialHashGrid().setEnabled(true);
+    world->getSpatialHashGrid().setCellSize(1.0);
+    const IWorld *view = world.get();
+
+    auto logger = std::make_unique<FileLogger>("test_spatial_hash_grid.log", LogLevel::Info, true);
+    logger->disable();
+    Engine engine(std::move(logger), std::move(world));
+    for (int step = 0; step < 5; ++step)
+    {
+        engine.timeStep(0.1);
+    }
+    engine.timeStep(0.0);
+
+    // The first entity moved about 5 m onto the second one
+    std::vector<std::size_t> result;
+    view->getSpatialHashGrid().queryRadius({5.0, 0.0, -1.0}, 1.5, result);
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(result, (std::vector<std::size_t>{0u, 1u}));
+}
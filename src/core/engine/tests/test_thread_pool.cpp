@@ -0,0 +1,152 @@
+#include "Engine.h"
+#include "file_logger.h"
+#include "point_mass.h"
+#include "thread_pool.h"
+#include "world.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+
+// World with gravity along -z, in N/kg
+class ThreadPoolWorld : public World
+{
+  public:
+    ThreadPoolWorld() :
+        World(Volume(1000.0, 1000.0, 1000.0, DecimalPrefix::Name::base),
+              Force({0.0, 0.0, -10.0}, DecimalPrefix::Name::base))
+    {
+    }
+};
+
+// Test every index is visited exactly once
+TEST(ThreadPoolTest, VisitsEveryIndexOnce)
+{
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(10007);
+
+    pool.parallelFor(visits.size(), [&visits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for (const std::atomic<int> &count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+// Test the chunk count only depends on the range and the worker count
+TEST(ThreadPoolTest, ChunkCountIsDeterministic)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getWorkerCount(), 4u);
+    EXPECT_EQ(pool.getChunkCount(0), 0u);
+    EXPECT_EQ(pool.getChunkCount(3), 3u);
+    EXPECT_EQ(pool.getChunkCount(1000), 16u);
+    EXPECT_EQ(pool.getChunkCount(1000, 400), 3u);
+}
+
+// Test exceptions thrown on a worker and on the caller reach the caller after every chunk ran
+TEST(ThreadPoolTest, RethrowsChunkExceptions)
+{
+    ThreadPool pool(4);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<bool> workerThrew{false};
+    std::atomic<std::size_t> calls{0};
+
+    auto body = [&](std::size_t, std::size_t) {
+        ++calls;
+        if (std::this_thread::get_id() != caller)
+        {
+            workerThrew = true;
+            throw std::logic_error("worker");
+        }
+        // Hold the caller until a worker has thrown, so both kinds happen
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!workerThrew && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        throw std::runtime_error("caller");
+    };
+    EXPECT_THROW(pool.parallelFor(1000, body), std::exception);
+    EXPECT_TRUE(workerThrew);
+    EXPECT_EQ(calls.load(), pool.getChunkCount(1000));
+
+    // The pool is still usable
+    std::atomic<std::size_t> visited{0};
+    pool.parallelFor(1000, [&visited](std::size_t begin, std::size_t end) {
+        visited += end - begin;
+    });
+    EXPECT_EQ(visited.load(), 1000u);
+}
+
+// Test a single worker runs the whole range inline on the caller
+TEST(ThreadPoolTest, SingleWorkerRunsInline)
+{
+    ThreadPool pool(0);
+    EXPECT_EQ(pool.getWorkerCount(), 1u);
+
+    std::size_t calls = 0;
+    pool.parallelFor(100, [&calls](std::size_t begin, std::size_t end) {
+        ++calls;
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 100u);
+    });
+    EXPECT_EQ(calls, 1u);
+
+    pool.parallelFor(0, [&calls](std::size_t, std::size_t) { ++calls; });
+    EXPECT_EQ(calls, 1u);
+}
+
+// Test a chunked step gives bit-identical results to a serial one
+TEST(ThreadPoolTest, ParallelStepMatchesSerial)
+{
+    const std::size_t entityCount = 3 * Integrator::MIN_CHUNK_SIZE + 17;
+    std::vector<const IWorld *> worlds;
+    std::vector<std::unique_ptr<Engine>> engines;
+
+    for (std::size_t workerCount : {1u, 4u})
+    {
+        auto world = std::make_unique<ThreadPoolWorld>();
+        for (std::size_t i = 0; i < entityCount; ++i)
+        {
+            const double offset = 0.001 * static_cast<double>(i);
+            world->addEntity(std::make_unique<PointMass>(
+                Mass(1.0 + offset, DecimalPrefix::Name::base),
+                Position({offset, -offset, 10.0}, DecimalPrefix::Name::base),
+                Velocity({1.0, offset, 0.0}, DecimalPrefix::Name::base)));
+        }
+        worlds.push_back(world.get());
+
+        auto logger = std::make_unique<FileLogger>("test_thread_pool.log", LogLevel::Info, true);
+        auto engine = std::make_unique<Engine>(std::move(logger), std::move(world));
+        engine->setWorkerCount(workerCount);
+        engine->setIntegrator(IntegratorType::RungeKutta4);
+        for (int step = 0; step < 5; ++step)
+        {
+            engine->timeStep(0.01);
+        }
+        engines.push_back(std::move(engine));
+    }
+
+    EXPECT_EQ(engines[1]->getWorkerCount(), 4u);
+    const EntityStore &serial   = worlds[0]->getEntityStore();
+    const EntityStore &parallel = worlds[1]->getEntityStore();
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        for (std::size_t i = 0; i < entityCount; ++i)
+        {
+            ASSERT_EQ(serial.positions()[axis][i], parallel.positions()[axis][i]);
+            ASSERT_EQ(serial.velocities()[axis][i], parallel.velocities()[axis][i]);
+        }
+    }
+}
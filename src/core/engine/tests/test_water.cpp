@@ -0,0 +1,78 @@
+#include "liquid.h"
+#include "water.h"
+#include "gtest/gtest.h"
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace InertiaFX::Core::Engine;
+using namespace InertiaFX::Core::SI;
+
+// Test fixture for the Water class
+class WaterTest : public ::testing::Test
+{
+  protected:
+    Position position{{1.0, 2.0, 3.0}, DecimalPrefix::Name::base};
+    Volume volume{2.0, 2.0, 2.0, DecimalPrefix::Name::base};
+};
+
+// Move operations must not throw so containers relocate instead of copying
+TEST_F(WaterTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Water>);
+    static_assert(std::is_nothrow_move_assignable_v<Water>);
+    static_assert(std::is_nothrow_move_constructible_v<Liquid>);
+    static_assert(std::is_nothrow_move_assignable_v<Liquid>);
+}
+
+// Test the move constructor takes over position, volume and material
+TEST_F(WaterTest, MoveConstructor)
+{
+    Water source(position, volume);
+    Water moved(std::move(source));
+
+    EXPECT_TRUE(moved.getPosition() == position);
+    EXPECT_TRUE(moved.getVolume() == volume);
+    ASSERT_NE(moved.getMaterial(), nullptr);
+    EXPECT_DOUBLE_EQ(moved.getMaterial()->getVolume().getValue(), 8.0);
+}
+
+// Test the move assignment takes over position, volume and material
+TEST_F(WaterTest, MoveAssignment)
+{
+    Water source(position, volume);
+    Water assigned;
+    assigned = std::move(source);
+
+    EXPECT_TRUE(assigned.getPosition() == position);
+    EXPECT_TRUE(assigned.getVolume() == volume);
+    ASSERT_NE(assigned.getMaterial(), nullptr);
+}
+
+// Test the copy assignment copies position, volume and material
+TEST_F(WaterTest, CopyAssignment)
+{
+    Water source(position, volume);
+    Water assigned;
+    assigned = source;
+
+    EXPECT_TRUE(assigned.getPosition() == position);
+    EXPECT_TRUE(assigned.getVolume() == volume);
+    ASSERT_NE(assigned.getMaterial(), nullptr);
+}
+
+// Test a vector of Water can grow without losing its elements
+TEST_F(WaterTest, VectorGrowth)
+{
+    std::vector<Water> waters;
+    for (int i = 0; i < 16; ++i)
+    {
+        waters.emplace_back(position, volume);
+    }
+
+    for (const Water &water : waters)
+    {
+        EXPECT_TRUE(water.getPosition() == position);
+        ASSERT_NE(water.getMaterial(), nullptr);
+    }
+}
@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_ACCELERATION_H
 
 #include "derived_vector_qty.h"
+#include "quantity.h"
 #include <array>
 
 namespace InertiaFX
@@ -42,6 +43,12 @@ namespace Core
         class Acceleration : public DerivedVectorQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Acceleration quantity.
+             * @return A reference to the process-wide, immutable Acceleration descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Acceleration object.
              *
@@ -72,6 +79,14 @@ namespace Core
             Acceleration(std::array<double, 3> value,
                          DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Acceleration object from a AccelerationQty.
+             * @param quantity The acceleration, in base units.
+             *
+             * The acceleration is stored in base prefix value.
+             */
+            explicit Acceleration(const AccelerationQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Acceleration object from an existing one.
@@ -91,6 +106,23 @@ namespace Core
              */
             Acceleration &operator=(const Acceleration &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Acceleration object by taking over the state of an existing one.
+             *
+             * @param other The other Acceleration object to move from.
+             */
+            Acceleration(Acceleration &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Acceleration object with that of an existing one.
+             *
+             * @param other The other Acceleration object to move from.
+             * @return A reference to this object.
+             */
+            Acceleration &operator=(Acceleration &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Acceleration objects together.
@@ -108,8 +140,81 @@ namespace Core
              * @return True if the objects are equal, false otherwise.
              */
             bool operator==(const Acceleration &other) const;
+
+            /**
+             * @brief Addition assignment operator.
+             * @details Adds another Acceleration object to this one in place.
+             *
+             * @param other The other Acceleration object to add.
+             * @return A reference to this object.
+             */
+            Acceleration &operator+=(const Acceleration &other);
+
+            /**
+             * @brief Subtraction assignment operator.
+             * @details Subtracts another Acceleration object from this one in place.
+             *
+             * @param other The other Acceleration object to subtract.
+             * @return A reference to this object.
+             */
+            Acceleration &operator-=(const Acceleration &other);
+
+            /**
+             * @brief Subtraction operator.
+             * @param other The other Acceleration object to subtract.
+             * @return A new Acceleration object representing the difference.
+             */
+            Acceleration operator-(const Acceleration &other) const;
+
+            /**
+             * @brief Unary negation operator.
+             * @return A new Acceleration object pointing in the opposite direction.
+             */
+            Acceleration operator-() const;
+
+            /**
+             * @brief Scalar multiplication assignment operator.
+             * @param factor The dimensionless factor to scale this acceleration by.
+             * @return A reference to this object.
+             */
+            Acceleration &operator*=(double factor);
+
+            /**
+             * @brief Scalar division assignment operator.
+             * @param divisor The dimensionless divisor to scale this acceleration by.
+             * @return A reference to this object.
+             */
+            Acceleration &operator/=(double divisor);
+
+            /**
+             * @brief Scalar multiplication operator.
+             * @param factor The dimensionless factor to scale by.
+             * @return A new Acceleration object representing the scaled acceleration.
+             */
+            Acceleration operator*(double factor) const;
+
+            /**
+             * @brief Scalar division operator.
+             * @param divisor The dimensionless divisor to scale by.
+             * @return A new Acceleration object representing the scaled acceleration.
+             */
+            Acceleration operator/(double divisor) const;
+
+            /**
+             * @brief Converts the acceleration into its compile-time dimensioned counterpart.
+             * @return The acceleration as a AccelerationQty, in base units.
+             */
+            AccelerationQty toQuantity() const;
         };
 
+        /**
+         * @brief Scalar multiplication operator with the factor on the left-hand side.
+         * @param factor The dimensionless factor to scale by.
+         * @param acceleration The Acceleration object to scale.
+         * @return A new Acceleration object representing the scaled acceleration.
+         */
+        Acceleration operator*(double factor, const Acceleration &acceleration);
+
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -30,8 +30,11 @@
 #ifndef INERTIAFX_CORE_SI_DECIMALPREFIX_H
 #define INERTIAFX_CORE_SI_DECIMALPREFIX_H
 
+#include <array>
 #include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace InertiaFX
 {
@@ -145,6 +148,13 @@ namespace Core
              */
             static std::string getSymbol(Name prefix);
 
+            /**
+             * @brief Returns the symbol (e.g. "m") for the specified prefix name, without a copy.
+             * @param prefix Enum value representing the decimal prefix name.
+             * @return A view of a string literal containing the prefix symbol.
+             */
+            static std::string_view getSymbolView(Name prefix);
+
             /**
              * @brief Returns the symbol (e.g. "m") for the specified prefix symbol.
              * @param prefix Enum value representing the decimal prefix symbol.
@@ -157,14 +167,103 @@ namespace Core
              * @param prefix Enum value representing the decimal prefix symbol.
              * @return A double containing the multiplier (10^exponent).
              */
-            static double getMultiplier(Symbol prefix);
+            static constexpr double getMultiplier(Symbol prefix)
+            {
+                return getPowerOfTen(static_cast<int>(prefix));
+            }
 
             /**
              * @brief Returns the decimal multiplier for the specified prefix name.
              * @param prefix Enum value representing the decimal prefix name.
              * @return A double containing the multiplier (10^exponent).
              */
-            static double getMultiplier(Name prefix);
+            static constexpr double getMultiplier(Name prefix)
+            {
+                return getPowerOfTen(static_cast<int>(prefix));
+            }
+
+            /**
+             * @brief Rescales values in place from one prefix to another.
+             * @param values The values to rescale, expressed in prefix 'from'.
+             * @param from The decimal prefix name the values are currently expressed in.
+             * @param to The decimal prefix name the values will be expressed in.
+             *
+             * The conversion factor is the exact power of ten of the exponent difference, applied
+             * in a single pass.
+             */
+            static void rescale(std::span<double> values, Name from, Name to);
+
+            /**
+             * @brief Rescales values in place from one prefix to another.
+             * @param values The values to rescale, expressed in prefix 'from'.
+             * @param from The decimal prefix symbol the values are currently expressed in.
+             * @param to The decimal prefix symbol the values will be expressed in.
+             *
+             * The conversion factor is the exact power of ten of the exponent difference, applied
+             * in a single pass.
+             */
+            static void rescale(std::span<double> values, Symbol from, Symbol to);
+
+            /**
+             * @brief Rescales vectors in place from one prefix to another.
+             * @param values The vectors to rescale, expressed in prefix 'from'.
+             * @param from The decimal prefix name the vectors are currently expressed in.
+             * @param to The decimal prefix name the vectors will be expressed in.
+             *
+             * The conversion factor is the exact power of ten of the exponent difference, applied
+             * in a single pass.
+             */
+            static void rescale(std::span<std::array<double, 3>> values, Name from, Name to);
+
+            /**
+             * @brief Rescales vectors in place from one prefix to another.
+             * @param values The vectors to rescale, expressed in prefix 'from'.
+             * @param from The decimal prefix symbol the vectors are currently expressed in.
+             * @param to The decimal prefix symbol the vectors will be expressed in.
+             *
+             * The conversion factor is the exact power of ten of the exponent difference, applied
+             * in a single pass.
+             */
+            static void rescale(std::span<std::array<double, 3>> values, Symbol from, Symbol to);
+
+          private:
+            static constexpr int _minExponent = -60;  //!< Smallest exponent in the table.
+
+            /**
+             * @brief Returns the power of ten for an exponent.
+             * @param exponent Exponent in [-60, 60], i.e. any prefix or difference of two.
+             * @return The correctly rounded 10^exponent.
+             */
+            static constexpr double getPowerOfTen(int exponent)
+            {
+                return _multipliers[exponent - _minExponent];
+            }
+
+            /**
+             * @brief Powers of ten indexed by exponent - _minExponent.
+             *
+             * Written as literals so every multiplier is the correctly rounded power of ten. The
+             * table also covers exponents with no prefix, which keeps the lookup a single index,
+             * and every difference of two prefixes, so a rescale factor is one exact entry too.
+             */
+            static constexpr std::array<double, 121> _multipliers = {
+                1e-60, 1e-59, 1e-58, 1e-57, 1e-56, 1e-55, 1e-54, 1e-53,
+                1e-52, 1e-51, 1e-50, 1e-49, 1e-48, 1e-47, 1e-46, 1e-45,
+                1e-44, 1e-43, 1e-42, 1e-41, 1e-40, 1e-39, 1e-38, 1e-37,
+                1e-36, 1e-35, 1e-34, 1e-33, 1e-32, 1e-31, 1e-30, 1e-29,
+                1e-28, 1e-27, 1e-26, 1e-25, 1e-24, 1e-23, 1e-22, 1e-21,
+                1e-20, 1e-19, 1e-18, 1e-17, 1e-16, 1e-15, 1e-14, 1e-13,
+                1e-12, 1e-11, 1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5,
+                1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3,
+                1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                1e20, 1e21, 1e22, 1e23, 1e24, 1e25, 1e26, 1e27,
+                1e28, 1e29, 1e30, 1e31, 1e32, 1e33, 1e34, 1e35,
+                1e36, 1e37, 1e38, 1e39, 1e40, 1e41, 1e42, 1e43,
+                1e44, 1e45, 1e46, 1e47, 1e48, 1e49, 1e50, 1e51,
+                1e52, 1e53, 1e54, 1e55, 1e56, 1e57, 1e58, 1e59,
+                1e60
+            };
         };
     }  // namespace SI
 }  // namespace Core
@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_DENSITY_H
 
 #include "derived_scalar_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -41,6 +42,12 @@ namespace Core
         class Density : public DerivedScalarQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Density quantity.
+             * @return A reference to the process-wide, immutable Density descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Density object.
              *
@@ -68,6 +75,14 @@ namespace Core
              */
             Density(double value, DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Density object from a DensityQty.
+             * @param quantity The density, in base units.
+             *
+             * The density is stored in base prefix value.
+             */
+            explicit Density(const DensityQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Density object from an existing one.
@@ -87,6 +102,23 @@ namespace Core
              */
             Density &operator=(const Density &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Density object by taking over the state of an existing one.
+             *
+             * @param other The other Density object to move from.
+             */
+            Density(Density &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Density object with that of an existing one.
+             *
+             * @param other The other Density object to move from.
+             * @return A reference to this object.
+             */
+            Density &operator=(Density &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Density objects together.
@@ -104,6 +136,12 @@ namespace Core
              * @return True if the objects are equal, false otherwise.
              */
             bool operator==(const Density &other) const;
+
+            /**
+             * @brief Converts the density into its compile-time dimensioned counterpart.
+             * @return The density as a DensityQty, in base units.
+             */
+            DensityQty toQuantity() const;
         };
 
     }  // namespace SI
@@ -27,9 +27,10 @@
 #define INERTIAFX_CORE_SI_DERIVED_VECTOR_QTY_H
 
 #include "decimal_prefix.h"
-#include "iphysical_unit.h"
 #include "ivector_qty.h"
+#include "quantity_descriptor.h"
 #include <array>
+#include <cmath>
 #include <string>
 
 namespace InertiaFX
@@ -48,49 +49,41 @@ namespace Core
           public:
             /**
              * @brief Constructs a new DerivedVectorQty object.
-             * @param name The name of the physical quantity (e.g., "Velocity", "Acceleration").
-             * @param symbol The symbol of the physical quantity (e.g., "v", "a").
-             * @param description A short description of this quantity.
-             * @param unit The IPhysicalUnit defining the base unit info for this quantity.
+             * @param descriptor The shared descriptor (name, symbol, description and base unit)
+             * of the concrete quantity type. It must outlive this object.
              */
-            DerivedVectorQty(const std::string &name, const std::string &symbol,
-                             const std::string &description, std::unique_ptr<IPhysicalUnit> unit) :
-                _name(name), _symbol(symbol), _description(description), _value(0),
-                _unit(std::move(unit)), _prefix(DecimalPrefix::Name::base)
+            explicit DerivedVectorQty(const QuantityDescriptor &descriptor) :
+                _descriptor(&descriptor), _value{0.0, 0.0, 0.0},
+                _prefix(DecimalPrefix::Name::base)
             {
             }
 
             /**
-             * @brief Constructs a new FundamentalQty object by copying another instance.
+             * @brief Constructs a new DerivedVectorQty object by copying another instance.
+             * @details The descriptor is shared, so copying never allocates.
              * @param other The other instance to copy from.
              */
-            DerivedVectorQty(const DerivedVectorQty &other)
-            {
-                // If other._unit is not null, clone it; else store null
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty(const DerivedVectorQty &other) = default;
 
             /**
              * @brief Assignment operator for copying another DerivedVectorQty instance.
              * @param other The other instance to copy from.
              * @return A reference to this object.
              */
-            DerivedVectorQty &operator=(const DerivedVectorQty &other)
-            {
-                if (this != &other)
-                {
-                    // If there's an existing owned object, remove it
-                    _unit.reset();
-
-                    // Deep-copy from other
-                    if (other._unit)
-                    {
-                        _unit = std::unique_ptr<IPhysicalUnit>(other._unit->clone());
-                    }
-                }
-                return *this;
-            }
+            DerivedVectorQty &operator=(const DerivedVectorQty &other) = default;
+
+            /**
+             * @brief Constructs a new DerivedVectorQty object by moving another instance.
+             * @param other The other instance to move from.
+             */
+            DerivedVectorQty(DerivedVectorQty &&other) noexcept = default;
+
+            /**
+             * @brief Assignment operator for moving another DerivedVectorQty instance.
+             * @param other The other instance to move from.
+             * @return A reference to this object.
+             */
+            DerivedVectorQty &operator=(DerivedVectorQty &&other) noexcept = default;
 
             /**
              * @brief Virtual destructor.
@@ -102,7 +95,7 @@ namespace Core
              */
             std::string getName() const override
             {
-                return _name;
+                return _descriptor->name;
             }
 
             /**
@@ -110,7 +103,7 @@ namespace Core
              */
             std::string getSymbol() const override
             {
-                return _symbol;
+                return _descriptor->symbol;
             }
 
             /**
@@ -118,7 +111,7 @@ namespace Core
              */
             std::string getDescription() const override
             {
-                return _description;
+                return _descriptor->description;
             }
 
             /**
@@ -134,7 +127,7 @@ namespace Core
              */
             std::string getUnitName() const override
             {
-                return _unit->getName();
+                return _descriptor->unit->getName();
             }
 
             /**
@@ -142,7 +135,7 @@ namespace Core
              */
             std::string getUnitPluralName() const override
             {
-                return _unit->getPluralName();
+                return _descriptor->unit->getPluralName();
             }
 
             /**
@@ -150,7 +143,7 @@ namespace Core
              */
             std::string getUnitSymbol() const override
             {
-                return _unit->getSymbol();
+                return _descriptor->unit->getSymbol();
             }
 
             /**
@@ -158,7 +151,7 @@ namespace Core
              */
             std::string getUnitDescription() const override
             {
-                return _unit->getDescription();
+                return _descriptor->unit->getDescription();
             }
 
             /**
@@ -174,10 +167,11 @@ namespace Core
              */
             std::array<double, 3> getValueIn(DecimalPrefix::Name prefix) const
             {
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
                 std::array<double, 3> scaledValue;
-                scaledValue[0] = _value[0] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[1] = _value[1] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[2] = _value[2] / DecimalPrefix::getMultiplier(prefix);
+                scaledValue[0] = _value[0] / multiplier;
+                scaledValue[1] = _value[1] / multiplier;
+                scaledValue[2] = _value[2] / multiplier;
                 return scaledValue;
             }
 
@@ -186,13 +180,32 @@ namespace Core
              */
             std::array<double, 3> getValueIn(DecimalPrefix::Symbol prefix) const
             {
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
                 std::array<double, 3> scaledValue;
-                scaledValue[0] = _value[0] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[1] = _value[1] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[2] = _value[2] / DecimalPrefix::getMultiplier(prefix);
+                scaledValue[0] = _value[0] / multiplier;
+                scaledValue[1] = _value[1] / multiplier;
+                scaledValue[2] = _value[2] / multiplier;
                 return scaledValue;
             }
 
+            /**
+             * @brief Retrieves the decimal prefix the value was last given in.
+             * @return The prefix name; base after setValue() or arithmetic.
+             */
+            DecimalPrefix::Name getPrefix() const
+            {
+                return _prefix;
+            }
+
+            /**
+             * @brief Retrieves the descriptor shared by every instance of the quantity.
+             * @return The descriptor, valid for the lifetime of the program.
+             */
+            const QuantityDescriptor &getDescriptor() const
+            {
+                return *_descriptor;
+            }
+
             /**
              * @copydoc IScalarQty::setValue(double)
              */
@@ -207,10 +220,11 @@ namespace Core
              */
             void setValueFrom(std::array<double, 3> newValue, DecimalPrefix::Name prefix)
             {
-                _value[0] = newValue[0] * DecimalPrefix::getMultiplier(prefix);
-                _value[1] = newValue[1] * DecimalPrefix::getMultiplier(prefix);
-                _value[2] = newValue[2] * DecimalPrefix::getMultiplier(prefix);
-                _prefix   = prefix;
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
+                _value[0]               = newValue[0] * multiplier;
+                _value[1]               = newValue[1] * multiplier;
+                _value[2]               = newValue[2] * multiplier;
+                _prefix                 = prefix;
             }
 
             /**
@@ -218,10 +232,11 @@ namespace Core
              */
             void setValueFrom(std::array<double, 3> newValue, DecimalPrefix::Symbol prefix)
             {
-                _value[0] = newValue[0] * DecimalPrefix::getMultiplier(prefix);
-                _value[1] = newValue[1] * DecimalPrefix::getMultiplier(prefix);
-                _value[2] = newValue[2] * DecimalPrefix::getMultiplier(prefix);
-                _prefix   = static_cast<DecimalPrefix::Name>(prefix);
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
+                _value[0]               = newValue[0] * multiplier;
+                _value[1]               = newValue[1] * multiplier;
+                _value[2]               = newValue[2] * multiplier;
+                _prefix                 = static_cast<DecimalPrefix::Name>(prefix);
             }
 
             // toString()
@@ -236,10 +251,11 @@ namespace Core
             // toString(DecimalPrefix::Name)
             std::string toString(DecimalPrefix::Name prefix) const
             {
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
                 std::array<double, 3> scaledValue;
-                scaledValue[0] = _value[0] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[1] = _value[1] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[2] = _value[2] / DecimalPrefix::getMultiplier(prefix);
+                scaledValue[0] = _value[0] / multiplier;
+                scaledValue[1] = _value[1] / multiplier;
+                scaledValue[2] = _value[2] / multiplier;
 
                 // Build something like: "12.3 km"
                 return "(" + std::to_string(_value[0]) + ", " + std::to_string(_value[1]) + ", " +
@@ -250,10 +266,11 @@ namespace Core
             // toString(DecimalPrefix::Symbol)
             std::string toString(DecimalPrefix::Symbol prefix) const
             {
+                const double multiplier = DecimalPrefix::getMultiplier(prefix);
                 std::array<double, 3> scaledValue;
-                scaledValue[0] = _value[0] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[1] = _value[1] / DecimalPrefix::getMultiplier(prefix);
-                scaledValue[2] = _value[2] / DecimalPrefix::getMultiplier(prefix);
+                scaledValue[0] = _value[0] / multiplier;
+                scaledValue[1] = _value[1] / multiplier;
+                scaledValue[2] = _value[2] / multiplier;
 
                 // Build something like: "12.3 km"
                 return "(" + std::to_string(_value[0]) + ", " + std::to_string(_value[1]) + ", " +
@@ -261,14 +278,104 @@ namespace Core
                        this->getUnitSymbol() + ")";
             }
 
+            /**
+             * @brief Computes the dot product with another vector quantity.
+             * @param other The other vector quantity.
+             * @return The dot product of both values, in base units.
+             */
+            double dot(const DerivedVectorQty &other) const
+            {
+                return _value[0] * other._value[0] + _value[1] * other._value[1] +
+                       _value[2] * other._value[2];
+            }
+
+            /**
+             * @brief Computes the cross product with another vector quantity.
+             * @param other The other vector quantity.
+             * @return The cross product of both values, in base units. The result has the
+             * dimension of the product of both quantities, so it is returned as a raw vector.
+             */
+            std::array<double, 3> cross(const DerivedVectorQty &other) const
+            {
+                return {_value[1] * other._value[2] - _value[2] * other._value[1],
+                        _value[2] * other._value[0] - _value[0] * other._value[2],
+                        _value[0] * other._value[1] - _value[1] * other._value[0]};
+            }
+
+            /**
+             * @brief Computes the squared Euclidean norm, avoiding the square root.
+             * @return The squared norm, in squared base units.
+             */
+            double squaredNorm() const
+            {
+                return dot(*this);
+            }
+
+            /**
+             * @brief Computes the Euclidean norm (magnitude).
+             * @return The norm, in base units.
+             */
+            double norm() const
+            {
+                return std::sqrt(squaredNorm());
+            }
+
+            /**
+             * @brief Scales the value in place to unit length.
+             * @details A zero vector is left unchanged. The prefix is reset to base.
+             */
+            void normalise()
+            {
+                const double length = norm();
+                if (length > 0.0)
+                {
+                    scaleInPlace(1.0 / length);
+                }
+            }
+
           protected:
-            std::string _name;             //!< @brief Name of the quantity
-            std::string _symbol;           //!< @brief Symbol of the quantity
-            std::string _description;      //!< @brief Description of the quantity
-            std::array<double, 3> _value;  //!< @brief Internal value storage
-            std::unique_ptr<IPhysicalUnit>
-                _unit;                    //!< @brief Defines the base unit of this quantity
-            DecimalPrefix::Name _prefix;  //!< @brief Current decimal prefix
+            /**
+             * @brief Adds another value in place, in base units, and resets the prefix.
+             * @param other The value to add.
+             */
+            void addInPlace(const std::array<double, 3> &other)
+            {
+                _value[0] += other[0];
+                _value[1] += other[1];
+                _value[2] += other[2];
+
+                _prefix = DecimalPrefix::Name::base;
+            }
+
+            /**
+             * @brief Subtracts another value in place, in base units, and resets the prefix.
+             * @param other The value to subtract.
+             */
+            void subtractInPlace(const std::array<double, 3> &other)
+            {
+                _value[0] -= other[0];
+                _value[1] -= other[1];
+                _value[2] -= other[2];
+
+                _prefix = DecimalPrefix::Name::base;
+            }
+
+            /**
+             * @brief Multiplies the value in place by a factor and resets the prefix.
+             * @param factor The dimensionless scale factor.
+             */
+            void scaleInPlace(double factor)
+            {
+                _value[0] *= factor;
+                _value[1] *= factor;
+                _value[2] *= factor;
+
+                _prefix = DecimalPrefix::Name::base;
+            }
+
+            const QuantityDescriptor *_descriptor;  //!< @brief Shared quantity descriptor
+            std::array<double, 3> _value;           //!< @brief Internal value storage
+            DecimalPrefix::Name _prefix;            //!< @brief Current decimal prefix
         };
 
     }  // namespace SI
@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_FORCE_H
 
 #include "derived_vector_qty.h"
+#include "quantity.h"
 #include <array>
 
 namespace InertiaFX
@@ -42,6 +43,12 @@ namespace Core
         class Force : public DerivedVectorQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Force quantity.
+             * @return A reference to the process-wide, immutable Force descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Force object.
              *
@@ -71,6 +78,14 @@ namespace Core
             Force(std::array<double, 3> value,
                   DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Force object from a ForceQty.
+             * @param quantity The force, in base units.
+             *
+             * The force is stored in base prefix value.
+             */
+            explicit Force(const ForceQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Force object from an existing one.
@@ -90,6 +105,23 @@ namespace Core
              */
             Force &operator=(const Force &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Force object by taking over the state of an existing one.
+             *
+             * @param other The other Force object to move from.
+             */
+            Force(Force &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Force object with that of an existing one.
+             *
+             * @param other The other Force object to move from.
+             * @return A reference to this object.
+             */
+            Force &operator=(Force &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Force objects together.
@@ -107,8 +139,81 @@ namespace Core
              * @return True if the objects are equal, false otherwise.
              */
             bool operator==(const Force &other) const;
+
+            /**
+             * @brief Addition assignment operator.
+             * @details Adds another Force object to this one in place.
+             *
+             * @param other The other Force object to add.
+             * @return A reference to this object.
+             */
+            Force &operator+=(const Force &other);
+
+            /**
+             * @brief Subtraction assignment operator.
+             * @details Subtracts another Force object from this one in place.
+             *
+             * @param other The other Force object to subtract.
+             * @return A reference to this object.
+             */
+            Force &operator-=(const Force &other);
+
+            /**
+             * @brief Subtraction operator.
+             * @param other The other Force object to subtract.
+             * @return A new Force object representing the difference.
+             */
+            Force operator-(const Force &other) const;
+
+            /**
+             * @brief Unary negation operator.
+             * @return A new Force object pointing in the opposite direction.
+             */
+            Force operator-() const;
+
+            /**
+             * @brief Scalar multiplication assignment operator.
+             * @param factor The dimensionless factor to scale this force by.
+             * @return A reference to this object.
+             */
+            Force &operator*=(double factor);
+
+            /**
+             * @brief Scalar division assignment operator.
+             * @param divisor The dimensionless divisor to scale this force by.
+             * @return A reference to this object.
+             */
+            Force &operator/=(double divisor);
+
+            /**
+             * @brief Scalar multiplication operator.
+             * @param factor The dimensionless factor to scale by.
+             * @return A new Force object representing the scaled force.
+             */
+            Force operator*(double factor) const;
+
+            /**
+             * @brief Scalar division operator.
+             * @param divisor The dimensionless divisor to scale by.
+             * @return A new Force object representing the scaled force.
+             */
+            Force operator/(double divisor) const;
+
+            /**
+             * @brief Converts the force into its compile-time dimensioned counterpart.
+             * @return The force as a ForceQty, in base units.
+             */
+            ForceQty toQuantity() const;
         };
 
+        /**
+         * @brief Scalar multiplication operator with the factor on the left-hand side.
+         * @param factor The dimensionless factor to scale by.
+         * @param force The Force object to scale.
+         * @return A new Force object representing the scaled force.
+         */
+        Force operator*(double factor, const Force &force);
+
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
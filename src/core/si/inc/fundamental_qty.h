@@ -27,8 +27,8 @@
 #define INERTIAFX_CORE_SI_FUNDAMENTALQTY_H
 
 #include "decimal_prefix.h"
-#include "iphysical_unit.h"
 #include "iscalar_qty.h"
+#include "quantity_descriptor.h"
 #include <string>
 
 namespace InertiaFX
@@ -46,50 +46,41 @@ namespace Core
           public:
             /**
              * @brief Constructs a new FundamentalQty object.
-             * @param name The name of the physical quantity (e.g., "Length", "Mass").
-             * @param symbol The symbol of the physical quantity (e.g., "L", "m").
-             * @param description A short description of this quantity.
-             * @param unit The IPhysicalUnit defining the base unit info for this quantity.
+             * @param descriptor The shared descriptor (name, symbol, description and base unit)
+             * of the concrete quantity type. It must outlive this object.
              */
-            FundamentalQty(const std::string &name, const std::string &symbol,
-                           const std::string &description, std::unique_ptr<IPhysicalUnit> unit) :
-                _name(name), _symbol(symbol), _description(description),
-                _value(static_cast<double>(0)), _unit(std::move(unit)),
+            explicit FundamentalQty(const QuantityDescriptor &descriptor) :
+                _descriptor(&descriptor), _value(static_cast<double>(0)),
                 _prefix(DecimalPrefix::Name::base)
             {
             }
 
             /**
              * @brief Constructs a new FundamentalQty object by copying another instance.
+             * @details The descriptor is shared, so copying never allocates.
              * @param other The other instance to copy from.
              */
-            FundamentalQty(const FundamentalQty &other)
-            {
-                // If other._unit is not null, clone it; else store null
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            FundamentalQty(const FundamentalQty &other) = default;
 
             /**
-             * @brief Assignment operator for deep-copying another instance.
+             * @brief Assignment operator for copying another FundamentalQty instance.
              * @param other The other instance to copy from.
              * @return A reference to this object.
              */
-            FundamentalQty &operator=(const FundamentalQty &other)
-            {
-                if (this != &other)
-                {
-                    // If there's an existing owned object, remove it
-                    _unit.reset();
-
-                    // Deep-copy from other
-                    if (other._unit)
-                    {
-                        _unit = std::unique_ptr<IPhysicalUnit>(other._unit->clone());
-                    }
-                }
-                return *this;
-            }
+            FundamentalQty &operator=(const FundamentalQty &other) = default;
+
+            /**
+             * @brief Constructs a new FundamentalQty object by moving another instance.
+             * @param other The other instance to move from.
+             */
+            FundamentalQty(FundamentalQty &&other) noexcept = default;
+
+            /**
+             * @brief Assignment operator for moving another FundamentalQty instance.
+             * @param other The other instance to move from.
+             * @return A reference to this object.
+             */
+            FundamentalQty &operator=(FundamentalQty &&other) noexcept = default;
 
             /**
              * @brief Virtual destructor.
@@ -101,7 +92,7 @@ namespace Core
              */
             std::string getName() const override
             {
-                return _name;
+                return _descriptor->name;
             }
 
             /**
@@ -109,7 +100,7 @@ namespace Core
              */
             std::string getSymbol() const override
             {
-                return _symbol;
+                return _descriptor->symbol;
             }
 
             /**
@@ -117,7 +108,7 @@ namespace Core
              */
             std::string getDescription() const override
             {
-                return _description;
+                return _descriptor->description;
             }
 
             /**
@@ -133,7 +124,7 @@ namespace Core
              */
             std::string getUnitName() const override
             {
-                return _unit->getName();
+                return _descriptor->unit->getName();
             }
 
             /**
@@ -141,7 +132,7 @@ namespace Core
              */
             std::string getUnitPluralName() const override
             {
-                return _unit->getPluralName();
+                return _descriptor->unit->getPluralName();
             }
 
             /**
@@ -149,7 +140,7 @@ namespace Core
              */
             std::string getUnitSymbol() const override
             {
-                return _unit->getSymbol();
+                return _descriptor->unit->getSymbol();
             }
 
             /**
@@ -157,7 +148,7 @@ namespace Core
              */
             std::string getUnitDescription() const override
             {
-                return _unit->getDescription();
+                return _descriptor->unit->getDescription();
             }
 
             /**
@@ -184,6 +175,24 @@ namespace Core
                 return _value / DecimalPrefix::getMultiplier(prefix);
             }
 
+            /**
+             * @brief Retrieves the decimal prefix the value was last given in.
+             * @return The prefix name; base after setValue().
+             */
+            DecimalPrefix::Name getPrefix() const
+            {
+                return _prefix;
+            }
+
+            /**
+             * @brief Retrieves the descriptor shared by every instance of the quantity.
+             * @return The descriptor, valid for the lifetime of the program.
+             */
+            const QuantityDescriptor &getDescriptor() const
+            {
+                return *_descriptor;
+            }
+
             /**
              * @copydoc IScalarQty::setValue(double)
              */
@@ -240,13 +249,9 @@ namespace Core
             }
 
           protected:
-            std::string _name;         //!< @brief Name of the quantity
-            std::string _symbol;       //!< @brief Symbol of the quantity
-            std::string _description;  //!< @brief Description of the quantity
-            double _value;             //!< @brief Internal value storage
-            std::unique_ptr<IPhysicalUnit>
-                _unit;                    //!< @brief Defines the base unit of this quantity
-            DecimalPrefix::Name _prefix;  //!< @brief Current decimal prefix
+            const QuantityDescriptor *_descriptor;  //!< @brief Shared quantity descriptor
+            double _value;                          //!< @brief Internal value storage
+            DecimalPrefix::Name _prefix;            //!< @brief Current decimal prefix
         };
 
     }  // namespace SI
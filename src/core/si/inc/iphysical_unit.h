@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_IPHYSICALUNIT_H
 
 #include "decimal_prefix.h"
+#include <memory>
 #include <string>
 
 namespace InertiaFX
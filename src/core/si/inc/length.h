@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_LENGTH_H
 
 #include "fundamental_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -41,6 +42,12 @@ namespace Core
         class Length : public FundamentalQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Length quantity.
+             * @return A reference to the process-wide, immutable Length descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Length object.
              *
@@ -68,6 +75,14 @@ namespace Core
              */
             Length(double value, DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Length object from a LengthQty.
+             * @param quantity The length, in base units.
+             *
+             * The length is stored in base prefix value.
+             */
+            explicit Length(const LengthQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Length object from an existing one.
@@ -87,6 +102,23 @@ namespace Core
              */
             Length &operator=(const Length &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Length object by taking over the state of an existing one.
+             *
+             * @param other The other Length object to move from.
+             */
+            Length(Length &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Length object with that of an existing one.
+             *
+             * @param other The other Length object to move from.
+             * @return A reference to this object.
+             */
+            Length &operator=(Length &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Length objects together.
@@ -104,6 +136,12 @@ namespace Core
              * @return True if the Length objects are equal, false otherwise.
              */
             bool operator==(const Length &other) const;
+
+            /**
+             * @brief Converts the length into its compile-time dimensioned counterpart.
+             * @return The length as a LengthQty, in base units.
+             */
+            LengthQty toQuantity() const;
         };
 
     }  // namespace SI
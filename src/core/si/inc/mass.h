@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_MASS_H
 
 #include "fundamental_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -41,6 +42,12 @@ namespace Core
         class Mass : public FundamentalQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Mass quantity.
+             * @return A reference to the process-wide, immutable Mass descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Mass object.
              *
@@ -68,6 +75,14 @@ namespace Core
              */
             Mass(double value, DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Mass object from a MassQty.
+             * @param quantity The mass, in base units.
+             *
+             * The mass is stored in base prefix value.
+             */
+            explicit Mass(const MassQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Mass object from an existing one.
@@ -87,6 +102,23 @@ namespace Core
              */
             Mass &operator=(const Mass &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Mass object by taking over the state of an existing one.
+             *
+             * @param other The other Mass object to move from.
+             */
+            Mass(Mass &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Mass object with that of an existing one.
+             *
+             * @param other The other Mass object to move from.
+             * @return A reference to this object.
+             */
+            Mass &operator=(Mass &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Mass objects together.
@@ -104,6 +136,12 @@ namespace Core
              * @return True if the Mass objects are equal, false otherwise.
              */
             bool operator==(const Mass &other) const;
+
+            /**
+             * @brief Converts the mass into its compile-time dimensioned counterpart.
+             * @return The mass as a MassQty, in base units.
+             */
+            MassQty toQuantity() const;
         };
 
     }  // namespace SI
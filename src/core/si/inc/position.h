@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_POSITION_H
 
 #include "derived_vector_qty.h"
+#include "quantity.h"
 #include <array>
 
 namespace InertiaFX
@@ -42,6 +43,12 @@ namespace Core
         class Position : public DerivedVectorQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Position quantity.
+             * @return A reference to the process-wide, immutable Position descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Position object.
              * The position is initialized to (0.0, 0.0, 0.0) and stored in base prefix value.
@@ -70,6 +77,14 @@ namespace Core
             Position(std::array<double, 3> value,
                      DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Position object from a PositionQty.
+             * @param quantity The position, in base units.
+             *
+             * The position is stored in base prefix value.
+             */
+            explicit Position(const PositionQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Position object from an existing one.
@@ -89,6 +104,23 @@ namespace Core
              */
             Position &operator=(const Position &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Position object by taking over the state of an existing one.
+             *
+             * @param other The other Position object to move from.
+             */
+            Position(Position &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Position object with that of an existing one.
+             *
+             * @param other The other Position object to move from.
+             * @return A reference to this object.
+             */
+            Position &operator=(Position &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Position objects together.
@@ -106,8 +138,81 @@ namespace Core
              * @return True if the positions are equal, false otherwise.
              */
             bool operator==(const Position &other) const;
+
+            /**
+             * @brief Addition assignment operator.
+             * @details Adds another Position object to this one in place.
+             *
+             * @param other The other Position object to add.
+             * @return A reference to this object.
+             */
+            Position &operator+=(const Position &other);
+
+            /**
+             * @brief Subtraction assignment operator.
+             * @details Subtracts another Position object from this one in place.
+             *
+             * @param other The other Position object to subtract.
+             * @return A reference to this object.
+             */
+            Position &operator-=(const Position &other);
+
+            /**
+             * @brief Subtraction operator.
+             * @param other The other Position object to subtract.
+             * @return A new Position object representing the difference.
+             */
+            Position operator-(const Position &other) const;
+
+            /**
+             * @brief Unary negation operator.
+             * @return A new Position object pointing in the opposite direction.
+             */
+            Position operator-() const;
+
+            /**
+             * @brief Scalar multiplication assignment operator.
+             * @param factor The dimensionless factor to scale this position by.
+             * @return A reference to this object.
+             */
+            Position &operator*=(double factor);
+
+            /**
+             * @brief Scalar division assignment operator.
+             * @param divisor The dimensionless divisor to scale this position by.
+             * @return A reference to this object.
+             */
+            Position &operator/=(double divisor);
+
+            /**
+             * @brief Scalar multiplication operator.
+             * @param factor The dimensionless factor to scale by.
+             * @return A new Position object representing the scaled position.
+             */
+            Position operator*(double factor) const;
+
+            /**
+             * @brief Scalar division operator.
+             * @param divisor The dimensionless divisor to scale by.
+             * @return A new Position object representing the scaled position.
+             */
+            Position operator/(double divisor) const;
+
+            /**
+             * @brief Converts the position into its compile-time dimensioned counterpart.
+             * @return The position as a PositionQty, in base units.
+             */
+            PositionQty toQuantity() const;
         };
 
+        /**
+         * @brief Scalar multiplication operator with the factor on the left-hand side.
+         * @param factor The dimensionless factor to scale by.
+         * @param position The Position object to scale.
+         * @return A new Position object representing the scaled position.
+         */
+        Position operator*(double factor, const Position &position);
+
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
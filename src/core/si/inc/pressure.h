@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_PRESSURE_H
 
 #include "derived_vector_qty.h"
+#include "quantity.h"
 #include <array>
 
 namespace InertiaFX
@@ -42,6 +43,12 @@ namespace Core
         class Pressure : public DerivedVectorQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Pressure quantity.
+             * @return A reference to the process-wide, immutable Pressure descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Pressure object.
              *
@@ -72,6 +79,14 @@ namespace Core
             Pressure(std::array<double, 3> value,
                      DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Pressure object from a PressureQty.
+             * @param quantity The pressure, in base units.
+             *
+             * The pressure is stored in base prefix value.
+             */
+            explicit Pressure(const PressureQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Pressure object from an existing one.
@@ -91,6 +106,23 @@ namespace Core
              */
             Pressure &operator=(const Pressure &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Pressure object by taking over the state of an existing one.
+             *
+             * @param other The other Pressure object to move from.
+             */
+            Pressure(Pressure &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Pressure object with that of an existing one.
+             *
+             * @param other The other Pressure object to move from.
+             * @return A reference to this object.
+             */
+            Pressure &operator=(Pressure &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Pressure objects together.
@@ -108,8 +140,81 @@ namespace Core
              * @return True if the objects are equal, false otherwise.
              */
             bool operator==(const Pressure &other) const;
+
+            /**
+             * @brief Addition assignment operator.
+             * @details Adds another Pressure object to this one in place.
+             *
+             * @param other The other Pressure object to add.
+             * @return A reference to this object.
+             */
+            Pressure &operator+=(const Pressure &other);
+
+            /**
+             * @brief Subtraction assignment operator.
+             * @details Subtracts another Pressure object from this one in place.
+             *
+             * @param other The other Pressure object to subtract.
+             * @return A reference to this object.
+             */
+            Pressure &operator-=(const Pressure &other);
+
+            /**
+             * @brief Subtraction operator.
+             * @param other The other Pressure object to subtract.
+             * @return A new Pressure object representing the difference.
+             */
+            Pressure operator-(const Pressure &other) const;
+
+            /**
+             * @brief Unary negation operator.
+             * @return A new Pressure object pointing in the opposite direction.
+             */
+            Pressure operator-() const;
+
+            /**
+             * @brief Scalar multiplication assignment operator.
+             * @param factor The dimensionless factor to scale this pressure by.
+             * @return A reference to this object.
+             */
+            Pressure &operator*=(double factor);
+
+            /**
+             * @brief Scalar division assignment operator.
+             * @param divisor The dimensionless divisor to scale this pressure by.
+             * @return A reference to this object.
+             */
+            Pressure &operator/=(double divisor);
+
+            /**
+             * @brief Scalar multiplication operator.
+             * @param factor The dimensionless factor to scale by.
+             * @return A new Pressure object representing the scaled pressure.
+             */
+            Pressure operator*(double factor) const;
+
+            /**
+             * @brief Scalar division operator.
+             * @param divisor The dimensionless divisor to scale by.
+             * @return A new Pressure object representing the scaled pressure.
+             */
+            Pressure operator/(double divisor) const;
+
+            /**
+             * @brief Converts the pressure into its compile-time dimensioned counterpart.
+             * @return The pressure as a PressureQty, in base units.
+             */
+            PressureQty toQuantity() const;
         };
 
+        /**
+         * @brief Scalar multiplication operator with the factor on the left-hand side.
+         * @param factor The dimensionless factor to scale by.
+         * @param pressure The Pressure object to scale.
+         * @return A new Pressure object representing the scaled pressure.
+         */
+        Pressure operator*(double factor, const Pressure &pressure);
+
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -0,0 +1,270 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity.h
+ * @brief Declaration of the compile-time dimensioned Quantity template.
+ *
+ * @details Quantity<Dim, Rep> carries its physical dimension in the type system, as a Dimension
+ * of exponents over the seven SI base quantities, and stores nothing but its value. Every value is
+ * kept in base units, so arithmetic is plain arithmetic on Rep, dimension checks happen at compile
+ * time and the whole layer folds away in optimised builds. It is meant for hot numeric code; the
+ * descriptor based quantity classes (Velocity, Force, ...) convert to and from it.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_SI_QUANTITY_H
+#define INERTIAFX_CORE_SI_QUANTITY_H
+
+#include "vector3.h"
+#include <compare>
+#include <type_traits>
+#include <utility>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        /**
+         * @struct Dimension
+         * @brief Exponents of the seven SI base quantities.
+         * @tparam L Length (metre) exponent.
+         * @tparam M Mass (kilogram) exponent.
+         * @tparam T Time (second) exponent.
+         * @tparam I Electric current (ampere) exponent.
+         * @tparam Th Thermodynamic temperature (kelvin) exponent.
+         * @tparam N Amount of substance (mole) exponent.
+         * @tparam J Luminous intensity (candela) exponent.
+         */
+        template <int L, int M, int T, int I, int Th, int N, int J>
+        struct Dimension
+        {
+            static constexpr int length      = L;
+            static constexpr int mass        = M;
+            static constexpr int time        = T;
+            static constexpr int current     = I;
+            static constexpr int temperature = Th;
+            static constexpr int amount      = N;
+            static constexpr int luminosity  = J;
+        };
+
+        /**
+         * @brief Dimension of the product of two quantities.
+         */
+        template <typename D1, typename D2>
+        using DimensionProduct =
+            Dimension<D1::length + D2::length, D1::mass + D2::mass, D1::time + D2::time,
+                      D1::current + D2::current, D1::temperature + D2::temperature,
+                      D1::amount + D2::amount, D1::luminosity + D2::luminosity>;
+
+        /**
+         * @brief Dimension of the quotient of two quantities.
+         */
+        template <typename D1, typename D2>
+        using DimensionQuotient =
+            Dimension<D1::length - D2::length, D1::mass - D2::mass, D1::time - D2::time,
+                      D1::current - D2::current, D1::temperature - D2::temperature,
+                      D1::amount - D2::amount, D1::luminosity - D2::luminosity>;
+
+        /**
+         * @namespace Dimensions
+         * @brief Named dimensions of the quantities used by the library.
+         */
+        namespace Dimensions
+        {
+            using Dimensionless = Dimension<0, 0, 0, 0, 0, 0, 0>;
+            using Length        = Dimension<1, 0, 0, 0, 0, 0, 0>;
+            using Mass          = Dimension<0, 1, 0, 0, 0, 0, 0>;
+            using Time          = Dimension<0, 0, 1, 0, 0, 0, 0>;
+            using Current       = Dimension<0, 0, 0, 1, 0, 0, 0>;
+            using Temperature   = Dimension<0, 0, 0, 0, 1, 0, 0>;
+            using Amount        = Dimension<0, 0, 0, 0, 0, 1, 0>;
+            using Luminosity    = Dimension<0, 0, 0, 0, 0, 0, 1>;
+            using Volume        = Dimension<3, 0, 0, 0, 0, 0, 0>;
+            using Density       = DimensionQuotient<Mass, Volume>;
+            using Velocity      = DimensionQuotient<Length, Time>;
+            using Acceleration  = DimensionQuotient<Velocity, Time>;
+            using Force         = DimensionProduct<Mass, Acceleration>;
+            using Pressure      = DimensionQuotient<Force, Dimension<2, 0, 0, 0, 0, 0, 0>>;
+        }  // namespace Dimensions
+
+        /**
+         * @class Quantity
+         * @brief Value of dimension Dim, stored in base SI units, with zero storage overhead.
+         * @tparam Dim The Dimension of the quantity.
+         * @tparam Rep The representation type (double for scalars, Vector3<double> for vectors).
+         */
+        template <typename Dim, typename Rep = double>
+        class Quantity
+        {
+          public:
+            using dimension = Dim;
+            using rep       = Rep;
+
+            /**
+             * @brief Constructs a zero valued quantity.
+             */
+            constexpr Quantity() = default;
+
+            /**
+             * @brief Constructs a quantity from a value in base units.
+             * @param value The value in base SI units.
+             */
+            constexpr explicit Quantity(const Rep &value) : _value(value)
+            {
+            }
+
+            /**
+             * @brief Retrieves the value in base SI units.
+             * @return The stored value.
+             */
+            constexpr const Rep &value() const
+            {
+                return _value;
+            }
+
+            constexpr Quantity &operator+=(const Quantity &other)
+            {
+                _value += other._value;
+                return *this;
+            }
+
+            constexpr Quantity &operator-=(const Quantity &other)
+            {
+                _value -= other._value;
+                return *this;
+            }
+
+            template <typename Scalar>
+            constexpr Quantity &operator*=(const Scalar &factor)
+            {
+                _value *= factor;
+                return *this;
+            }
+
+            template <typename Scalar>
+            constexpr Quantity &operator/=(const Scalar &divisor)
+            {
+                _value /= divisor;
+                return *this;
+            }
+
+            friend constexpr Quantity operator+(Quantity lhs, const Quantity &rhs)
+            {
+                return lhs += rhs;
+            }
+
+            friend constexpr Quantity operator-(Quantity lhs, const Quantity &rhs)
+            {
+                return lhs -= rhs;
+            }
+
+            friend constexpr Quantity operator-(const Quantity &quantity)
+            {
+                return Quantity(-quantity._value);
+            }
+
+            friend constexpr bool operator==(const Quantity &lhs, const Quantity &rhs) = default;
+
+          private:
+            Rep _value{}; /**< Value in base SI units. */
+        };
+
+        /**
+         * @brief Multiplies two quantities, adding their dimension exponents.
+         */
+        template <typename D1, typename R1, typename D2, typename R2>
+        constexpr auto operator*(const Quantity<D1, R1> &lhs, const Quantity<D2, R2> &rhs)
+        {
+            using Result = decltype(std::declval<R1>() * std::declval<R2>());
+            return Quantity<DimensionProduct<D1, D2>, Result>(lhs.value() * rhs.value());
+        }
+
+        /**
+         * @brief Divides two quantities, subtracting their dimension exponents.
+         */
+        template <typename D1, typename R1, typename D2, typename R2>
+        constexpr auto operator/(const Quantity<D1, R1> &lhs, const Quantity<D2, R2> &rhs)
+        {
+            using Result = decltype(std::declval<R1>() / std::declval<R2>());
+            return Quantity<DimensionQuotient<D1, D2>, Result>(lhs.value() / rhs.value());
+        }
+
+        /**
+         * @brief Scales a quantity by a dimensionless arithmetic factor.
+         */
+        template <typename D, typename R, typename Scalar,
+                  typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+        constexpr Quantity<D, R> operator*(Quantity<D, R> quantity, Scalar factor)
+        {
+            return quantity *= factor;
+        }
+
+        /**
+         * @brief Scales a quantity by a dimensionless arithmetic factor.
+         */
+        template <typename D, typename R, typename Scalar,
+                  typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+        constexpr Quantity<D, R> operator*(Scalar factor, Quantity<D, R> quantity)
+        {
+            return quantity *= factor;
+        }
+
+        /**
+         * @brief Divides a quantity by a dimensionless arithmetic divisor.
+         */
+        template <typename D, typename R, typename Scalar,
+                  typename = std::enable_if_t<std::is_arithmetic_v<Scalar>>>
+        constexpr Quantity<D, R> operator/(Quantity<D, R> quantity, Scalar divisor)
+        {
+            return quantity /= divisor;
+        }
+
+        /**
+         * @brief Orders two scalar quantities of the same dimension.
+         */
+        template <typename D, typename R,
+                  typename = std::enable_if_t<std::is_arithmetic_v<R>>>
+        constexpr auto operator<=>(const Quantity<D, R> &lhs, const Quantity<D, R> &rhs)
+        {
+            return lhs.value() <=> rhs.value();
+        }
+
+        // Scalar quantities
+        using LengthQty      = Quantity<Dimensions::Length>;       ///< Length in m.
+        using MassQty        = Quantity<Dimensions::Mass>;         ///< Mass in kg.
+        using TimeQty        = Quantity<Dimensions::Time>;         ///< Time in s.
+        using TemperatureQty = Quantity<Dimensions::Temperature>;  ///< Temperature in K.
+        using VolumeQty      = Quantity<Dimensions::Volume>;       ///< Volume in m^3.
+        using DensityQty     = Quantity<Dimensions::Density>;      ///< Density in kg/m^3.
+
+        // Vector quantities
+        using PositionQty     = Quantity<Dimensions::Length, Vector3<double>>;        ///< m
+        using VelocityQty     = Quantity<Dimensions::Velocity, Vector3<double>>;      ///< m/s
+        using AccelerationQty = Quantity<Dimensions::Acceleration, Vector3<double>>;  ///< m/s^2
+        using ForceQty        = Quantity<Dimensions::Force, Vector3<double>>;         ///< N
+        using PressureQty     = Quantity<Dimensions::Pressure, Vector3<double>>;      ///< Pa
+
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_SI_QUANTITY_H
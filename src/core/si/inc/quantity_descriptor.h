@@ -0,0 +1,95 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity_descriptor.h
+ * @brief Declaration of the QuantityDescriptor structure.
+ *
+ * @details A quantity descriptor gathers the static, per-type information of a physical quantity
+ * (name, symbol, description and base unit). There is a single immutable descriptor per quantity
+ * type, shared by every instance of that type, so a quantity object only has to store its value,
+ * its prefix and a pointer to its descriptor.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_SI_QUANTITY_DESCRIPTOR_H
+#define INERTIAFX_CORE_SI_QUANTITY_DESCRIPTOR_H
+
+#include "iphysical_unit.h"
+#include <memory>
+#include <string>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        /**
+         * @struct QuantityDescriptor
+         * @brief Immutable, process-wide description of a physical quantity type.
+         *
+         * Concrete quantities (e.g. Velocity, Mass) expose their descriptor through a static
+         * descriptor() function backed by a function-local static, so it is built once, on first
+         * use, and never copied afterwards.
+         */
+        struct QuantityDescriptor
+        {
+            /** Name of the quantity (e.g., "Velocity"). */
+            const std::string name;
+            /** Symbol of the quantity (e.g., "v"). */
+            const std::string symbol;
+            /** Short description of the quantity. */
+            const std::string description;
+            /** Base unit of the quantity. */
+            const std::unique_ptr<IPhysicalUnit> unit;
+            /** Symbol of the base unit, kept so formatting needs no copy (e.g., "m/s"). */
+            const std::string unitSymbol;
+
+            /**
+             * @brief Constructs a QuantityDescriptor.
+             * @param name The name of the physical quantity (e.g., "Length", "Velocity").
+             * @param symbol The symbol of the physical quantity (e.g., "l", "v").
+             * @param description A short description of this quantity.
+             * @param unit The IPhysicalUnit defining the base unit info for this quantity.
+             */
+            QuantityDescriptor(const std::string &name, const std::string &symbol,
+                               const std::string &description,
+                               std::unique_ptr<IPhysicalUnit> unit) :
+                name(name), symbol(symbol), description(description), unit(std::move(unit)),
+                unitSymbol(this->unit->getSymbol())
+            {
+            }
+
+            /**
+             * @brief Descriptors are shared by pointer and must never be copied.
+             */
+            QuantityDescriptor(const QuantityDescriptor &) = delete;
+
+            /**
+             * @brief Descriptors are immutable and must never be assigned.
+             */
+            QuantityDescriptor &operator=(const QuantityDescriptor &) = delete;
+        };
+
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_SI_QUANTITY_DESCRIPTOR_H
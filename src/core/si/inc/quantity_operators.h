@@ -0,0 +1,139 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity_operators.h
+ * @brief Declaration of the dimension-aware operators between SI quantity classes.
+ *
+ * @details Each operator maps its operand types onto the quantity type of the result (e.g.,
+ * Force / Mass yields Acceleration), so physics code keeps its units without converting to raw
+ * arrays. All results are stored in base prefix value.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_SI_QUANTITY_OPERATORS_H
+#define INERTIAFX_CORE_SI_QUANTITY_OPERATORS_H
+
+#include "acceleration.h"
+#include "density.h"
+#include "force.h"
+#include "mass.h"
+#include "position.h"
+#include "si_time.h"
+#include "velocity.h"
+#include "volume.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        /**
+         * @brief Newton's second law, F = m * a.
+         * @param mass The left-hand side operand.
+         * @param acceleration The right-hand side operand.
+         * @return A new Force object, stored in base prefix value.
+         */
+        Force operator*(const Mass &mass, const Acceleration &acceleration);
+
+        /**
+         * @brief Newton's second law, F = a * m.
+         * @param acceleration The left-hand side operand.
+         * @param mass The right-hand side operand.
+         * @return A new Force object, stored in base prefix value.
+         */
+        Force operator*(const Acceleration &acceleration, const Mass &mass);
+
+        /**
+         * @brief Newton's second law solved for acceleration, a = F / m.
+         * @param force The left-hand side operand.
+         * @param mass The right-hand side operand.
+         * @return A new Acceleration object, stored in base prefix value.
+         */
+        Acceleration operator/(const Force &force, const Mass &mass);
+
+        /**
+         * @brief Displacement covered at a constant velocity, x = v * t.
+         * @param velocity The left-hand side operand.
+         * @param time The right-hand side operand.
+         * @return A new Position object, stored in base prefix value.
+         */
+        Position operator*(const Velocity &velocity, const Time &time);
+
+        /**
+         * @brief Displacement covered at a constant velocity, x = t * v.
+         * @param time The left-hand side operand.
+         * @param velocity The right-hand side operand.
+         * @return A new Position object, stored in base prefix value.
+         */
+        Position operator*(const Time &time, const Velocity &velocity);
+
+        /**
+         * @brief Velocity change under a constant acceleration, v = a * t.
+         * @param acceleration The left-hand side operand.
+         * @param time The right-hand side operand.
+         * @return A new Velocity object, stored in base prefix value.
+         */
+        Velocity operator*(const Acceleration &acceleration, const Time &time);
+
+        /**
+         * @brief Velocity change under a constant acceleration, v = t * a.
+         * @param time The left-hand side operand.
+         * @param acceleration The right-hand side operand.
+         * @return A new Velocity object, stored in base prefix value.
+         */
+        Velocity operator*(const Time &time, const Acceleration &acceleration);
+
+        /**
+         * @brief Average velocity over a displacement, v = x / t.
+         * @param position The left-hand side operand.
+         * @param time The right-hand side operand.
+         * @return A new Velocity object, stored in base prefix value.
+         */
+        Velocity operator/(const Position &position, const Time &time);
+
+        /**
+         * @brief Average acceleration over a velocity change, a = v / t.
+         * @param velocity The left-hand side operand.
+         * @param time The right-hand side operand.
+         * @return A new Acceleration object, stored in base prefix value.
+         */
+        Acceleration operator/(const Velocity &velocity, const Time &time);
+
+        /**
+         * @brief Density of a body, rho = m / V.
+         * @param mass The left-hand side operand.
+         * @param volume The right-hand side operand.
+         * @return A new Density object, stored in base prefix value.
+         */
+        Density operator/(const Mass &mass, const Volume &volume);
+
+        /**
+         * @brief Mass of a body, m = rho * V.
+         * @param density The left-hand side operand.
+         * @param volume The right-hand side operand.
+         * @return A new Mass object, stored in base prefix value.
+         */
+        Mass operator*(const Density &density, const Volume &volume);
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_SI_QUANTITY_OPERATORS_H
@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_TIME_H
 
 #include "fundamental_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -41,6 +42,12 @@ namespace Core
         class Time : public FundamentalQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Time quantity.
+             * @return A reference to the process-wide, immutable Time descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Time object.
              *
@@ -68,6 +75,14 @@ namespace Core
              */
             Time(double value, DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Time object from a TimeQty.
+             * @param quantity The time, in base units.
+             *
+             * The time is stored in base prefix value.
+             */
+            explicit Time(const TimeQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Time object from an existing one.
@@ -87,6 +102,23 @@ namespace Core
              */
             Time &operator=(const Time &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Time object by taking over the state of an existing one.
+             *
+             * @param other The other Time object to move from.
+             */
+            Time(Time &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Time object with that of an existing one.
+             *
+             * @param other The other Time object to move from.
+             * @return A reference to this object.
+             */
+            Time &operator=(Time &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Time objects together.
@@ -95,6 +127,12 @@ namespace Core
              * @return A new Time object representing the sum.
              */
             Time operator+(const Time &other) const;
+
+            /**
+             * @brief Converts the time into its compile-time dimensioned counterpart.
+             * @return The time as a TimeQty, in base units.
+             */
+            TimeQty toQuantity() const;
         };
 
     }  // namespace SI
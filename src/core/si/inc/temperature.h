@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_TEMPERATURE_H
 
 #include "fundamental_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -41,6 +42,12 @@ namespace Core
         class Temperature : public FundamentalQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Temperature quantity.
+             * @return A reference to the process-wide, immutable Temperature descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Temperature object.
              *
@@ -68,6 +75,14 @@ namespace Core
              */
             Temperature(double value, DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Temperature object from a TemperatureQty.
+             * @param quantity The temperature, in base units.
+             *
+             * The temperature is stored in base prefix value.
+             */
+            explicit Temperature(const TemperatureQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Temperature object from an existing one.
@@ -87,6 +102,23 @@ namespace Core
              */
             Temperature &operator=(const Temperature &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Temperature object by taking over the state of an existing one.
+             *
+             * @param other The other Temperature object to move from.
+             */
+            Temperature(Temperature &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Temperature object with that of an existing one.
+             *
+             * @param other The other Temperature object to move from.
+             * @return A reference to this object.
+             */
+            Temperature &operator=(Temperature &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Temperature objects together.
@@ -119,6 +151,12 @@ namespace Core
              * @copydoc IScalarQty::setValueFrom(double newValue, DecimalPrefix::Symbol prefix)
              */
             void setValueFrom(double newValue, DecimalPrefix::Symbol prefix) override;
+
+            /**
+             * @brief Converts the temperature into its compile-time dimensioned counterpart.
+             * @return The temperature as a TemperatureQty, in base units.
+             */
+            TemperatureQty toQuantity() const;
         };
 
     }  // namespace SI
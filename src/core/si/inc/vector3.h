@@ -0,0 +1,179 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vector3.h
+ * @brief Declaration of the Vector3 template structure.
+ *
+ * @details Vector3 is a plain, trivially copyable three component vector. It is the
+ * representation type used by vector quantities in the compile-time Quantity layer, and it is
+ * laid out exactly like std::array<T, 3> so it can be used in contiguous numeric buffers.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_SI_VECTOR3_H
+#define INERTIAFX_CORE_SI_VECTOR3_H
+
+#include <array>
+#include <cmath>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        /**
+         * @struct Vector3
+         * @brief Three component vector with constexpr arithmetic.
+         * @tparam T The component type (e.g., double).
+         */
+        template <typename T>
+        struct Vector3
+        {
+            T x; /**< First component. */
+            T y; /**< Second component. */
+            T z; /**< Third component. */
+
+            /**
+             * @brief Builds a Vector3 from a std::array.
+             * @param values The three components.
+             * @return The equivalent Vector3.
+             */
+            static constexpr Vector3 fromArray(const std::array<T, 3> &values)
+            {
+                return Vector3{values[0], values[1], values[2]};
+            }
+
+            /**
+             * @brief Converts the vector into a std::array.
+             * @return The three components as a std::array.
+             */
+            constexpr std::array<T, 3> toArray() const
+            {
+                return {x, y, z};
+            }
+
+            constexpr Vector3 &operator+=(const Vector3 &other)
+            {
+                x += other.x;
+                y += other.y;
+                z += other.z;
+                return *this;
+            }
+
+            constexpr Vector3 &operator-=(const Vector3 &other)
+            {
+                x -= other.x;
+                y -= other.y;
+                z -= other.z;
+                return *this;
+            }
+
+            constexpr Vector3 &operator*=(T factor)
+            {
+                x *= factor;
+                y *= factor;
+                z *= factor;
+                return *this;
+            }
+
+            constexpr Vector3 &operator/=(T divisor)
+            {
+                x /= divisor;
+                y /= divisor;
+                z /= divisor;
+                return *this;
+            }
+
+            friend constexpr Vector3 operator+(Vector3 lhs, const Vector3 &rhs)
+            {
+                return lhs += rhs;
+            }
+
+            friend constexpr Vector3 operator-(Vector3 lhs, const Vector3 &rhs)
+            {
+                return lhs -= rhs;
+            }
+
+            friend constexpr Vector3 operator-(const Vector3 &vector)
+            {
+                return Vector3{-vector.x, -vector.y, -vector.z};
+            }
+
+            friend constexpr Vector3 operator*(Vector3 vector, T factor)
+            {
+                return vector *= factor;
+            }
+
+            friend constexpr Vector3 operator*(T factor, Vector3 vector)
+            {
+                return vector *= factor;
+            }
+
+            friend constexpr Vector3 operator/(Vector3 vector, T divisor)
+            {
+                return vector /= divisor;
+            }
+
+            friend constexpr bool operator==(const Vector3 &lhs, const Vector3 &rhs) = default;
+        };
+
+        /**
+         * @brief Dot product of two vectors.
+         */
+        template <typename T>
+        constexpr T dot(const Vector3<T> &lhs, const Vector3<T> &rhs)
+        {
+            return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+        }
+
+        /**
+         * @brief Cross product of two vectors.
+         */
+        template <typename T>
+        constexpr Vector3<T> cross(const Vector3<T> &lhs, const Vector3<T> &rhs)
+        {
+            return Vector3<T>{lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z,
+                              lhs.x * rhs.y - lhs.y * rhs.x};
+        }
+
+        /**
+         * @brief Squared Euclidean norm of a vector.
+         */
+        template <typename T>
+        constexpr T squaredNorm(const Vector3<T> &vector)
+        {
+            return dot(vector, vector);
+        }
+
+        /**
+         * @brief Euclidean norm of a vector.
+         */
+        template <typename T>
+        inline T norm(const Vector3<T> &vector)
+        {
+            return std::sqrt(squaredNorm(vector));
+        }
+
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_SI_VECTOR3_H
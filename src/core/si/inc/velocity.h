@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_VELOCITY_H
 
 #include "derived_vector_qty.h"
+#include "quantity.h"
 #include <array>
 
 namespace InertiaFX
@@ -42,6 +43,12 @@ namespace Core
         class Velocity : public DerivedVectorQty
         {
           public:
+            /**
+             * @brief Retrieves the shared descriptor of the Velocity quantity.
+             * @return A reference to the process-wide, immutable Velocity descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Velocity object.
              *
@@ -71,6 +78,14 @@ namespace Core
             Velocity(std::array<double, 3> value,
                      DecimalPrefix::Symbol prefix = DecimalPrefix::Symbol::base);
 
+            /**
+             * @brief Constructs a new Velocity object from a VelocityQty.
+             * @param quantity The velocity, in base units.
+             *
+             * The velocity is stored in base prefix value.
+             */
+            explicit Velocity(const VelocityQty &quantity);
+
             /**
              * @brief Copy constructor.
              * @details Constructs a new Velocity object from an existing one.
@@ -90,6 +105,23 @@ namespace Core
              */
             Velocity &operator=(const Velocity &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Velocity object by taking over the state of an existing one.
+             *
+             * @param other The other Velocity object to move from.
+             */
+            Velocity(Velocity &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Velocity object with that of an existing one.
+             *
+             * @param other The other Velocity object to move from.
+             * @return A reference to this object.
+             */
+            Velocity &operator=(Velocity &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Velocity objects together.
@@ -107,8 +139,81 @@ namespace Core
              * @return True if the objects are equal, false otherwise.
              */
             bool operator==(const Velocity &other) const;
+
+            /**
+             * @brief Addition assignment operator.
+             * @details Adds another Velocity object to this one in place.
+             *
+             * @param other The other Velocity object to add.
+             * @return A reference to this object.
+             */
+            Velocity &operator+=(const Velocity &other);
+
+            /**
+             * @brief Subtraction assignment operator.
+             * @details Subtracts another Velocity object from this one in place.
+             *
+             * @param other The other Velocity object to subtract.
+             * @return A reference to this object.
+             */
+            Velocity &operator-=(const Velocity &other);
+
+            /**
+             * @brief Subtraction operator.
+             * @param other The other Velocity object to subtract.
+             * @return A new Velocity object representing the difference.
+             */
+            Velocity operator-(const Velocity &other) const;
+
+            /**
+             * @brief Unary negation operator.
+             * @return A new Velocity object pointing in the opposite direction.
+             */
+            Velocity operator-() const;
+
+            /**
+             * @brief Scalar multiplication assignment operator.
+             * @param factor The dimensionless factor to scale this velocity by.
+             * @return A reference to this object.
+             */
+            Velocity &operator*=(double factor);
+
+            /**
+             * @brief Scalar division assignment operator.
+             * @param divisor The dimensionless divisor to scale this velocity by.
+             * @return A reference to this object.
+             */
+            Velocity &operator/=(double divisor);
+
+            /**
+             * @brief Scalar multiplication operator.
+             * @param factor The dimensionless factor to scale by.
+             * @return A new Velocity object representing the scaled velocity.
+             */
+            Velocity operator*(double factor) const;
+
+            /**
+             * @brief Scalar division operator.
+             * @param divisor The dimensionless divisor to scale by.
+             * @return A new Velocity object representing the scaled velocity.
+             */
+            Velocity operator/(double divisor) const;
+
+            /**
+             * @brief Converts the velocity into its compile-time dimensioned counterpart.
+             * @return The velocity as a VelocityQty, in base units.
+             */
+            VelocityQty toQuantity() const;
         };
 
+        /**
+         * @brief Scalar multiplication operator with the factor on the left-hand side.
+         * @param factor The dimensionless factor to scale by.
+         * @param velocity The Velocity object to scale.
+         * @return A new Velocity object representing the scaled velocity.
+         */
+        Velocity operator*(double factor, const Velocity &velocity);
+
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -27,6 +27,7 @@
 #define INERTIAFX_CORE_SI_VOLUME_H
 
 #include "derived_scalar_qty.h"
+#include "quantity.h"
 
 namespace InertiaFX
 {
@@ -51,6 +52,12 @@ namespace Core
                 Sphere,
             };
 
+            /**
+             * @brief Retrieves the shared descriptor of the Volume quantity.
+             * @return A reference to the process-wide, immutable Volume descriptor.
+             */
+            static const QuantityDescriptor &descriptor();
+
             /**
              * @brief Constructs a new Volume object.
              *
@@ -123,6 +130,23 @@ namespace Core
              */
             Volume &operator=(const Volume &other);
 
+            /**
+             * @brief Move constructor.
+             * @details Constructs a new Volume object by taking over the state of an existing one.
+             *
+             * @param other The other Volume object to move from.
+             */
+            Volume(Volume &&other) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @details Replaces the state of this Volume object with that of an existing one.
+             *
+             * @param other The other Volume object to move from.
+             * @return A reference to this object.
+             */
+            Volume &operator=(Volume &&other) noexcept;
+
             /**
              * @brief Addition operator.
              * @details Adds two Volume objects together.
@@ -160,6 +184,12 @@ namespace Core
              */
             Type getType() const;
 
+            /**
+             * @brief Converts the volume into its compile-time dimensioned counterpart.
+             * @return The volume as a VolumeQty, in base units.
+             */
+            VolumeQty toQuantity() const;
+
           private:
             double _length;  //!< Length of the volume in base units (metres).
             double _width;   //!< Width of the volume in base units (metres).
@@ -29,6 +29,7 @@
 #include "metre.h"
 #include "second.h"
 #include <array>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -36,16 +37,22 @@ namespace Core
 {
     namespace SI
     {
-        // Constructor
-        Acceleration::Acceleration() :
-            DerivedVectorQty(
+        const QuantityDescriptor &Acceleration::descriptor()
+        {
+            // Built once, on first use, and shared by every Acceleration instance
+            static const QuantityDescriptor descriptor(
                 "Acceleration", "a", "Represents the derived SI Acceleration quantity.",
                 std::make_unique<DerivedPhysicalUnit>(
                     std::vector<PhysicalUnitPower>{
                         PhysicalUnitPower{std::make_unique<Metre>(), 1},
                         PhysicalUnitPower{std::make_unique<Second>(), -2}},
                     "The metre per second squared, symbol m s^-2, is an SI coherent derived "
-                    "unit of acceleration."))
+                    "unit of acceleration."));
+            return descriptor;
+        }
+
+        // Constructor
+        Acceleration::Acceleration() : DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = 0.0;
@@ -58,14 +65,7 @@ namespace Core
 
         // Constructor
         Acceleration::Acceleration(std::array<double, 3> value, DecimalPrefix::Name prefix) :
-            DerivedVectorQty(
-                "Acceleration", "a", "Represents the derived SI Acceleration quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{
-                        PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                        PhysicalUnitPower{std::make_unique<Second>(), -2}},
-                    "The metre per second squared, symbol m s^-2, is an SI coherent derived "
-                    "unit of acceleration."))
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -78,14 +78,7 @@ namespace Core
 
         // Constructor
         Acceleration::Acceleration(std::array<double, 3> value, DecimalPrefix::Symbol prefix) :
-            DerivedVectorQty(
-                "Acceleration", "a", "Represents the derived SI Acceleration quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{
-                        PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                        PhysicalUnitPower{std::make_unique<Second>(), -2}},
-                    "The metre per second squared, symbol m s^-2, is an SI coherent derived "
-                    "unit of acceleration."))
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -96,37 +89,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Acceleration::Acceleration(const Acceleration &other) :
-            DerivedVectorQty(
-                "Acceleration", "a", "Represents the derived SI Acceleration quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{
-                        PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                        PhysicalUnitPower{std::make_unique<Second>(), -2}},
-                    "The metre per second squared, symbol m s^-2, is an SI coherent derived "
-                    "unit of acceleration."))
+        // Constructor
+        Acceleration::Acceleration(const AccelerationQty &quantity) :
+            Acceleration(quantity.value().toArray(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Acceleration::Acceleration(const Acceleration &other) : DerivedVectorQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Acceleration &Acceleration::operator=(const Acceleration &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty::operator=(other);
+            return *this;
+        }
+
+        Acceleration::Acceleration(Acceleration &&other) noexcept : DerivedVectorQty(std::move(other))
+        {
+        }
+
+        Acceleration &Acceleration::operator=(Acceleration &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedVectorQty::operator=(std::move(other));
             return *this;
         }
 
@@ -147,6 +134,68 @@ namespace Core
             return std::abs(v1[0] - v2[0]) < EPS && std::abs(v1[1] - v2[1]) < EPS &&
                    std::abs(v1[2] - v2[2]) < EPS && _prefix == other._prefix;
         }
+
+        Acceleration &Acceleration::operator+=(const Acceleration &other)
+        {
+            addInPlace(other._value);
+            return *this;
+        }
+
+        Acceleration &Acceleration::operator-=(const Acceleration &other)
+        {
+            subtractInPlace(other._value);
+            return *this;
+        }
+
+        Acceleration Acceleration::operator-(const Acceleration &other) const
+        {
+            Acceleration result(*this);
+            result -= other;
+            return result;
+        }
+
+        Acceleration Acceleration::operator-() const
+        {
+            Acceleration result(*this);
+            result.scaleInPlace(-1.0);
+            return result;
+        }
+
+        Acceleration &Acceleration::operator*=(double factor)
+        {
+            scaleInPlace(factor);
+            return *this;
+        }
+
+        Acceleration &Acceleration::operator/=(double divisor)
+        {
+            scaleInPlace(1.0 / divisor);
+            return *this;
+        }
+
+        Acceleration Acceleration::operator*(double factor) const
+        {
+            Acceleration result(*this);
+            result *= factor;
+            return result;
+        }
+
+        Acceleration Acceleration::operator/(double divisor) const
+        {
+            Acceleration result(*this);
+            result /= divisor;
+            return result;
+        }
+
+        AccelerationQty Acceleration::toQuantity() const
+        {
+            return AccelerationQty(Vector3<double>::fromArray(this->getValue()));
+        }
+
+        Acceleration operator*(double factor, const Acceleration &acceleration)
+        {
+            return acceleration * factor;
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
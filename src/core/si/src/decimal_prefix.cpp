@@ -28,7 +28,6 @@
  */
 
 #include "decimal_prefix.h"
-#include <cmath>
 
 namespace InertiaFX
 {
@@ -155,6 +154,11 @@ namespace Core
         }
 
         std::string DecimalPrefix::getSymbol(Name prefix)
+        {
+            return std::string(getSymbolView(prefix));
+        }
+
+        std::string_view DecimalPrefix::getSymbolView(Name prefix)
         {
             switch (prefix)
             {
@@ -272,14 +276,35 @@ namespace Core
             }
         }
 
-        double DecimalPrefix::getMultiplier(Symbol prefix)
+        void DecimalPrefix::rescale(std::span<double> values, Name from, Name to)
         {
-            return std::pow(10.0, static_cast<int>(prefix));
+            const double factor = getPowerOfTen(static_cast<int>(from) - static_cast<int>(to));
+            for (double &value : values)
+            {
+                value *= factor;
+            }
+        }
+
+        void DecimalPrefix::rescale(std::span<double> values, Symbol from, Symbol to)
+        {
+            rescale(values, static_cast<Name>(from), static_cast<Name>(to));
+        }
+
+        void DecimalPrefix::rescale(std::span<std::array<double, 3>> values, Name from, Name to)
+        {
+            const double factor = getPowerOfTen(static_cast<int>(from) - static_cast<int>(to));
+            for (std::array<double, 3> &value : values)
+            {
+                value[0] *= factor;
+                value[1] *= factor;
+                value[2] *= factor;
+            }
         }
 
-        double DecimalPrefix::getMultiplier(Name prefix)
+        void DecimalPrefix::rescale(std::span<std::array<double, 3>> values, Symbol from,
+                                    Symbol to)
         {
-            return std::pow(10.0, static_cast<int>(prefix));
+            rescale(values, static_cast<Name>(from), static_cast<Name>(to));
         }
     }  // namespace SI
 }  // namespace Core
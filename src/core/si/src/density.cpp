@@ -28,6 +28,7 @@
 #include "derived_physical_unit.h"
 #include "kilogram.h"
 #include "metre.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -35,15 +36,22 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Density::descriptor()
+        {
+            // Built once, on first use, and shared by every Density instance
+            static const QuantityDescriptor descriptor(
+                "Density", "ρ", "Represents the derived SI Density quantity.",
+                std::make_unique<DerivedPhysicalUnit>(
+                    std::vector<PhysicalUnitPower>{
+                        PhysicalUnitPower{std::make_unique<Kilogram>(), 1},
+                        PhysicalUnitPower{std::make_unique<Metre>(), -3}},
+                    "The kilogram per cubic metre, symbol kg m^-3, is an SI coherent "
+                    "derived unit of density."));
+            return descriptor;
+        }
+
         // Constructor
-        Density::Density() :
-            DerivedScalarQty("Density", "ρ", "Represents the derived SI Density quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Kilogram>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Metre>(), -3}},
-                                 "The kilogram per cubic metre, symbol kg m^-3, is an SI coherent "
-                                 "derived unit of density."))
+        Density::Density() : DerivedScalarQty(descriptor())
         {
             // Store internally in base units
             this->_value = 1.0;
@@ -53,14 +61,7 @@ namespace Core
         }
 
         // Constructor
-        Density::Density(double value, DecimalPrefix::Name prefix) :
-            DerivedScalarQty("Density", "ρ", "Represents the derived SI Density quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Kilogram>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Metre>(), -3}},
-                                 "The kilogram per cubic metre, symbol kg m^-3, is an SI coherent "
-                                 "derived unit of density."))
+        Density::Density(double value, DecimalPrefix::Name prefix) : DerivedScalarQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -71,13 +72,7 @@ namespace Core
 
         // Constructor
         Density::Density(double value, DecimalPrefix::Symbol prefix) :
-            DerivedScalarQty("Density", "ρ", "Represents the derived SI Density quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Kilogram>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Metre>(), -3}},
-                                 "The kilogram per cubic metre, symbol kg m^-3, is an SI coherent "
-                                 "derived unit of density."))
+            DerivedScalarQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -86,36 +81,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Density::Density(const Density &other) :
-            DerivedScalarQty("Density", "ρ", "Represents the derived SI Density quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Kilogram>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Metre>(), -3}},
-                                 "The kilogram per cubic metre, symbol kg m^-3, is an SI coherent "
-                                 "derived unit of density."))
+        // Constructor
+        Density::Density(const DensityQty &quantity) :
+            Density(quantity.value(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Density::Density(const Density &other) : DerivedScalarQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Density &Density::operator=(const Density &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedScalarQty::operator=(other);
+            return *this;
+        }
+
+        Density::Density(Density &&other) noexcept : DerivedScalarQty(std::move(other))
+        {
+        }
+
+        Density &Density::operator=(Density &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedScalarQty::operator=(std::move(other));
             return *this;
         }
 
@@ -129,6 +119,11 @@ namespace Core
             constexpr double EPS = 1e-9;
             return std::abs(_value - other._value) < EPS && _prefix == other._prefix;
         }
+
+        DensityQty Density::toQuantity() const
+        {
+            return DensityQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -27,6 +27,7 @@
 #include "decimal_prefix.h"
 #include "newton.h"
 #include <array>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -34,10 +35,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Force::descriptor()
+        {
+            // Built once, on first use, and shared by every Force instance
+            static const QuantityDescriptor descriptor(
+                "Force", "F", "Represents the derived SI Force quantity.",
+                std::make_unique<Newton>());
+            return descriptor;
+        }
+
         // Constructor
-        Force::Force() :
-            DerivedVectorQty("Force", "F", "Represents the derived SI Force quantity.",
-                             std::make_unique<Newton>())
+        Force::Force() : DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = 0.0;
@@ -50,8 +58,7 @@ namespace Core
 
         // Constructor
         Force::Force(std::array<double, 3> value, DecimalPrefix::Name prefix) :
-            DerivedVectorQty("Force", "F", "Represents the derived SI Force quantity.",
-                             std::make_unique<Newton>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -64,8 +71,7 @@ namespace Core
 
         // Constructor
         Force::Force(std::array<double, 3> value, DecimalPrefix::Symbol prefix) :
-            DerivedVectorQty("Force", "F", "Represents the derived SI Force quantity.",
-                             std::make_unique<Newton>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -76,31 +82,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Force::Force(const Force &other) :
-            DerivedVectorQty("Force", "F", "Represents the derived SI Force quantity.",
-                             std::make_unique<Newton>())
+        // Constructor
+        Force::Force(const ForceQty &quantity) :
+            Force(quantity.value().toArray(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Force::Force(const Force &other) : DerivedVectorQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Force &Force::operator=(const Force &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty::operator=(other);
+            return *this;
+        }
+
+        Force::Force(Force &&other) noexcept : DerivedVectorQty(std::move(other))
+        {
+        }
+
+        Force &Force::operator=(Force &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedVectorQty::operator=(std::move(other));
             return *this;
         }
 
@@ -121,6 +127,68 @@ namespace Core
             return std::abs(v1[0] - v2[0]) < EPS && std::abs(v1[1] - v2[1]) < EPS &&
                    std::abs(v1[2] - v2[2]) < EPS && _prefix == other._prefix;
         }
+
+        Force &Force::operator+=(const Force &other)
+        {
+            addInPlace(other._value);
+            return *this;
+        }
+
+        Force &Force::operator-=(const Force &other)
+        {
+            subtractInPlace(other._value);
+            return *this;
+        }
+
+        Force Force::operator-(const Force &other) const
+        {
+            Force result(*this);
+            result -= other;
+            return result;
+        }
+
+        Force Force::operator-() const
+        {
+            Force result(*this);
+            result.scaleInPlace(-1.0);
+            return result;
+        }
+
+        Force &Force::operator*=(double factor)
+        {
+            scaleInPlace(factor);
+            return *this;
+        }
+
+        Force &Force::operator/=(double divisor)
+        {
+            scaleInPlace(1.0 / divisor);
+            return *this;
+        }
+
+        Force Force::operator*(double factor) const
+        {
+            Force result(*this);
+            result *= factor;
+            return result;
+        }
+
+        Force Force::operator/(double divisor) const
+        {
+            Force result(*this);
+            result /= divisor;
+            return result;
+        }
+
+        ForceQty Force::toQuantity() const
+        {
+            return ForceQty(Vector3<double>::fromArray(this->getValue()));
+        }
+
+        Force operator*(double factor, const Force &force)
+        {
+            return force * factor;
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -26,6 +26,7 @@
 #include "length.h"
 #include "decimal_prefix.h"
 #include "metre.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -33,10 +34,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Length::descriptor()
+        {
+            // Built once, on first use, and shared by every Length instance
+            static const QuantityDescriptor descriptor(
+                "Length", "l", "Represents the fundamental SI Length quantity.",
+                std::make_unique<Metre>());
+            return descriptor;
+        }
+
         // Constructor
-        Length::Length() :
-            FundamentalQty("Length", "l", "Represents the fundamental SI Length quantity.",
-                           std::make_unique<Metre>())
+        Length::Length() : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = 1.0;
@@ -46,9 +54,7 @@ namespace Core
         }
 
         // Constructor
-        Length::Length(double value, DecimalPrefix::Name prefix) :
-            FundamentalQty("Length", "l", "Represents the fundamental SI Length quantity.",
-                           std::make_unique<Metre>())
+        Length::Length(double value, DecimalPrefix::Name prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -58,9 +64,7 @@ namespace Core
         }
 
         // Constructor
-        Length::Length(double value, DecimalPrefix::Symbol prefix) :
-            FundamentalQty("Length", "l", "Represents the fundamental SI Length quantity.",
-                           std::make_unique<Metre>())
+        Length::Length(double value, DecimalPrefix::Symbol prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -69,31 +73,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Length::Length(const Length &other) :
-            FundamentalQty("Length", "l", "Represents the fundamental SI Length quantity.",
-                           std::make_unique<Metre>())
+        // Constructor
+        Length::Length(const LengthQty &quantity) :
+            Length(quantity.value(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Length::Length(const Length &other) : FundamentalQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Length &Length::operator=(const Length &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            FundamentalQty::operator=(other);
+            return *this;
+        }
+
+        Length::Length(Length &&other) noexcept : FundamentalQty(std::move(other))
+        {
+        }
+
+        Length &Length::operator=(Length &&other) noexcept
+        {
+            // Move assignment operator
+            FundamentalQty::operator=(std::move(other));
             return *this;
         }
 
@@ -107,6 +111,11 @@ namespace Core
             constexpr double EPS = 1e-9;
             return std::abs(_value - other._value) < EPS && _prefix == other._prefix;
         }
+
+        LengthQty Length::toQuantity() const
+        {
+            return LengthQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
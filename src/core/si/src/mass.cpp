@@ -26,6 +26,7 @@
 #include "mass.h"
 #include "decimal_prefix.h"
 #include "kilogram.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -33,10 +34,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Mass::descriptor()
+        {
+            // Built once, on first use, and shared by every Mass instance
+            static const QuantityDescriptor descriptor(
+                "Mass", "m", "Represents the fundamental SI Mass quantity.",
+                std::make_unique<Kilogram>());
+            return descriptor;
+        }
+
         // Constructor
-        Mass::Mass() :
-            FundamentalQty("Mass", "m", "Represents the fundamental SI Mass quantity.",
-                           std::make_unique<Kilogram>())
+        Mass::Mass() : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = 1.0;
@@ -46,9 +54,7 @@ namespace Core
         }
 
         // Constructor
-        Mass::Mass(double value, DecimalPrefix::Name prefix) :
-            FundamentalQty("Mass", "m", "Represents the fundamental SI Mass quantity.",
-                           std::make_unique<Kilogram>())
+        Mass::Mass(double value, DecimalPrefix::Name prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -58,9 +64,7 @@ namespace Core
         }
 
         // Constructor
-        Mass::Mass(double value, DecimalPrefix::Symbol prefix) :
-            FundamentalQty("Mass", "m", "Represents the fundamental SI Mass quantity.",
-                           std::make_unique<Kilogram>())
+        Mass::Mass(double value, DecimalPrefix::Symbol prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -69,31 +73,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Mass::Mass(const Mass &other) :
-            FundamentalQty("Mass", "m", "Represents the fundamental SI Mass quantity.",
-                           std::make_unique<Kilogram>())
+        // Constructor
+        Mass::Mass(const MassQty &quantity) :
+            Mass(quantity.value(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Mass::Mass(const Mass &other) : FundamentalQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Mass &Mass::operator=(const Mass &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            FundamentalQty::operator=(other);
+            return *this;
+        }
+
+        Mass::Mass(Mass &&other) noexcept : FundamentalQty(std::move(other))
+        {
+        }
+
+        Mass &Mass::operator=(Mass &&other) noexcept
+        {
+            // Move assignment operator
+            FundamentalQty::operator=(std::move(other));
             return *this;
         }
 
@@ -107,6 +111,11 @@ namespace Core
             constexpr double EPS = 1e-9;
             return std::abs(_value - other._value) < EPS && _prefix == other._prefix;
         }
+
+        MassQty Mass::toQuantity() const
+        {
+            return MassQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
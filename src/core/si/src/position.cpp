@@ -27,6 +27,7 @@
 #include "decimal_prefix.h"
 #include "metre.h"
 #include <array>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -34,10 +35,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Position::descriptor()
+        {
+            // Built once, on first use, and shared by every Position instance
+            static const QuantityDescriptor descriptor(
+                "Position", "r", "Represents the derived SI Position quantity.",
+                std::make_unique<Metre>());
+            return descriptor;
+        }
+
         // Constructor
-        Position::Position() :
-            DerivedVectorQty("Position", "r", "Represents the derived SI Position quantity.",
-                             std::make_unique<Metre>())
+        Position::Position() : DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = 0.0;
@@ -50,8 +58,7 @@ namespace Core
 
         // Constructor
         Position::Position(std::array<double, 3> value, DecimalPrefix::Name prefix) :
-            DerivedVectorQty("Position", "r", "Represents the derived SI Position quantity.",
-                             std::make_unique<Metre>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -64,8 +71,7 @@ namespace Core
 
         // Constructor
         Position::Position(std::array<double, 3> value, DecimalPrefix::Symbol prefix) :
-            DerivedVectorQty("Position", "r", "Represents the derived SI Position quantity.",
-                             std::make_unique<Metre>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -76,31 +82,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Position::Position(const Position &other) :
-            DerivedVectorQty("Position", "r", "Represents the derived SI Position quantity.",
-                             std::make_unique<Metre>())
+        // Constructor
+        Position::Position(const PositionQty &quantity) :
+            Position(quantity.value().toArray(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Position::Position(const Position &other) : DerivedVectorQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Position &Position::operator=(const Position &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty::operator=(other);
+            return *this;
+        }
+
+        Position::Position(Position &&other) noexcept : DerivedVectorQty(std::move(other))
+        {
+        }
+
+        Position &Position::operator=(Position &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedVectorQty::operator=(std::move(other));
             return *this;
         }
 
@@ -121,6 +127,68 @@ namespace Core
             return std::abs(v1[0] - v2[0]) < EPS && std::abs(v1[1] - v2[1]) < EPS &&
                    std::abs(v1[2] - v2[2]) < EPS && _prefix == other._prefix;
         }
+
+        Position &Position::operator+=(const Position &other)
+        {
+            addInPlace(other._value);
+            return *this;
+        }
+
+        Position &Position::operator-=(const Position &other)
+        {
+            subtractInPlace(other._value);
+            return *this;
+        }
+
+        Position Position::operator-(const Position &other) const
+        {
+            Position result(*this);
+            result -= other;
+            return result;
+        }
+
+        Position Position::operator-() const
+        {
+            Position result(*this);
+            result.scaleInPlace(-1.0);
+            return result;
+        }
+
+        Position &Position::operator*=(double factor)
+        {
+            scaleInPlace(factor);
+            return *this;
+        }
+
+        Position &Position::operator/=(double divisor)
+        {
+            scaleInPlace(1.0 / divisor);
+            return *this;
+        }
+
+        Position Position::operator*(double factor) const
+        {
+            Position result(*this);
+            result *= factor;
+            return result;
+        }
+
+        Position Position::operator/(double divisor) const
+        {
+            Position result(*this);
+            result /= divisor;
+            return result;
+        }
+
+        PositionQty Position::toQuantity() const
+        {
+            return PositionQty(Vector3<double>::fromArray(this->getValue()));
+        }
+
+        Position operator*(double factor, const Position &position)
+        {
+            return position * factor;
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
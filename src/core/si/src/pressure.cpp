@@ -28,6 +28,7 @@
 #include "derived_physical_unit.h"
 #include "pascal.h"
 #include <array>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -35,10 +36,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Pressure::descriptor()
+        {
+            // Built once, on first use, and shared by every Pressure instance
+            static const QuantityDescriptor descriptor(
+                "Pressure", "p", "Represents the derived SI Pressure quantity.",
+                std::make_unique<Pascal>());
+            return descriptor;
+        }
+
         // Constructor
-        Pressure::Pressure() :
-            DerivedVectorQty("Pressure", "p", "Represents the derived SI Pressure quantity.",
-                             std::make_unique<Pascal>())
+        Pressure::Pressure() : DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = 0.0;
@@ -51,8 +59,7 @@ namespace Core
 
         // Constructor
         Pressure::Pressure(std::array<double, 3> value, DecimalPrefix::Name prefix) :
-            DerivedVectorQty("Pressure", "p", "Represents the derived SI Pressure quantity.",
-                             std::make_unique<Pascal>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -65,8 +72,7 @@ namespace Core
 
         // Constructor
         Pressure::Pressure(std::array<double, 3> value, DecimalPrefix::Symbol prefix) :
-            DerivedVectorQty("Pressure", "p", "Represents the derived SI Pressure quantity.",
-                             std::make_unique<Pascal>())
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -77,31 +83,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Pressure::Pressure(const Pressure &other) :
-            DerivedVectorQty("Pressure", "p", "Represents the derived SI Pressure quantity.",
-                             std::make_unique<Pascal>())
+        // Constructor
+        Pressure::Pressure(const PressureQty &quantity) :
+            Pressure(quantity.value().toArray(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Pressure::Pressure(const Pressure &other) : DerivedVectorQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Pressure &Pressure::operator=(const Pressure &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty::operator=(other);
+            return *this;
+        }
+
+        Pressure::Pressure(Pressure &&other) noexcept : DerivedVectorQty(std::move(other))
+        {
+        }
+
+        Pressure &Pressure::operator=(Pressure &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedVectorQty::operator=(std::move(other));
             return *this;
         }
 
@@ -122,6 +128,68 @@ namespace Core
             return std::abs(v1[0] - v2[0]) < EPS && std::abs(v1[1] - v2[1]) < EPS &&
                    std::abs(v1[2] - v2[2]) < EPS && _prefix == other._prefix;
         }
+
+        Pressure &Pressure::operator+=(const Pressure &other)
+        {
+            addInPlace(other._value);
+            return *this;
+        }
+
+        Pressure &Pressure::operator-=(const Pressure &other)
+        {
+            subtractInPlace(other._value);
+            return *this;
+        }
+
+        Pressure Pressure::operator-(const Pressure &other) const
+        {
+            Pressure result(*this);
+            result -= other;
+            return result;
+        }
+
+        Pressure Pressure::operator-() const
+        {
+            Pressure result(*this);
+            result.scaleInPlace(-1.0);
+            return result;
+        }
+
+        Pressure &Pressure::operator*=(double factor)
+        {
+            scaleInPlace(factor);
+            return *this;
+        }
+
+        Pressure &Pressure::operator/=(double divisor)
+        {
+            scaleInPlace(1.0 / divisor);
+            return *this;
+        }
+
+        Pressure Pressure::operator*(double factor) const
+        {
+            Pressure result(*this);
+            result *= factor;
+            return result;
+        }
+
+        Pressure Pressure::operator/(double divisor) const
+        {
+            Pressure result(*this);
+            result /= divisor;
+            return result;
+        }
+
+        PressureQty Pressure::toQuantity() const
+        {
+            return PressureQty(Vector3<double>::fromArray(this->getValue()));
+        }
+
+        Pressure operator*(double factor, const Pressure &pressure)
+        {
+            return pressure * factor;
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -0,0 +1,119 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity_operators.cpp
+ * @brief Definition of the dimension-aware operators between SI quantity classes.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "quantity_operators.h"
+#include "decimal_prefix.h"
+#include <array>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        Force operator*(const Mass &mass, const Acceleration &acceleration)
+        {
+            const double scalar               = mass.getValue();
+            const std::array<double, 3> value = acceleration.getValue();
+            return Force({scalar * value[0], scalar * value[1], scalar * value[2]},
+                         DecimalPrefix::Name::base);
+        }
+
+        Force operator*(const Acceleration &acceleration, const Mass &mass)
+        {
+            const std::array<double, 3> value = acceleration.getValue();
+            const double scalar               = mass.getValue();
+            return Force({value[0] * scalar, value[1] * scalar, value[2] * scalar},
+                         DecimalPrefix::Name::base);
+        }
+
+        Acceleration operator/(const Force &force, const Mass &mass)
+        {
+            const std::array<double, 3> value = force.getValue();
+            const double scalar               = mass.getValue();
+            return Acceleration({value[0] / scalar, value[1] / scalar, value[2] / scalar},
+                                DecimalPrefix::Name::base);
+        }
+
+        Position operator*(const Velocity &velocity, const Time &time)
+        {
+            const std::array<double, 3> value = velocity.getValue();
+            const double scalar               = time.getValue();
+            return Position({value[0] * scalar, value[1] * scalar, value[2] * scalar},
+                            DecimalPrefix::Name::base);
+        }
+
+        Position operator*(const Time &time, const Velocity &velocity)
+        {
+            const double scalar               = time.getValue();
+            const std::array<double, 3> value = velocity.getValue();
+            return Position({scalar * value[0], scalar * value[1], scalar * value[2]},
+                            DecimalPrefix::Name::base);
+        }
+
+        Velocity operator*(const Acceleration &acceleration, const Time &time)
+        {
+            const std::array<double, 3> value = acceleration.getValue();
+            const double scalar               = time.getValue();
+            return Velocity({value[0] * scalar, value[1] * scalar, value[2] * scalar},
+                            DecimalPrefix::Name::base);
+        }
+
+        Velocity operator*(const Time &time, const Acceleration &acceleration)
+        {
+            const double scalar               = time.getValue();
+            const std::array<double, 3> value = acceleration.getValue();
+            return Velocity({scalar * value[0], scalar * value[1], scalar * value[2]},
+                            DecimalPrefix::Name::base);
+        }
+
+        Velocity operator/(const Position &position, const Time &time)
+        {
+            const std::array<double, 3> value = position.getValue();
+            const double scalar               = time.getValue();
+            return Velocity({value[0] / scalar, value[1] / scalar, value[2] / scalar},
+                            DecimalPrefix::Name::base);
+        }
+
+        Acceleration operator/(const Velocity &velocity, const Time &time)
+        {
+            const std::array<double, 3> value = velocity.getValue();
+            const double scalar               = time.getValue();
+            return Acceleration({value[0] / scalar, value[1] / scalar, value[2] / scalar},
+                                DecimalPrefix::Name::base);
+        }
+
+        Density operator/(const Mass &mass, const Volume &volume)
+        {
+            return Density(mass.getValue() / volume.getValue(), DecimalPrefix::Name::base);
+        }
+
+        Mass operator*(const Density &density, const Volume &volume)
+        {
+            return Mass(density.getValue() * volume.getValue(), DecimalPrefix::Name::base);
+        }
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
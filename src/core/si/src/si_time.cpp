@@ -26,6 +26,7 @@
 #include "si_time.h"
 #include "decimal_prefix.h"
 #include "second.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -33,10 +34,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Time::descriptor()
+        {
+            // Built once, on first use, and shared by every Time instance
+            static const QuantityDescriptor descriptor(
+                "Time", "t", "Represents the fundamental SI Time quantity.",
+                std::make_unique<Second>());
+            return descriptor;
+        }
+
         // Constructor
-        Time::Time() :
-            FundamentalQty("Time", "t", "Represents the fundamental SI Time quantity.",
-                           std::make_unique<Second>())
+        Time::Time() : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = 1.0;
@@ -46,9 +54,7 @@ namespace Core
         }
 
         // Constructor
-        Time::Time(double value, DecimalPrefix::Name prefix) :
-            FundamentalQty("Time", "t", "Represents the fundamental SI Time quantity.",
-                           std::make_unique<Second>())
+        Time::Time(double value, DecimalPrefix::Name prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -58,9 +64,7 @@ namespace Core
         }
 
         // Constructor
-        Time::Time(double value, DecimalPrefix::Symbol prefix) :
-            FundamentalQty("Time", "t", "Represents the fundamental SI Time quantity.",
-                           std::make_unique<Second>())
+        Time::Time(double value, DecimalPrefix::Symbol prefix) : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = value * DecimalPrefix::getMultiplier(prefix);
@@ -69,31 +73,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Time::Time(const Time &other) :
-            FundamentalQty("Time", "t", "Represents the fundamental SI Time quantity.",
-                           std::make_unique<Second>())
+        // Constructor
+        Time::Time(const TimeQty &quantity) :
+            Time(quantity.value(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Time::Time(const Time &other) : FundamentalQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Time &Time::operator=(const Time &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            FundamentalQty::operator=(other);
+            return *this;
+        }
+
+        Time::Time(Time &&other) noexcept : FundamentalQty(std::move(other))
+        {
+        }
+
+        Time &Time::operator=(Time &&other) noexcept
+        {
+            // Move assignment operator
+            FundamentalQty::operator=(std::move(other));
             return *this;
         }
 
@@ -101,6 +105,11 @@ namespace Core
         {
             return Time(this->getValue() + other.getValue(), DecimalPrefix::Name::base);
         }
+
+        TimeQty Time::toQuantity() const
+        {
+            return TimeQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -26,6 +26,7 @@
 #include "temperature.h"
 #include "decimal_prefix.h"
 #include "kelvin.h"
+#include <utility>
 
 namespace InertiaFX
 {
@@ -33,11 +34,17 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Temperature::descriptor()
+        {
+            // Built once, on first use, and shared by every Temperature instance
+            static const QuantityDescriptor descriptor(
+                "Temperature", "T", "Represents the fundamental SI Temperature quantity.",
+                std::make_unique<Kelvin>());
+            return descriptor;
+        }
+
         // Constructor
-        Temperature::Temperature() :
-            FundamentalQty("Temperature", "T",
-                           "Represents the fundamental SI Temperature quantity.",
-                           std::make_unique<Kelvin>())
+        Temperature::Temperature() : FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = 273.15;  // Default to zero degree Celsius in Kelvin
@@ -48,9 +55,7 @@ namespace Core
 
         // Constructor
         Temperature::Temperature(double value, DecimalPrefix::Name prefix) :
-            FundamentalQty("Temperature", "T",
-                           "Represents the fundamental SI Temperature quantity.",
-                           std::make_unique<Kelvin>())
+            FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = (value < 0.0) ? 0.0 : value * DecimalPrefix::getMultiplier(prefix);
@@ -61,9 +66,7 @@ namespace Core
 
         // Constructor
         Temperature::Temperature(double value, DecimalPrefix::Symbol prefix) :
-            FundamentalQty("Temperature", "T",
-                           "Represents the fundamental SI Temperature quantity.",
-                           std::make_unique<Kelvin>())
+            FundamentalQty(descriptor())
         {
             // Store internally in base units
             this->_value = (value < 0.0) ? 0.0 : value * DecimalPrefix::getMultiplier(prefix);
@@ -72,32 +75,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Temperature::Temperature(const Temperature &other) :
-            FundamentalQty("Temperature", "T",
-                           "Represents the fundamental SI Temperature quantity.",
-                           std::make_unique<Kelvin>())
+        // Constructor
+        Temperature::Temperature(const TemperatureQty &quantity) :
+            Temperature(quantity.value(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Temperature::Temperature(const Temperature &other) : FundamentalQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Temperature &Temperature::operator=(const Temperature &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            FundamentalQty::operator=(other);
+            return *this;
+        }
+
+        Temperature::Temperature(Temperature &&other) noexcept : FundamentalQty(std::move(other))
+        {
+        }
+
+        Temperature &Temperature::operator=(Temperature &&other) noexcept
+        {
+            // Move assignment operator
+            FundamentalQty::operator=(std::move(other));
             return *this;
         }
 
@@ -138,6 +140,11 @@ namespace Core
             _value  = (newValue < 0.0) ? 0.0 : newValue * DecimalPrefix::getMultiplier(prefix);
             _prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
+
+        TemperatureQty Temperature::toQuantity() const
+        {
+            return TemperatureQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -29,6 +29,7 @@
 #include "metre.h"
 #include "second.h"
 #include <array>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -36,15 +37,22 @@ namespace Core
 {
     namespace SI
     {
+        const QuantityDescriptor &Velocity::descriptor()
+        {
+            // Built once, on first use, and shared by every Velocity instance
+            static const QuantityDescriptor descriptor(
+                "Velocity", "v", "Represents the derived SI Velocity quantity.",
+                std::make_unique<DerivedPhysicalUnit>(
+                    std::vector<PhysicalUnitPower>{
+                        PhysicalUnitPower{std::make_unique<Metre>(), 1},
+                        PhysicalUnitPower{std::make_unique<Second>(), -1}},
+                    "The metre per second, symbol m s^-1, is an SI coherent derived "
+                    "unit of velocity/speed."));
+            return descriptor;
+        }
+
         // Constructor
-        Velocity::Velocity() :
-            DerivedVectorQty("Velocity", "v", "Represents the derived SI Velocity quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Second>(), -1}},
-                                 "The metre per second, symbol m s^-1, is an SI coherent derived "
-                                 "unit of velocity/speed."))
+        Velocity::Velocity() : DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = 0.0;
@@ -57,13 +65,7 @@ namespace Core
 
         // Constructor
         Velocity::Velocity(std::array<double, 3> value, DecimalPrefix::Name prefix) :
-            DerivedVectorQty("Velocity", "v", "Represents the derived SI Velocity quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Second>(), -1}},
-                                 "The metre per second, symbol m s^-1, is an SI coherent derived "
-                                 "unit of velocity/speed."))
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -76,13 +78,7 @@ namespace Core
 
         // Constructor
         Velocity::Velocity(std::array<double, 3> value, DecimalPrefix::Symbol prefix) :
-            DerivedVectorQty("Velocity", "v", "Represents the derived SI Velocity quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Second>(), -1}},
-                                 "The metre per second, symbol m s^-1, is an SI coherent derived "
-                                 "unit of velocity/speed."))
+            DerivedVectorQty(descriptor())
         {
             // Store internally in base units
             this->_value[0] = value[0] * DecimalPrefix::getMultiplier(prefix);
@@ -93,36 +89,31 @@ namespace Core
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
         }
 
-        Velocity::Velocity(const Velocity &other) :
-            DerivedVectorQty("Velocity", "v", "Represents the derived SI Velocity quantity.",
-                             std::make_unique<DerivedPhysicalUnit>(
-                                 std::vector<PhysicalUnitPower>{
-                                     PhysicalUnitPower{std::make_unique<Metre>(), 1},
-                                     PhysicalUnitPower{std::make_unique<Second>(), -1}},
-                                 "The metre per second, symbol m s^-1, is an SI coherent derived "
-                                 "unit of velocity/speed."))
+        // Constructor
+        Velocity::Velocity(const VelocityQty &quantity) :
+            Velocity(quantity.value().toArray(), DecimalPrefix::Name::base)
+        {
+        }
+
+        Velocity::Velocity(const Velocity &other) : DerivedVectorQty(other)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
         }
 
         Velocity &Velocity::operator=(const Velocity &other)
         {
             // Copy assignment operator
-            if (this != &other)
-            {
-                _value  = other._value;
-                _prefix = other._prefix;
-
-                // If there's an existing owned object, remove it
-                _unit.reset();
-
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            }
+            DerivedVectorQty::operator=(other);
+            return *this;
+        }
+
+        Velocity::Velocity(Velocity &&other) noexcept : DerivedVectorQty(std::move(other))
+        {
+        }
+
+        Velocity &Velocity::operator=(Velocity &&other) noexcept
+        {
+            // Move assignment operator
+            DerivedVectorQty::operator=(std::move(other));
             return *this;
         }
 
@@ -143,6 +134,68 @@ namespace Core
             return std::abs(v1[0] - v2[0]) < EPS && std::abs(v1[1] - v2[1]) < EPS &&
                    std::abs(v1[2] - v2[2]) < EPS && _prefix == other._prefix;
         }
+
+        Velocity &Velocity::operator+=(const Velocity &other)
+        {
+            addInPlace(other._value);
+            return *this;
+        }
+
+        Velocity &Velocity::operator-=(const Velocity &other)
+        {
+            subtractInPlace(other._value);
+            return *this;
+        }
+
+        Velocity Velocity::operator-(const Velocity &other) const
+        {
+            Velocity result(*this);
+            result -= other;
+            return result;
+        }
+
+        Velocity Velocity::operator-() const
+        {
+            Velocity result(*this);
+            result.scaleInPlace(-1.0);
+            return result;
+        }
+
+        Velocity &Velocity::operator*=(double factor)
+        {
+            scaleInPlace(factor);
+            return *this;
+        }
+
+        Velocity &Velocity::operator/=(double divisor)
+        {
+            scaleInPlace(1.0 / divisor);
+            return *this;
+        }
+
+        Velocity Velocity::operator*(double factor) const
+        {
+            Velocity result(*this);
+            result *= factor;
+            return result;
+        }
+
+        Velocity Velocity::operator/(double divisor) const
+        {
+            Velocity result(*this);
+            result /= divisor;
+            return result;
+        }
+
+        VelocityQty Velocity::toQuantity() const
+        {
+            return VelocityQty(Vector3<double>::fromArray(this->getValue()));
+        }
+
+        Velocity operator*(double factor, const Velocity &velocity)
+        {
+            return velocity * factor;
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
@@ -29,6 +29,7 @@
 #include "metre.h"
 #include <cmath>
 #include <numbers>
+#include <utility>
 
 namespace InertiaFX
 {
@@ -36,14 +37,21 @@ namespace Core
 {
     namespace SI
     {
-        // Constructor
-        Volume::Volume() :
-            _length(1.0), _width(1.0), _height(1.0), _radius(0.0), _type(Type::Box),
-            DerivedScalarQty(
+        const QuantityDescriptor &Volume::descriptor()
+        {
+            // Built once, on first use, and shared by every Volume instance
+            static const QuantityDescriptor descriptor(
                 "Volume", "V", "Represents the derived SI Volume quantity.",
                 std::make_unique<DerivedPhysicalUnit>(
                     std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."));
+            return descriptor;
+        }
+
+        // Constructor
+        Volume::Volume() :
+            DerivedScalarQty(descriptor()), _length(1.0), _width(1.0), _height(1.0), _radius(0.0),
+            _type(Type::Box)
         {
             // Store internally in base units
             this->_value = 1.0;
@@ -54,17 +62,13 @@ namespace Core
 
         // Constructor
         Volume::Volume(double length, double width, double height, DecimalPrefix::Name prefix) :
-            _length(length), _width(width), _height(height), _radius(0.0), _type(Type::Box),
-            DerivedScalarQty(
-                "Volume", "V", "Represents the derived SI Volume quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+            DerivedScalarQty(descriptor()), _length(length), _width(width), _height(height),
+            _radius(0.0), _type(Type::Box)
         {
             // Store internally in base units
-            this->_value = length * DecimalPrefix::getMultiplier(prefix) * width *
-                           DecimalPrefix::getMultiplier(prefix) * height *
-                           DecimalPrefix::getMultiplier(prefix);
+            const double multiplier = DecimalPrefix::getMultiplier(prefix);
+            this->_value =
+                length * multiplier * width * multiplier * height * multiplier;
 
             // Optionally store the chosen prefix for reference or user logic
             this->_prefix = prefix;
@@ -72,17 +76,13 @@ namespace Core
 
         // Constructor
         Volume::Volume(double length, double width, double height, DecimalPrefix::Symbol prefix) :
-            _length(length), _width(width), _height(height), _radius(0.0), _type(Type::Box),
-            DerivedScalarQty(
-                "Volume", "V", "Represents the derived SI Volume quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+            DerivedScalarQty(descriptor()), _length(length), _width(width), _height(height),
+            _radius(0.0), _type(Type::Box)
         {
             // Store internally in base units
-            this->_value = length * DecimalPrefix::getMultiplier(prefix) * width *
-                           DecimalPrefix::getMultiplier(prefix) * height *
-                           DecimalPrefix::getMultiplier(prefix);
+            const double multiplier = DecimalPrefix::getMultiplier(prefix);
+            this->_value =
+                length * multiplier * width * multiplier * height * multiplier;
 
             // Optionally store the chosen prefix for reference or user logic
             this->_prefix = static_cast<DecimalPrefix::Name>(prefix);
@@ -90,12 +90,8 @@ namespace Core
 
         // Constructor
         Volume::Volume(double radius, DecimalPrefix::Name prefix) :
-            _length(0.0), _width(0.0), _height(0.0), _radius(radius), _type(Type::Sphere),
-            DerivedScalarQty(
-                "Volume", "V", "Represents the derived SI Volume quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+            DerivedScalarQty(descriptor()), _length(0.0), _width(0.0), _height(0.0),
+            _radius(radius), _type(Type::Sphere)
         {
             // Store internally in base units
             this->_value = (4.0 / 3.0) * std::numbers::pi *
@@ -107,12 +103,8 @@ namespace Core
 
         // Constructor
         Volume::Volume(double radius, DecimalPrefix::Symbol prefix) :
-            _length(0.0), _width(0.0), _height(0.0), _radius(radius), _type(Type::Sphere),
-            DerivedScalarQty(
-                "Volume", "V", "Represents the derived SI Volume quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+            DerivedScalarQty(descriptor()), _length(0.0), _width(0.0), _height(0.0),
+            _radius(radius), _type(Type::Sphere)
         {
 
             // Store internally in base units
@@ -124,22 +116,9 @@ namespace Core
         }
 
         Volume::Volume(const Volume &other) :
-            DerivedScalarQty(
-                "Volume", "V", "Represents the derived SI Volume quantity.",
-                std::make_unique<DerivedPhysicalUnit>(
-                    std::vector<PhysicalUnitPower>{PhysicalUnitPower{std::make_unique<Metre>(), 3}},
-                    "The cubic metre, symbol m^3, is an SI coherent derived unit of volume."))
+            DerivedScalarQty(other), _length(other._length), _width(other._width),
+            _height(other._height), _radius(other._radius), _type(other._type)
         {
-            // Copy constructor
-            _value  = other._value;
-            _unit   = other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
-            _prefix = other._prefix;
-
-            _length = other._length;
-            _width  = other._width;
-            _height = other._height;
-            _radius = other._radius;
-            _type   = other._type;
         }
 
         Volume &Volume::operator=(const Volume &other)
@@ -147,21 +126,35 @@ namespace Core
             // Copy assignment operator
             if (this != &other)
             {
-                _value  = other._value;
-                _prefix = other._prefix;
+                DerivedScalarQty::operator=(other);
 
                 _length = other._length;
                 _width  = other._width;
                 _height = other._height;
                 _radius = other._radius;
                 _type   = other._type;
+            }
+            return *this;
+        }
 
-                // If there's an existing owned object, remove it
-                _unit.reset();
+        Volume::Volume(Volume &&other) noexcept :
+            DerivedScalarQty(std::move(other)), _length(other._length), _width(other._width),
+            _height(other._height), _radius(other._radius), _type(other._type)
+        {
+        }
 
-                // Deep-copy from other
-                _unit =
-                    other._unit ? std::unique_ptr<IPhysicalUnit>(other._unit->clone()) : nullptr;
+        Volume &Volume::operator=(Volume &&other) noexcept
+        {
+            // Move assignment operator
+            if (this != &other)
+            {
+                DerivedScalarQty::operator=(std::move(other));
+
+                _length = other._length;
+                _width  = other._width;
+                _height = other._height;
+                _radius = other._radius;
+                _type   = other._type;
             }
             return *this;
         }
@@ -198,6 +191,10 @@ namespace Core
             return _type;
         }
 
+        VolumeQty Volume::toQuantity() const
+        {
+            return VolumeQty(this->getValue());
+        }
     }  // namespace SI
 }  // namespace Core
 }  // namespace InertiaFX
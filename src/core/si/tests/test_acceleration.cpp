@@ -1,6 +1,8 @@
 #include "acceleration.h"
 #include <array>
 #include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -121,4 +123,40 @@ TEST_F(AccelerationTest, AdditionOperator)
     EXPECT_DOUBLE_EQ(result.getValue()[0], 5.0);
     EXPECT_DOUBLE_EQ(result.getValue()[1], 7.0);
     EXPECT_DOUBLE_EQ(result.getValue()[2], 9.0);
-}
\ No newline at end of file
+}
+
+TEST_F(AccelerationTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Acceleration>);
+    static_assert(std::is_nothrow_move_assignable_v<Acceleration>);
+
+    Acceleration source({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    Acceleration moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Acceleration");
+    EXPECT_DOUBLE_EQ(moved.getValue()[0], 1e-3);
+    EXPECT_DOUBLE_EQ(moved.getValue()[2], 3e-3);
+
+    Acceleration assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue()[1], 2e-3);
+}
+
+TEST_F(AccelerationTest, CompoundAssignmentOperators)
+{
+    Acceleration acceleration({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    acceleration += Acceleration({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    // The sum is kept in base prefix, which operator== takes into account
+    EXPECT_DOUBLE_EQ(acceleration.getValue()[0], 1.001);
+    EXPECT_TRUE(acceleration == Acceleration({1.001, 1.002, 1.003}, DecimalPrefix::Name::base));
+    EXPECT_FALSE(acceleration == Acceleration({1001.0, 1002.0, 1003.0}, DecimalPrefix::Name::milli));
+
+    acceleration -= Acceleration({1.001, 1.002, 1.003}, DecimalPrefix::Name::base);
+    EXPECT_DOUBLE_EQ(acceleration.squaredNorm(), 0.0);
+
+    acceleration = Acceleration({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    acceleration *= 2.0;
+    EXPECT_DOUBLE_EQ(acceleration.getValue()[1], 4e-3);
+    acceleration /= 4.0;
+    EXPECT_DOUBLE_EQ(acceleration.getValue()[2], 1.5e-3);
+}
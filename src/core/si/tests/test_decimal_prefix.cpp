@@ -1,5 +1,6 @@
 ﻿#include <decimal_prefix.h>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace InertiaFX::Core::SI;
 
@@ -175,4 +176,61 @@ TEST(DecimalPrefixTests, GetCorrectMultiplierFromPrefixSymbol)
     EXPECT_DOUBLE_EQ(DecimalPrefix::getMultiplier(DecimalPrefix::Symbol::y), 1e-24);
     EXPECT_DOUBLE_EQ(DecimalPrefix::getMultiplier(DecimalPrefix::Symbol::r), 1e-27);
     EXPECT_DOUBLE_EQ(DecimalPrefix::getMultiplier(DecimalPrefix::Symbol::q), 1e-30);
-}
\ No newline at end of file
+}
+
+TEST(DecimalPrefixTests, MultiplierIsConstexpr)
+{
+    static_assert(DecimalPrefix::getMultiplier(DecimalPrefix::Name::kilo) == 1e3);
+    static_assert(DecimalPrefix::getMultiplier(DecimalPrefix::Symbol::mu) == 1e-6);
+
+    // The table holds exact literals, so no rounding from repeated pow() calls
+    EXPECT_EQ(DecimalPrefix::getMultiplier(DecimalPrefix::Name::milli), 1e-3);
+    EXPECT_EQ(DecimalPrefix::getMultiplier(DecimalPrefix::Name::quecto), 1e-30);
+}
+
+TEST(DecimalPrefixTests, RescaleScalarSpan)
+{
+    std::vector<double> values = {1.0, 2.5, -4.0};
+    DecimalPrefix::rescale(values, DecimalPrefix::Name::kilo, DecimalPrefix::Name::milli);
+
+    EXPECT_DOUBLE_EQ(values[0], 1e6);
+    EXPECT_DOUBLE_EQ(values[1], 2.5e6);
+    EXPECT_DOUBLE_EQ(values[2], -4e6);
+
+    DecimalPrefix::rescale(values, DecimalPrefix::Symbol::m, DecimalPrefix::Symbol::k);
+
+    EXPECT_DOUBLE_EQ(values[0], 1.0);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+    EXPECT_DOUBLE_EQ(values[2], -4.0);
+}
+
+TEST(DecimalPrefixTests, RescaleVectorSpan)
+{
+    std::vector<std::array<double, 3>> values = {{1.0, 2.0, 3.0}, {-1.0, 0.0, 0.5}};
+    DecimalPrefix::rescale(values, DecimalPrefix::Name::base, DecimalPrefix::Name::centi);
+
+    EXPECT_DOUBLE_EQ(values[0][0], 100.0);
+    EXPECT_DOUBLE_EQ(values[0][1], 200.0);
+    EXPECT_DOUBLE_EQ(values[0][2], 300.0);
+    EXPECT_DOUBLE_EQ(values[1][0], -100.0);
+    EXPECT_DOUBLE_EQ(values[1][1], 0.0);
+    EXPECT_DOUBLE_EQ(values[1][2], 50.0);
+}
+
+TEST(DecimalPrefixTests, RescaleFactorIsExact)
+{
+    // 1e3 / 1e-3 rounds twice; the factor must be the single power of ten 1e6
+    std::vector<double> values = {1.0, 3.0};
+    DecimalPrefix::rescale(values, DecimalPrefix::Name::kilo, DecimalPrefix::Name::milli);
+    EXPECT_EQ(values[0], 1e6);
+    EXPECT_EQ(values[1], 3e6);
+
+    // Prefixes at both ends of the table
+    std::vector<std::array<double, 3>> vectors = {{1.0, 1.0, 1.0}};
+    DecimalPrefix::rescale(vectors, DecimalPrefix::Name::quetta, DecimalPrefix::Name::quecto);
+    EXPECT_EQ(vectors[0][0], 1e60);
+
+    vectors = {{1.0, 1.0, 1.0}};
+    DecimalPrefix::rescale(vectors, DecimalPrefix::Name::quecto, DecimalPrefix::Name::quetta);
+    EXPECT_EQ(vectors[0][2], 1e-60);
+}
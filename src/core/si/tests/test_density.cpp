@@ -3,6 +3,8 @@
 #include <cmath>
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace InertiaFX::Core::SI;
@@ -129,4 +131,19 @@ TEST_F(DensityTest, AdditionOperator)
     auto result = density1 + density2;
 
     EXPECT_DOUBLE_EQ(result.getValue(), 3.0);
-}
\ No newline at end of file
+}
+
+TEST_F(DensityTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Density>);
+    static_assert(std::is_nothrow_move_assignable_v<Density>);
+
+    Density source(2.5, DecimalPrefix::Name::kilo);
+    Density moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Density");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 2500.0);
+
+    Density assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 2500.0);
+}
@@ -3,6 +3,8 @@
 #include <array>
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace InertiaFX::Core::SI;
@@ -107,4 +109,40 @@ TEST_F(ForceTest, AdditionOperator)
     EXPECT_DOUBLE_EQ(result.getValue()[0], value1[0] + value2[0]);
     EXPECT_DOUBLE_EQ(result.getValue()[1], value1[1] + value2[1]);
     EXPECT_DOUBLE_EQ(result.getValue()[2], value1[2] + value2[2]);
-}
\ No newline at end of file
+}
+
+TEST_F(ForceTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Force>);
+    static_assert(std::is_nothrow_move_assignable_v<Force>);
+
+    Force source({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    Force moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Force");
+    EXPECT_DOUBLE_EQ(moved.getValue()[0], 1e-3);
+    EXPECT_DOUBLE_EQ(moved.getValue()[2], 3e-3);
+
+    Force assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue()[1], 2e-3);
+}
+
+TEST_F(ForceTest, CompoundAssignmentOperators)
+{
+    Force force({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+    force += Force({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    // The sum is kept in base prefix, which operator== takes into account
+    EXPECT_DOUBLE_EQ(force.getValue()[0], 1001.0);
+    EXPECT_TRUE(force == Force({1001.0, 2001.0, 3001.0}, DecimalPrefix::Name::base));
+    EXPECT_FALSE(force == Force({1.001, 2.001, 3.001}, DecimalPrefix::Name::kilo));
+
+    force -= Force({1001.0, 2001.0, 3001.0}, DecimalPrefix::Name::base);
+    EXPECT_DOUBLE_EQ(force.squaredNorm(), 0.0);
+
+    force = Force({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+    force *= 2.0;
+    EXPECT_DOUBLE_EQ(force.getValue()[1], 4e3);
+    force /= 4.0;
+    EXPECT_DOUBLE_EQ(force.getValue()[2], 1.5e3);
+}
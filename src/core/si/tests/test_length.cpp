@@ -3,6 +3,8 @@
 #include "metre.h"
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -102,4 +104,19 @@ TEST_F(LengthTest, AdditionOperator)
     auto result = length1 + length2;
 
     EXPECT_DOUBLE_EQ(result.getValue(), 3.0);
-}
\ No newline at end of file
+}
+
+TEST_F(LengthTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Length>);
+    static_assert(std::is_nothrow_move_assignable_v<Length>);
+
+    Length source(2.5, DecimalPrefix::Name::kilo);
+    Length moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Length");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 2500.0);
+
+    Length assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 2500.0);
+}
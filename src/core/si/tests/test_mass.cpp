@@ -3,6 +3,8 @@
 #include "mass.h"
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -129,4 +131,19 @@ TEST_F(MassTest, AdditionOperator)
     auto result = mass1 + mass2;
 
     EXPECT_DOUBLE_EQ(result.getValue(), 3.0);
-}
\ No newline at end of file
+}
+
+TEST_F(MassTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Mass>);
+    static_assert(std::is_nothrow_move_assignable_v<Mass>);
+
+    Mass source(2.5, DecimalPrefix::Name::kilo);
+    Mass moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Mass");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 2500.0);
+
+    Mass assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 2500.0);
+}
@@ -1,6 +1,8 @@
 #include "position.h"
 #include <array>
 #include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -109,4 +111,40 @@ TEST_F(PositionTest, AdditionOperator)
     EXPECT_DOUBLE_EQ(result.getValue()[0], 5.0);
     EXPECT_DOUBLE_EQ(result.getValue()[1], 7.0);
     EXPECT_DOUBLE_EQ(result.getValue()[2], 9.0);
-}
\ No newline at end of file
+}
+
+TEST_F(PositionTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Position>);
+    static_assert(std::is_nothrow_move_assignable_v<Position>);
+
+    Position source({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    Position moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Position");
+    EXPECT_DOUBLE_EQ(moved.getValue()[0], 1e-3);
+    EXPECT_DOUBLE_EQ(moved.getValue()[2], 3e-3);
+
+    Position assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue()[1], 2e-3);
+}
+
+TEST_F(PositionTest, CompoundAssignmentOperators)
+{
+    Position position({100.0, 200.0, 300.0}, DecimalPrefix::Name::centi);
+    position += Position({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    // The sum is kept in base prefix, which operator== takes into account
+    EXPECT_DOUBLE_EQ(position.getValue()[0], 2.0);
+    EXPECT_TRUE(position == Position({2.0, 3.0, 4.0}, DecimalPrefix::Name::base));
+    EXPECT_FALSE(position == Position({200.0, 300.0, 400.0}, DecimalPrefix::Name::centi));
+
+    position -= Position({2.0, 3.0, 4.0}, DecimalPrefix::Name::base);
+    EXPECT_DOUBLE_EQ(position.squaredNorm(), 0.0);
+
+    position = Position({100.0, 200.0, 300.0}, DecimalPrefix::Name::centi);
+    position *= 2.0;
+    EXPECT_DOUBLE_EQ(position.getValue()[1], 4.0);
+    position /= 4.0;
+    EXPECT_DOUBLE_EQ(position.getValue()[2], 1.5);
+}
@@ -3,6 +3,8 @@
 #include <array>
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace InertiaFX::Core::SI;
@@ -118,3 +120,39 @@ TEST_F(PressureTest, AdditionOperator)
     EXPECT_DOUBLE_EQ(result.getValue()[1], 7.0);
     EXPECT_DOUBLE_EQ(result.getValue()[2], 9.0);
 }
+
+TEST_F(PressureTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Pressure>);
+    static_assert(std::is_nothrow_move_assignable_v<Pressure>);
+
+    Pressure source({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    Pressure moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Pressure");
+    EXPECT_DOUBLE_EQ(moved.getValue()[0], 1e-3);
+    EXPECT_DOUBLE_EQ(moved.getValue()[2], 3e-3);
+
+    Pressure assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue()[1], 2e-3);
+}
+
+TEST_F(PressureTest, CompoundAssignmentOperators)
+{
+    Pressure pressure({1.0, 2.0, 3.0}, DecimalPrefix::Name::mega);
+    pressure += Pressure({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    // The sum is kept in base prefix, which operator== takes into account
+    EXPECT_DOUBLE_EQ(pressure.getValue()[0], 1000001.0);
+    EXPECT_TRUE(pressure == Pressure({1000001.0, 2000001.0, 3000001.0}, DecimalPrefix::Name::base));
+    EXPECT_FALSE(pressure == Pressure({1.000001, 2.000001, 3.000001}, DecimalPrefix::Name::mega));
+
+    pressure -= Pressure({1000001.0, 2000001.0, 3000001.0}, DecimalPrefix::Name::base);
+    EXPECT_DOUBLE_EQ(pressure.squaredNorm(), 0.0);
+
+    pressure = Pressure({1.0, 2.0, 3.0}, DecimalPrefix::Name::mega);
+    pressure *= 2.0;
+    EXPECT_DOUBLE_EQ(pressure.getValue()[1], 4e6);
+    pressure /= 4.0;
+    EXPECT_DOUBLE_EQ(pressure.getValue()[2], 1.5e6);
+}
@@ -0,0 +1,64 @@
+#include "force.h"
+#include "mass.h"
+#include "quantity.h"
+#include "velocity.h"
+#include <gtest/gtest.h>
+#include <type_traits>
+
+using namespace InertiaFX::Core::SI;
+
+static_assert(sizeof(VelocityQty) == 3 * sizeof(double));
+static_assert(sizeof(MassQty) == sizeof(double));
+static_assert(std::is_trivially_copyable_v<ForceQty>);
+static_assert(std::is_same_v<decltype(MassQty{} * AccelerationQty{}), ForceQty>);
+static_assert(std::is_same_v<decltype(ForceQty{} / MassQty{}), AccelerationQty>);
+static_assert(std::is_same_v<decltype(VelocityQty{} * TimeQty{}), PositionQty>);
+static_assert(std::is_same_v<decltype(PositionQty{} / TimeQty{}), VelocityQty>);
+static_assert(std::is_same_v<decltype(MassQty{} / VolumeQty{}), DensityQty>);
+
+TEST(QuantityTest, ConstexprArithmetic)
+{
+    constexpr MassQty mass(2.0);
+    constexpr AccelerationQty acceleration(Vector3<double>{1.0, 2.0, 3.0});
+    constexpr ForceQty force = mass * acceleration;
+
+    static_assert(force.value() == Vector3<double>{2.0, 4.0, 6.0});
+    EXPECT_DOUBLE_EQ(force.value().z, 6.0);
+}
+
+TEST(QuantityTest, SameDimensionArithmetic)
+{
+    LengthQty a(1.5);
+    LengthQty b(0.5);
+
+    EXPECT_DOUBLE_EQ((a + b).value(), 2.0);
+    EXPECT_DOUBLE_EQ((a - b).value(), 1.0);
+    EXPECT_DOUBLE_EQ((-a).value(), -1.5);
+    EXPECT_DOUBLE_EQ((a * 2.0).value(), 3.0);
+    EXPECT_DOUBLE_EQ((a / 3.0).value(), 0.5);
+    EXPECT_TRUE(b < a);
+    EXPECT_TRUE(a == LengthQty(1.5));
+}
+
+TEST(QuantityTest, ConvertsFromAndToVelocity)
+{
+    Velocity velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+    VelocityQty quantity = velocity.toQuantity();
+
+    EXPECT_DOUBLE_EQ(quantity.value().x, 1000.0);
+    EXPECT_DOUBLE_EQ(quantity.value().y, 2000.0);
+    EXPECT_DOUBLE_EQ(quantity.value().z, 3000.0);
+
+    Velocity roundTrip(quantity);
+    EXPECT_TRUE(roundTrip == Velocity({1000.0, 2000.0, 3000.0}, DecimalPrefix::Name::base));
+}
+
+TEST(QuantityTest, ConvertsFromAndToForce)
+{
+    Mass mass(3.0, DecimalPrefix::Name::base);
+    Force force(mass.toQuantity() * AccelerationQty(Vector3<double>{0.0, 0.0, -9.81}));
+
+    EXPECT_EQ(force.getName(), "Force");
+    EXPECT_DOUBLE_EQ(force.getValue()[0], 0.0);
+    EXPECT_DOUBLE_EQ(force.getValue()[2], -29.43);
+}
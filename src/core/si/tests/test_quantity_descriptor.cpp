@@ -0,0 +1,52 @@
+#include "acceleration.h"
+#include "force.h"
+#include "mass.h"
+#include "quantity_descriptor.h"
+#include "velocity.h"
+#include "volume.h"
+#include <gtest/gtest.h>
+
+using namespace InertiaFX::Core::SI;
+
+TEST(QuantityDescriptorTests, DescriptorIsSharedPerType)
+{
+    EXPECT_EQ(&Velocity::descriptor(), &Velocity::descriptor());
+    EXPECT_EQ(&Mass::descriptor(), &Mass::descriptor());
+    EXPECT_NE(static_cast<const void *>(&Velocity::descriptor()),
+              static_cast<const void *>(&Acceleration::descriptor()));
+}
+
+TEST(QuantityDescriptorTests, DescriptorHoldsQuantityInfo)
+{
+    const QuantityDescriptor &descriptor = Force::descriptor();
+    EXPECT_EQ(descriptor.name, "Force");
+    EXPECT_EQ(descriptor.symbol, "F");
+    EXPECT_EQ(descriptor.description, "Represents the derived SI Force quantity.");
+    ASSERT_NE(descriptor.unit, nullptr);
+    EXPECT_EQ(descriptor.unit->getSymbol(), "N");
+}
+
+TEST(QuantityDescriptorTests, CopiesKeepDescriptorInfo)
+{
+    Velocity velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+    Velocity copy(velocity);
+    EXPECT_EQ(copy.getName(), "Velocity");
+    EXPECT_EQ(copy.getUnitSymbol(), "m s^-1");
+    EXPECT_EQ(copy, velocity);
+
+    Volume volume(1.0, 2.0, 3.0, DecimalPrefix::Name::base);
+    Volume assigned;
+    assigned = volume;
+    EXPECT_EQ(assigned.getName(), "Volume");
+    EXPECT_EQ(assigned.getUnitSymbol(), "m^3");
+    EXPECT_EQ(assigned, volume);
+}
+
+TEST(QuantityDescriptorTests, FundamentalCopyKeepsNameAndValue)
+{
+    Mass mass(2.0, DecimalPrefix::Name::kilo);
+    Mass copy(mass);
+    EXPECT_EQ(copy.getName(), "Mass");
+    EXPECT_EQ(copy.getUnitName(), "kilogram");
+    EXPECT_DOUBLE_EQ(copy.getValue(), 2000.0);
+}
@@ -0,0 +1,54 @@
+#include "quantity_operators.h"
+#include <gtest/gtest.h>
+#include <type_traits>
+
+using namespace InertiaFX::Core::SI;
+
+static_assert(std::is_same_v<decltype(Force() / Mass()), Acceleration>);
+static_assert(std::is_same_v<decltype(Mass() * Acceleration()), Force>);
+static_assert(std::is_same_v<decltype(Velocity() * Time()), Position>);
+static_assert(std::is_same_v<decltype(Acceleration() * Time()), Velocity>);
+static_assert(std::is_same_v<decltype(Mass() / Volume()), Density>);
+
+TEST(QuantityOperatorsTest, NewtonSecondLaw)
+{
+    Mass mass(2.0, DecimalPrefix::Name::base);
+    Acceleration acceleration({0.0, 0.0, -9.81}, DecimalPrefix::Name::base);
+
+    Force force = mass * acceleration;
+    EXPECT_EQ(force.getName(), "Force");
+    EXPECT_DOUBLE_EQ(force.getValue()[2], -19.62);
+    EXPECT_TRUE(force == acceleration * mass);
+
+    Acceleration recovered = force / mass;
+    EXPECT_TRUE(recovered == acceleration);
+}
+
+TEST(QuantityOperatorsTest, Kinematics)
+{
+    Velocity velocity({1.0, -2.0, 3.0}, DecimalPrefix::Name::base);
+    Time time(0.5, DecimalPrefix::Name::base);
+
+    Position displacement = velocity * time;
+    EXPECT_DOUBLE_EQ(displacement.getValue()[0], 0.5);
+    EXPECT_DOUBLE_EQ(displacement.getValue()[1], -1.0);
+    EXPECT_DOUBLE_EQ(displacement.getValue()[2], 1.5);
+    EXPECT_TRUE(displacement == time * velocity);
+    EXPECT_TRUE(displacement / time == velocity);
+
+    Acceleration acceleration({2.0, 0.0, 0.0}, DecimalPrefix::Name::base);
+    Velocity deltaV = acceleration * time;
+    EXPECT_DOUBLE_EQ(deltaV.getValue()[0], 1.0);
+    EXPECT_TRUE(deltaV == time * acceleration);
+    EXPECT_TRUE(deltaV / time == acceleration);
+}
+
+TEST(QuantityOperatorsTest, MassDensityVolume)
+{
+    Mass mass(8.0, DecimalPrefix::Name::base);
+    Volume volume(2.0, 2.0, 1.0, DecimalPrefix::Name::base);
+
+    Density density = mass / volume;
+    EXPECT_DOUBLE_EQ(density.getValue(), 2.0);
+    EXPECT_DOUBLE_EQ((density * volume).getValue(), 8.0);
+}
@@ -2,6 +2,8 @@
 #include "temperature.h"
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace InertiaFX::Core::SI;
@@ -99,3 +101,18 @@ TEST_F(TemperatureTest, AdditionOperator)
     Temperature result = t1 + t2;
     EXPECT_DOUBLE_EQ(result.getValue(), 300.0);
 }
+
+TEST_F(TemperatureTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Temperature>);
+    static_assert(std::is_nothrow_move_assignable_v<Temperature>);
+
+    Temperature source(2.5, DecimalPrefix::Name::kilo);
+    Temperature moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Temperature");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 2500.0);
+
+    Temperature assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 2500.0);
+}
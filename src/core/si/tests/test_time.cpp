@@ -3,6 +3,8 @@
 #include "si_time.h"
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -114,4 +116,19 @@ TEST_F(TimeTest, AdditionOperator)
     auto result = time1 + time2;
 
     EXPECT_DOUBLE_EQ(result.getValue(), 3.0);
-}
\ No newline at end of file
+}
+
+TEST_F(TimeTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Time>);
+    static_assert(std::is_nothrow_move_assignable_v<Time>);
+
+    Time source(2.5, DecimalPrefix::Name::kilo);
+    Time moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Time");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 2500.0);
+
+    Time assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 2500.0);
+}
@@ -1,6 +1,8 @@
 #include "velocity.h"
 #include <array>
 #include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
 
 using namespace InertiaFX::Core::SI;
 
@@ -118,4 +120,74 @@ TEST_F(VelocityTest, AdditionOperator)
     EXPECT_DOUBLE_EQ(result.getValue()[0], 5.0);
     EXPECT_DOUBLE_EQ(result.getValue()[1], 7.0);
     EXPECT_DOUBLE_EQ(result.getValue()[2], 9.0);
-}
\ No newline at end of file
+}
+
+TEST_F(VelocityTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Velocity>);
+    static_assert(std::is_nothrow_move_assignable_v<Velocity>);
+
+    Velocity source({1.0, 2.0, 3.0}, DecimalPrefix::Name::milli);
+    Velocity moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Velocity");
+    EXPECT_DOUBLE_EQ(moved.getValue()[0], 1e-3);
+    EXPECT_DOUBLE_EQ(moved.getValue()[2], 3e-3);
+
+    Velocity assigned;
+    assigned = std::move(moved);
+    EXPECT_DOUBLE_EQ(assigned.getValue()[1], 2e-3);
+}
+
+TEST_F(VelocityTest, CompoundAssignmentOperators)
+{
+    Velocity velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::kilo);
+    velocity += Velocity({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    EXPECT_DOUBLE_EQ(velocity.getValue()[0], 1001.0);
+    EXPECT_DOUBLE_EQ(velocity.getValue()[2], 3001.0);
+    EXPECT_TRUE(velocity == Velocity({1001.0, 2001.0, 3001.0}, DecimalPrefix::Name::base));
+
+    velocity -= Velocity({1001.0, 2001.0, 3001.0}, DecimalPrefix::Name::base);
+    EXPECT_DOUBLE_EQ(velocity.squaredNorm(), 0.0);
+
+    velocity = Velocity({1.0, 2.0, 3.0}, DecimalPrefix::Name::base);
+    velocity *= 2.0;
+    EXPECT_DOUBLE_EQ(velocity.getValue()[1], 4.0);
+    velocity /= 4.0;
+    EXPECT_DOUBLE_EQ(velocity.getValue()[2], 1.5);
+}
+
+TEST_F(VelocityTest, ArithmeticOperators)
+{
+    Velocity a({3.0, 0.0, 4.0}, DecimalPrefix::Name::base);
+    Velocity b({1.0, 1.0, 1.0}, DecimalPrefix::Name::base);
+
+    EXPECT_TRUE(a - b == Velocity({2.0, -1.0, 3.0}, DecimalPrefix::Name::base));
+    EXPECT_TRUE(-a == Velocity({-3.0, 0.0, -4.0}, DecimalPrefix::Name::base));
+    EXPECT_TRUE(a * 2.0 == 2.0 * a);
+    EXPECT_TRUE(a / 2.0 == Velocity({1.5, 0.0, 2.0}, DecimalPrefix::Name::base));
+}
+
+TEST_F(VelocityTest, VectorOperations)
+{
+    Velocity a({3.0, 0.0, 4.0}, DecimalPrefix::Name::base);
+    Velocity x({1.0, 0.0, 0.0}, DecimalPrefix::Name::base);
+    Velocity y({0.0, 1.0, 0.0}, DecimalPrefix::Name::base);
+
+    EXPECT_DOUBLE_EQ(a.dot(x), 3.0);
+    EXPECT_DOUBLE_EQ(a.squaredNorm(), 25.0);
+    EXPECT_DOUBLE_EQ(a.norm(), 5.0);
+
+    auto z = x.cross(y);
+    EXPECT_DOUBLE_EQ(z[0], 0.0);
+    EXPECT_DOUBLE_EQ(z[1], 0.0);
+    EXPECT_DOUBLE_EQ(z[2], 1.0);
+
+    a.normalise();
+    EXPECT_DOUBLE_EQ(a.norm(), 1.0);
+    EXPECT_DOUBLE_EQ(a.getValue()[0], 0.6);
+
+    Velocity zero;
+    zero.normalise();
+    EXPECT_DOUBLE_EQ(zero.norm(), 0.0);
+}
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <numbers>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace InertiaFX::Core::SI;
@@ -194,4 +196,24 @@ TEST_F(VolumeTest, GetType)
 
     Volume sphereVolume(1.0, DecimalPrefix::Name::base);
     EXPECT_EQ(sphereVolume.getType(), Volume::Type::Sphere);
-}
\ No newline at end of file
+}
+
+TEST_F(VolumeTest, MoveIsNoexcept)
+{
+    static_assert(std::is_nothrow_move_constructible_v<Volume>);
+    static_assert(std::is_nothrow_move_assignable_v<Volume>);
+
+    Volume source(2.0, 3.0, 4.0, DecimalPrefix::Name::base);
+    Volume moved(std::move(source));
+    EXPECT_EQ(moved.getName(), "Volume");
+    EXPECT_DOUBLE_EQ(moved.getValue(), 24.0);
+    EXPECT_EQ(moved.getType(), Volume::Type::Box);
+
+    Volume assigned;
+    assigned = std::move(moved);
+    auto [length, width, height] = assigned.getBoxDimensions();
+    EXPECT_DOUBLE_EQ(assigned.getValue(), 24.0);
+    EXPECT_DOUBLE_EQ(length, 2.0);
+    EXPECT_DOUBLE_EQ(width, 3.0);
+    EXPECT_DOUBLE_EQ(height, 4.0);
+}
@@ -0,0 +1,165 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity_format.h
+ * @brief Formatting of SI quantities in log messages and std::format.
+ *
+ * @details A quantity is written as its value in the prefix it was last given in, followed by the
+ * prefix and unit symbols: "2.5 km", or "(1, 0, -3) kN" for vector quantities. The value is
+ * written with std::to_chars and the symbols are appended from static storage, so
+ * ILogger::logFormat() formats a quantity without building any intermediate string. A
+ * placeholder's ":spec" applies to the value, e.g. "{:.3f}".
+ *
+ * Where the standard library provides std::format, the same quantities also get std::formatter
+ * specialisations.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_SI_FORMAT_QUANTITY_FORMAT_H
+#define INERTIAFX_CORE_SI_FORMAT_QUANTITY_FORMAT_H
+
+#include "derived_scalar_qty.h"
+#include "derived_vector_qty.h"
+#include "fundamental_qty.h"
+#include "log_format.h"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <type_traits>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        /**
+         * @brief True for the scalar quantity classes, e.g. Length or Density.
+         */
+        template <typename T>
+        constexpr bool IS_SCALAR_QUANTITY =
+            std::is_base_of_v<FundamentalQty, T> || std::is_base_of_v<DerivedScalarQty, T>;
+
+        /**
+         * @brief True for the vector quantity classes, e.g. Velocity or Force.
+         */
+        template <typename T>
+        constexpr bool IS_VECTOR_QUANTITY = std::is_base_of_v<DerivedVectorQty, T>;
+
+        /**
+         * @brief True for the scalar and vector quantity classes.
+         */
+        template <typename T>
+        constexpr bool IS_QUANTITY = IS_SCALAR_QUANTITY<T> || IS_VECTOR_QUANTITY<T>;
+
+        /**
+         * @brief Appends a scalar quantity as "value prefix+unit".
+         * @param out String the text is appended to.
+         * @param value The value, already scaled to prefix.
+         * @param prefix The prefix the value is expressed in.
+         * @param descriptor The quantity descriptor, for the unit symbol.
+         * @param spec The presentation options of the value.
+         */
+        void appendQuantity(std::string &out, double value, DecimalPrefix::Name prefix,
+                            const QuantityDescriptor &descriptor, const Tools::LogFormatSpec &spec);
+
+        /**
+         * @brief Appends a vector quantity as "(x, y, z) prefix+unit".
+         * @param out String the text is appended to.
+         * @param value The components, already scaled to prefix.
+         * @param prefix The prefix the components are expressed in.
+         * @param descriptor The quantity descriptor, for the unit symbol.
+         * @param spec The presentation options of each component.
+         */
+        void appendQuantity(std::string &out, const std::array<double, 3> &value,
+                            DecimalPrefix::Name prefix, const QuantityDescriptor &descriptor,
+                            const Tools::LogFormatSpec &spec);
+
+        /**
+         * @brief Appends a scalar or vector quantity in the prefix it was last given in.
+         * @param out String the text is appended to.
+         * @param quantity The quantity.
+         * @param spec The presentation options of the value.
+         */
+        template <typename Q>
+        void appendQuantity(std::string &out, const Q &quantity, const Tools::LogFormatSpec &spec)
+        {
+            const DecimalPrefix::Name prefix = quantity.getPrefix();
+            appendQuantity(out, quantity.getValueIn(prefix), prefix, quantity.getDescriptor(),
+                           spec);
+        }
+    }  // namespace SI
+
+    namespace Tools
+    {
+        /**
+         * @brief Writes SI quantities in log messages; see quantity_format.h.
+         */
+        template <typename T>
+        struct LogFormatter<T, std::enable_if_t<SI::IS_QUANTITY<T>>>
+        {
+            static void format(std::string &out, const T &quantity, const LogFormatSpec &spec)
+            {
+                SI::appendQuantity(out, quantity, spec);
+            }
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#if defined(__cpp_lib_format)
+/**
+ * @brief Formats SI quantities with std::format, accepting the same ":spec" as log messages.
+ */
+template <typename T>
+    requires InertiaFX::Core::SI::IS_QUANTITY<T>
+struct std::formatter<T, char>
+{
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context &context)
+    {
+        auto end = context.begin();
+        while (end != context.end() && *end != '}')
+        {
+            ++end;
+        }
+        _spec =
+            InertiaFX::Core::Tools::parseLogFormatSpec(std::string_view(context.begin(), end));
+        return end;
+    }
+
+    std::format_context::iterator format(const T &quantity, std::format_context &context) const
+    {
+        // Reused per thread, so formatting does not allocate once it has grown
+        thread_local std::string text;
+        text.clear();
+        InertiaFX::Core::SI::appendQuantity(text, quantity, _spec);
+        return std::copy(text.begin(), text.end(), context.out());
+    }
+
+  private:
+    InertiaFX::Core::Tools::LogFormatSpec _spec; /**< Parsed presentation options. */
+};
+#endif
+
+#endif  // INERTIAFX_CORE_SI_FORMAT_QUANTITY_FORMAT_H
@@ -0,0 +1,68 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quantity_format.cpp
+ * @brief Definition of the formatting of SI quantities.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "quantity_format.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace SI
+    {
+        namespace
+        {
+            // Appends " prefix+unit", e.g. " km"
+            void appendUnit(std::string &out, DecimalPrefix::Name prefix,
+                            const QuantityDescriptor &descriptor)
+            {
+                out.push_back(' ');
+                out += DecimalPrefix::getSymbolView(prefix);
+                out += descriptor.unitSymbol;
+            }
+        }  // namespace
+
+        void appendQuantity(std::string &out, double value, DecimalPrefix::Name prefix,
+                            const QuantityDescriptor &descriptor, const Tools::LogFormatSpec &spec)
+        {
+            Tools::appendLogFloat(out, value, spec);
+            appendUnit(out, prefix, descriptor);
+        }
+
+        void appendQuantity(std::string &out, const std::array<double, 3> &value,
+                            DecimalPrefix::Name prefix, const QuantityDescriptor &descriptor,
+                            const Tools::LogFormatSpec &spec)
+        {
+            out.push_back('(');
+            Tools::appendLogFloat(out, value[0], spec);
+            out += ", ";
+            Tools::appendLogFloat(out, value[1], spec);
+            out += ", ";
+            Tools::appendLogFloat(out, value[2], spec);
+            out.push_back(')');
+            appendUnit(out, prefix, descriptor);
+        }
+    }  // namespace SI
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,69 @@
+#include "decimal_prefix.h"
+#include "density.h"
+#include "force.h"
+#include "length.h"
+#include "logger.h"
+#include "memory_sink.h"
+#include "quantity_format.h"
+#include "si_time.h"
+#include "velocity.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace InertiaFX::Core::SI;
+using InertiaFX::Core::Tools::appendLogFormat;
+
+namespace
+{
+    template <typename... Args> std::string format(std::string_view format, const Args &...args)
+    {
+        std::string out;
+        appendLogFormat(out, format, args...);
+        return out;
+    }
+}  // namespace
+
+// Test scalar quantities are written in their prefix, with the unit symbol
+TEST(QuantityFormatTest, WritesScalarQuantities)
+{
+    EXPECT_EQ(format("{}", Length(2.5, DecimalPrefix::Name::kilo)), "2.5 km");
+    EXPECT_EQ(format("{}", Time(10, DecimalPrefix::Name::base)), "10 s");
+    EXPECT_EQ(format("{}", Time(500, DecimalPrefix::Symbol::m)), "500 ms");
+    EXPECT_EQ(format("{:.2f}", Length(1, DecimalPrefix::Name::base)), "1.00 m");
+    EXPECT_EQ(format("{}", Density(1000, DecimalPrefix::Name::base)),
+              "1000 " + Density().getUnitSymbol());
+}
+
+// Test vector quantities are written component by component
+TEST(QuantityFormatTest, WritesVectorQuantities)
+{
+    EXPECT_EQ(format("F = {}", Force({1.0, 0.0, -3.0}, DecimalPrefix::Name::kilo)),
+              "F = (1, 0, -3) kN");
+    const Velocity velocity({0.3, 0.5, 1.0}, DecimalPrefix::Name::base);
+    EXPECT_EQ(format("{:.1f}", velocity), "(0.3, 0.5, 1.0) " + velocity.getUnitSymbol());
+}
+
+// Test the text matches the quantity's own unit and prefix symbols
+TEST(QuantityFormatTest, MatchesDescriptorSymbols)
+{
+    const Force force({1.0, 2.0, 3.0}, DecimalPrefix::Name::micro);
+    EXPECT_EQ(format("{}", force),
+              "(1, 2, 3) " + DecimalPrefix::getSymbol(DecimalPrefix::Name::micro) +
+                  force.getUnitSymbol());
+    EXPECT_EQ(force.getDescriptor().unitSymbol, force.getUnitSymbol());
+    EXPECT_EQ(force.getPrefix(), DecimalPrefix::Name::micro);
+}
+
+// Test quantities can be logged directly
+TEST(QuantityFormatTest, LogsQuantities)
+{
+    using namespace InertiaFX::Core::Tools;
+    Logger logger;
+    logger.clearSinks();
+    logger.setStamps(0);
+    auto &sink = static_cast<MemorySink &>(logger.addSink(std::make_unique<MemorySink>(4)));
+
+    logger.logFormat(LogLevel::Info, "Moved {} in {}", Length(3, DecimalPrefix::Name::centi),
+                     Time(2, DecimalPrefix::Name::base));
+    EXPECT_EQ(sink.getLines().front(), "[Info] Moved 3 cm in 2 s\n");
+}
@@ -0,0 +1,78 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_decoder.cpp
+ * @brief Command line tool turning a binary log file into text.
+ *
+ * Usage: InertiaFX_LogDecoder <binary log> [text output]
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "binary_log_reader.h"
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <binary log> [text output]\n";
+        return 2;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input.is_open())
+    {
+        std::cerr << "Failed to open " << argv[1] << "\n";
+        return 1;
+    }
+
+    std::ofstream file;
+    if (argc == 3)
+    {
+        file.open(argv[2], std::ios::trunc | std::ios::binary);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << argv[2] << "\n";
+            return 1;
+        }
+    }
+    std::ostream &output = argc == 3 ? static_cast<std::ostream &>(file) : std::cout;
+
+    try
+    {
+        BinaryLogReader reader(input);
+        std::string line;
+        while (reader.next(line))
+        {
+            output << line;
+        }
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << argv[1] << ": " << error.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
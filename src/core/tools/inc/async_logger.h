@@ -0,0 +1,186 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file async_logger.h
+ * @brief Declaration of the AsyncLogger class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_ASYNC_LOGGER_H
+#define INERTIAFX_CORE_TOOLS_ASYNC_LOGGER_H
+
+#include "ilog_sink.h"
+#include "ilogger.h"
+#include "log_record.h"
+#include "mpsc_ring_buffer.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief What a producer does when the record queue is full.
+         */
+        enum class OverflowPolicy
+        {
+            Block,      /**< Wait until the writer thread frees a slot. */
+            DropNewest, /**< Discard the record being logged. */
+            DropOldest  /**< Discard the oldest queued record to make room. */
+        };
+
+        /**
+         * @class AsyncLogger
+         * @brief Logger that queues records and writes them to its sinks on a background thread.
+         *
+         * log() formats the message into a slot of a bounded lock-free ring buffer and returns;
+         * logDeferred() only copies its arguments there. Line formatting and I/O happen on the
+         * writer thread. Records reach every
+         * sink in the order they were queued.
+         */
+        class AsyncLogger : public ILogger
+        {
+          public:
+            /**
+             * @brief Constructs an AsyncLogger and starts its writer thread.
+             * @param capacity Number of queued records; rounded up to a power of two.
+             * @param policy Behaviour of log() when the queue is full.
+             */
+            explicit AsyncLogger(std::size_t capacity = 8192,
+                                 OverflowPolicy policy = OverflowPolicy::Block);
+
+            /**
+             * @brief Writes every queued record, flushes the sinks and stops the writer thread.
+             */
+            ~AsyncLogger();
+
+            AsyncLogger(const AsyncLogger &)            = delete;
+            AsyncLogger &operator=(const AsyncLogger &) = delete;
+
+            /**
+             * @brief Adds a destination for the records.
+             * @param sink A unique pointer to the sink. It is owned by the logger.
+             */
+            void addSink(std::unique_ptr<ILogSink> sink);
+
+            /**
+             * @brief Queues a formatted message at the given log level.
+             *
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string.
+             * @param ... Variadic arguments to format the string.
+             *
+             * Messages longer than LogRecord::MAX_MESSAGE_LENGTH - 1 characters are truncated.
+             */
+            void log(LogLevel level, const char *format, ...) override;
+
+            /**
+             * @brief Queues a deferred record; formatting happens on the writer thread.
+             *
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration.
+             * @param payload The arguments encoded by encodeLogArguments().
+             * @param length The payload length.
+             */
+            void logEncoded(LogLevel level, const char *format, const char *payload,
+                            std::uint32_t length) override;
+
+            /**
+             * @brief Enables the logger, allowing log output.
+             */
+            void enable() override;
+
+            /**
+             * @brief Disables the logger, suppressing all log output.
+             */
+            void disable() override;
+
+            /**
+             * @brief Sets the minimum severity level required for messages to be logged.
+             *
+             * @param level The threshold log level.
+             */
+            void setThreshold(LogLevel level) override;
+
+            /**
+             * @brief Blocks until every record queued before the call is written and flushed.
+             */
+            void flush();
+
+            /**
+             * @brief Retrieves the number of records discarded by the overflow policy.
+             * @return The dropped record count.
+             */
+            std::uint64_t getDroppedCount() const;
+
+          private:
+            /**
+             * @brief Body of the writer thread.
+             */
+            void writerLoop();
+
+            /**
+             * @brief Claims a slot, applying the overflow policy while the queue is full.
+             * @param fill Callable invoked as fill(LogRecord &) on the claimed slot.
+             */
+            template <typename Fill> void enqueue(Fill &&fill);
+
+            /**
+             * @brief Writes every queued record to the sinks.
+             * @return The number of records written.
+             */
+            std::size_t drain();
+
+            /**
+             * @brief Wakes the writer thread.
+             */
+            void signalWriter();
+
+            MpscRingBuffer<LogRecord> _queue; /**< Records waiting for the writer. */
+            const OverflowPolicy _policy;     /**< Behaviour when the queue is full. */
+
+            std::atomic<bool> _enabled;          /**< Indicates whether logging is enabled. */
+            std::atomic<LogLevel> _threshold;    /**< Minimum severity level to be logged. */
+            std::atomic<std::uint64_t> _dropped; /**< Records discarded when full. */
+
+            std::atomic<std::uint32_t> _signal;        /**< Bumped to wake the writer. */
+            std::atomic<std::uint64_t> _flushRequests; /**< Number of flush() calls. */
+            std::atomic<std::uint64_t> _flushesDone;   /**< flush() calls served. */
+            std::atomic<bool> _stopping;               /**< Set on destruction. */
+
+            std::mutex _sinkMutex;                         /**< Guards _sinks. */
+            std::vector<std::unique_ptr<ILogSink>> _sinks; /**< Destinations of the records. */
+            LogRecord _current;                            /**< Record being written. */
+            std::string _line;                             /**< Writer's line buffer. */
+            std::thread _writer;                           /**< Writer thread. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_ASYNC_LOGGER_H
@@ -0,0 +1,88 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file binary_file_sink.h
+ * @brief Declaration of the BinaryFileSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_BINARY_FILE_SINK_H
+#define INERTIAFX_CORE_TOOLS_BINARY_FILE_SINK_H
+
+#include "ilog_sink.h"
+#include <fstream>
+#include <string>
+#include <unordered_set>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @class BinaryFileSink
+         * @brief Stores raw records in a binary log file, leaving the formatting to a decoder.
+         *
+         * Deferred records are written as their encoded arguments and each format string once,
+         * so the writer thread never formats. Read the file back with BinaryLogReader or the
+         * InertiaFX_LogDecoder tool. See binary_log_format.h for the layout.
+         */
+        class BinaryFileSink : public ILogSink
+        {
+          public:
+            /**
+             * @brief Constructs a BinaryFileSink, replacing any existing file.
+             * @param filepath Path to the binary log file.
+             * @throws std::runtime_error If the file cannot be opened.
+             */
+            explicit BinaryFileSink(const std::string &filepath);
+
+            /**
+             * @brief Unused: the sink consumes records.
+             */
+            void write(LogLevel level, std::string_view line) override;
+
+            /**
+             * @copydoc ILogSink::flush()
+             */
+            void flush() override;
+
+            /**
+             * @copydoc ILogSink::consumesRecords()
+             */
+            bool consumesRecords() const override;
+
+            /**
+             * @copydoc ILogSink::writeRecord(const LogRecord &)
+             */
+            void writeRecord(const LogRecord &record) override;
+
+          private:
+            template <typename T> void writeValue(const T &value);
+
+            std::ofstream _fileStream;                 /**< Output file stream. */
+            std::unordered_set<const char *> _formats; /**< Format strings already written. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_BINARY_FILE_SINK_H
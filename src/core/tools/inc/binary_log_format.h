@@ -0,0 +1,63 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file binary_log_format.h
+ * @brief Layout of the binary log files written by BinaryFileSink.
+ *
+ * @details A file starts with BINARY_LOG_MAGIC and continues with entries, each introduced by
+ * one BinaryLogEntry byte. Values use the host byte order.
+ * - Format: uint64 format id, uint32 size, the format string characters.
+ * - Record: uint8 level, int64 nanoseconds since the epoch, int64 monotonic nanoseconds,
+ *   double simulation time (NaN when unset), uint64 step, uint64 format id (0 when the
+ *   payload is formatted text), uint32 payload size, the payload.
+ *
+ * A format entry always precedes the first record using its id.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_BINARY_LOG_FORMAT_H
+#define INERTIAFX_CORE_TOOLS_BINARY_LOG_FORMAT_H
+
+#include <cstdint>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief Magic bytes at the start of a binary log file, including the format version.
+         */
+        constexpr char BINARY_LOG_MAGIC[8] = {'I', 'F', 'X', 'B', 'L', 'O', 'G', '\x02'};
+
+        /**
+         * @brief Kind of a binary log entry.
+         */
+        enum class BinaryLogEntry : std::uint8_t
+        {
+            Format = 'F', /**< Defines a format string id. */
+            Record = 'R'  /**< One log record. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_BINARY_LOG_FORMAT_H
@@ -0,0 +1,80 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file binary_log_reader.h
+ * @brief Declaration of the BinaryLogReader class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_BINARY_LOG_READER_H
+#define INERTIAFX_CORE_TOOLS_BINARY_LOG_READER_H
+
+#include "log_record.h"
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <unordered_map>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @class BinaryLogReader
+         * @brief Decodes a binary log file written by BinaryFileSink into text lines.
+         */
+        class BinaryLogReader
+        {
+          public:
+            /**
+             * @brief Constructs a reader and checks the file header.
+             * @param input Stream positioned at the start of the file, opened in binary mode.
+             * @param stamps LogStamp flags of the decoded lines. Simulation stamps only appear
+             * on records logged with a simulation time.
+             * @throws std::runtime_error If the stream does not hold a binary log.
+             */
+            explicit BinaryLogReader(std::istream &input,
+                                     std::uint32_t stamps = LogStamp::Default |
+                                                            LogStamp::Simulation);
+
+            /**
+             * @brief Decodes the next record.
+             * @param line Output line, formatted like the text loggers.
+             * @return True if a record was read, false at the end of the file.
+             * @throws std::runtime_error If the file is truncated or corrupt.
+             */
+            bool next(std::string &line);
+
+          private:
+            template <typename T> bool readValue(T &value);
+            void readBytes(char *destination, std::size_t size);
+
+            std::istream &_input;                                    /**< Binary log stream. */
+            const std::uint32_t _stamps;                             /**< Stamps of the lines. */
+            std::unordered_map<std::uint64_t, std::string> _formats; /**< Format strings by id. */
+            LogRecord _record;                                       /**< Record being decoded. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_BINARY_LOG_READER_H
@@ -0,0 +1,58 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file console_sink.h
+ * @brief Declaration of the ConsoleSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_CONSOLE_SINK_H
+#define INERTIAFX_CORE_TOOLS_CONSOLE_SINK_H
+
+#include "ilog_sink.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @class ConsoleSink
+         * @brief Writes lines to stdout, or to stderr for Error and Critical records.
+         */
+        class ConsoleSink : public ILogSink
+        {
+          public:
+            /**
+             * @copydoc ILogSink::write(LogLevel, std::string_view)
+             */
+            void write(LogLevel level, std::string_view line) override;
+
+            /**
+             * @copydoc ILogSink::flush()
+             */
+            void flush() override;
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_CONSOLE_SINK_H
@@ -27,7 +27,8 @@
 #define INERTIAFX_CORE_TOOLS_FILELOGGER_H
 
 #include "Logger.h"
-#include <fstream>
+#include "file_sink.h"
+#include <string>
 
 namespace InertiaFX
 {
@@ -39,6 +40,10 @@ namespace Core
         /**
          * @class FileLogger
          * @brief Logger that optionally writes log messages to both console and a file.
+         *
+         * A Logger with a ConsoleSink and a FileSink. By default the file writes are batched and
+         * flushed on warnings and above, on flush() and on destruction; pass FileSinkOptions with
+         * flushEveryRecords = 1 to write the file after each message instead.
          */
         class FileLogger : public Logger
         {
@@ -52,8 +57,10 @@ namespace Core
              * @param filepath Path to the log file.
              * @param levelThreshold Minimum severity level to be logged.
              * @param printToFile If true, messages are also logged to the file.
+             * @param fileOptions Buffering, flush policy and rotation of the file.
              */
-            FileLogger(const std::string &filepath, LogLevel levelThreshold, bool printToFile);
+            FileLogger(const std::string &filepath, LogLevel levelThreshold, bool printToFile,
+                       const FileSinkOptions &fileOptions = FileSinkOptions());
 
             /**
              * @brief Destructor for FileLogger.
@@ -77,30 +84,19 @@ namespace Core
             /**
              * @brief Logs a formatted message at the given log level.
              *
-             * The message is written to console via Logger. If file logging is enabled,
-             * it is also written to the output file.
+             * The message is formatted once and written to the console and, if file logging is
+             * enabled, to the output file.
              *
              * @param level The severity level of the log message.
              * @param format A printf-style format string.
              * @param ... Variadic arguments to format the string.
+             * @throws std::runtime_error If format is longer than MAX_LOG_MESSAGE_LENGTH.
              */
             void log(LogLevel level, const char *format, ...) override;
 
           private:
-            bool _printToFile;     /**< Indicates whether the message is also written to file. */
-            std::string _filepath; /**< File path. */
-            std::ofstream _fileStream; /**< File stream for writing log messages. */
-
-            /**
-             * @brief Writes the formatted log to the file (if open).
-             *
-             * This replicates the parent's time stamp + level format, but outputs to std::ofstream.
-             *
-             * @param level LogLevel for the message.
-             * @param format The format string.
-             * @param args Variadic argument list (va_list).
-             */
-            void vLogFile(LogLevel level, const char *format, va_list args);
+            bool _printToFile;   /**< Indicates whether the message is also written to file. */
+            FileSink &_fileSink; /**< File sink, owned by the Logger. */
         };
 
     }  // namespace Tools
@@ -0,0 +1,181 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file file_sink.h
+ * @brief Declaration of the FileSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_FILE_SINK_H
+#define INERTIAFX_CORE_TOOLS_FILE_SINK_H
+
+#include "ilog_sink.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @struct FileSinkOptions
+         * @brief Buffering, flush policy and rotation of a FileSink.
+         *
+         * The flush policies combine: the buffer is written out as soon as any of them applies,
+         * when it is full, on flush() and on destruction.
+         */
+        struct FileSinkOptions
+        {
+            /** Bytes coalesced into one write. */
+            std::size_t bufferSize = 64 * 1024;
+
+            /** Flush after this many buffered records; 0 disables. */
+            std::size_t flushEveryRecords = 0;
+
+            /** Flush once the oldest buffered record is this old, on a timer; 0 disables. */
+            std::chrono::milliseconds flushInterval{0};
+
+            /** Flush on records at or above this level; std::nullopt disables. */
+            std::optional<LogLevel> flushLevel = LogLevel::Warning;
+
+            /** Flush from a std::terminate handler, installed while such sinks exist. */
+            bool flushOnTerminate = false;
+
+            /** Rotate the file before it exceeds this many bytes; 0 disables. */
+            std::size_t maxFileSize = 0;
+
+            /** Rotated files kept, "<path>.1" being the newest. */
+            std::size_t maxBackups = 3;
+        };
+
+        /**
+         * @class FileSink
+         * @brief Appends lines to a file through a coalescing buffer.
+         *
+         * Lines are gathered in memory and written with a single unbuffered fwrite, i.e. one
+         * write(2) on a file opened for appending (O_APPEND), following the flush policies of
+         * FileSinkOptions. With a flush interval, a timer thread writes out records that have
+         * waited that long, so lines do not linger in the buffer once logging goes quiet.
+         */
+        class FileSink : public ILogSink
+        {
+          public:
+            /**
+             * @brief Constructs a FileSink and opens its file in append mode.
+             * @param filepath Path to the log file.
+             * @param options Buffering, flush policy and rotation.
+             * @throws std::runtime_error If the file cannot be opened.
+             */
+            explicit FileSink(const std::string &filepath, const FileSinkOptions &options = {});
+
+            /**
+             * @brief Writes the buffered lines and closes the file.
+             */
+            ~FileSink();
+
+            FileSink(const FileSink &)            = delete;
+            FileSink &operator=(const FileSink &) = delete;
+
+            /**
+             * @copydoc ILogSink::write(LogLevel, std::string_view)
+             */
+            void write(LogLevel level, std::string_view line) override;
+
+            /**
+             * @copydoc ILogSink::flush()
+             */
+            void flush() override;
+
+            /**
+             * @brief Discards the content of the file, including buffered lines.
+             * @throws std::runtime_error If the file cannot be truncated.
+             */
+            void truncate();
+
+            /**
+             * @brief Retrieves the number of writes issued to the file.
+             * @return The write count.
+             */
+            std::size_t getWriteCount() const;
+
+            /**
+             * @brief Retrieves the number of buffered bytes not yet written.
+             * @return The buffered size.
+             */
+            std::size_t getBufferedSize() const;
+
+          private:
+            /**
+             * @brief std::terminate handler writing out the buffers of the registered sinks.
+             */
+            static void terminateHandler();
+
+            /**
+             * @brief Body of the timer thread: writes the buffer once its oldest record is due.
+             */
+            void flushPeriodically();
+
+            /**
+             * @brief Opens the file for appending and reads its size.
+             */
+            void open();
+
+            /**
+             * @brief Writes the buffer to the file; the caller holds _mutex.
+             */
+            void writeBuffer();
+
+            /**
+             * @brief Writes bytes to the file in one call; the caller holds _mutex.
+             */
+            void writeToFile(const char *data, std::size_t size);
+
+            /**
+             * @brief Renames the file to "<path>.1", shifting older backups, and reopens it.
+             */
+            void rotate();
+
+            const std::string _filepath;    /**< Path to the log file. */
+            const FileSinkOptions _options; /**< Buffering, flush policy and rotation. */
+
+            mutable std::mutex _mutex;                     /**< Guards against std::terminate. */
+            std::FILE *_file;                              /**< Unbuffered output file. */
+            std::string _buffer;                           /**< Lines not yet written. */
+            std::size_t _fileSize;                         /**< Bytes in the file. */
+            std::size_t _records;                          /**< Records since the last write. */
+            std::size_t _writes;                           /**< Writes issued to the file. */
+            std::chrono::steady_clock::time_point _oldest; /**< First buffered record. */
+            std::condition_variable _timerWake;            /**< Wakes the timer thread. */
+            bool _stopping;                                /**< Asks the timer thread to end. */
+            std::thread _timer;                            /**< Interval flusher, if any. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_FILE_SINK_H
@@ -0,0 +1,87 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ilog_sink.h
+ * @brief Declaration of the ILogSink interface.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_ILOG_SINK_H
+#define INERTIAFX_CORE_TOOLS_ILOG_SINK_H
+
+#include "ilogger.h"
+#include "log_record.h"
+#include <string_view>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @interface ILogSink
+         * @brief Destination of formatted log lines.
+         *
+         * A sink is only ever called from one thread at a time.
+         */
+        class ILogSink
+        {
+          public:
+            /**
+             * @brief Virtual destructor.
+             */
+            virtual ~ILogSink() = default;
+
+            /**
+             * @brief Writes one formatted line.
+             * @param level The severity level of the record.
+             * @param line The line, terminated by a newline.
+             */
+            virtual void write(LogLevel level, std::string_view line) = 0;
+
+            /**
+             * @brief Pushes any buffered output to its destination.
+             */
+            virtual void flush() = 0;
+
+            /**
+             * @brief Indicates the sink takes raw records through writeRecord() instead of lines.
+             * @return True for sinks that store records, e.g. in binary form.
+             */
+            virtual bool consumesRecords() const
+            {
+                return false;
+            }
+
+            /**
+             * @brief Writes one raw record; only called when consumesRecords() is true.
+             * @param record The record. Deferred records are not formatted yet.
+             */
+            virtual void writeRecord(const LogRecord &record)
+            {
+                (void)record;
+            }
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_ILOG_SINK_H
@@ -26,8 +26,16 @@
 #ifndef INERTIAFX_CORE_TOOLS_ILOGGER_H
 #define INERTIAFX_CORE_TOOLS_ILOGGER_H
 
+#include "log_arguments.h"
+#include "log_call_site.h"
+#include "log_clock.h"
+#include "log_format.h"
+#include <atomic>
 #include <cstdarg>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
 
 namespace InertiaFX
 {
@@ -87,6 +95,274 @@ namespace Core
              * @param level The threshold log level.
              */
             virtual void setThreshold(LogLevel level) = 0;
+
+            /**
+             * @brief Cheap inline check of whether a message would be logged.
+             * @param level The severity level of the message.
+             * @return False if the logger is disabled or level is below its threshold.
+             *
+             * Lets callers skip building arguments, and the virtual call, for messages that
+             * would be discarded. See the IFX_LOG_* macros in log_macros.h.
+             */
+            bool shouldLog(LogLevel level) const
+            {
+                return static_cast<int>(level) >= _activeLevel.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Selects the stamps written at the start of each line.
+             * @param stamps A combination of LogStamp flags; LogStamp::Default keeps the
+             * "[YYYY-MM-DD HH:MM:SS]" prefix only.
+             */
+            void setStamps(std::uint32_t stamps)
+            {
+                _stamps.store(stamps, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Retrieves the stamps written at the start of each line.
+             * @return A combination of LogStamp flags.
+             */
+            std::uint32_t getStamps() const
+            {
+                return _stamps.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Sets the simulation time and step recorded with the following messages.
+             * @param simulationTime The simulation time in seconds.
+             * @param step The simulation step number.
+             *
+             * Called by the engine after each step. The two values are stored separately, so a
+             * message logged concurrently may pair a time with the step before or after it.
+             */
+            void setSimulationStamp(double simulationTime, std::uint64_t step)
+            {
+                _simulationTime.store(simulationTime, std::memory_order_relaxed);
+                _simulationStep.store(step, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Stops recording a simulation time and step with the messages.
+             */
+            void clearSimulationStamp()
+            {
+                _simulationTime.store(NO_SIMULATION_TIME, std::memory_order_relaxed);
+                _simulationStep.store(0, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Retrieves the simulation time recorded with new messages.
+             * @return The simulation time in seconds, or NaN if none is set.
+             */
+            double getSimulationTime() const
+            {
+                return _simulationTime.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Retrieves the simulation step recorded with new messages.
+             * @return The step number; meaningless while getSimulationTime() is NaN.
+             */
+            std::uint64_t getSimulationStep() const
+            {
+                return _simulationStep.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Logs a message whose formatting may be deferred.
+             *
+             * The arguments are copied into a compact binary payload and the format string is
+             * kept by pointer; loggers that support it format later, off the calling thread.
+             *
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration, such
+             * as a string literal.
+             * @param args Arguments: integers, floating point numbers, enums, strings or
+             * pointers.
+             */
+            template <typename... Args>
+            void logDeferred(LogLevel level, const char *format, const Args &...args)
+            {
+                char payload[MAX_LOG_PAYLOAD];
+                const std::uint32_t length = encodeLogArguments(payload, sizeof(payload), args...);
+                logEncoded(level, format, payload, length);
+            }
+
+            /**
+             * @brief Logs a message with "{}" placeholders, formatted by the argument types.
+             *
+             * Nothing is formatted when shouldLog() rejects the level. Numbers are written with
+             * std::to_chars, and any type with a LogFormatter, such as the SI quantities of
+             * quantity_format.h, is written directly, without building a string first.
+             *
+             * @param level The severity level of the log message.
+             * @param format A format string, e.g. "Run Time: {}, Time Step: {:.3}".
+             * @param args The arguments; see appendLogFormat().
+             */
+            template <typename... Args>
+            void logFormat(LogLevel level, std::string_view format, const Args &...args)
+            {
+                if (shouldLog(level))
+                {
+                    const LogFormatArg list[] = {makeLogFormatArg(args)..., LogFormatArg{}};
+                    logFormatArgs(level, format, list, sizeof...(Args));
+                }
+            }
+
+            /**
+             * @brief Logs a deferred message unless its call site exceeded its rate.
+             *
+             * At most perSecond messages of the call site are logged per second. Once the
+             * window moves on, the number of messages suppressed meanwhile is logged first.
+             *
+             * @param site The call site, usually a static local; see IFX_LOG_DEBUG_RATE_LIMITED.
+             * @param perSecond Messages allowed per second.
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration.
+             * @param args Arguments, as for logDeferred().
+             */
+            template <typename... Args>
+            void logRateLimited(LogCallSite &site, std::uint32_t perSecond, LogLevel level,
+                                const char *format, const Args &...args)
+            {
+                if (shouldLog(level) && site.allowRate(perSecond))
+                {
+                    logSuppressedReport(site, level);
+                    logDeferred(level, format, args...);
+                }
+            }
+
+            /**
+             * @brief Logs the first deferred message of a call site, then one in every K.
+             *
+             * The number of skipped messages is logged at most once per
+             * LogCallSite::REPORT_INTERVAL, before a sampled message.
+             *
+             * @param site The call site, usually a static local; see IFX_LOG_DEBUG_SAMPLED.
+             * @param every Sampling period K.
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration.
+             * @param args Arguments, as for logDeferred().
+             */
+            template <typename... Args>
+            void logSampled(LogCallSite &site, std::uint32_t every, LogLevel level,
+                            const char *format, const Args &...args)
+            {
+                if (shouldLog(level) && site.allowSample(every))
+                {
+                    logSuppressedReport(site, level);
+                    logDeferred(level, format, args...);
+                }
+            }
+
+            /**
+             * @brief Logs the first deferred message of a call site only.
+             *
+             * Later messages are counted as suppressed; LogCallSite::reportAll() logs the
+             * count.
+             *
+             * @param site The call site, usually a static local; see IFX_LOG_DEBUG_ONCE.
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration.
+             * @param args Arguments, as for logDeferred().
+             */
+            template <typename... Args>
+            void logOnce(LogCallSite &site, LogLevel level, const char *format,
+                         const Args &...args)
+            {
+                if (shouldLog(level) && site.allowOnce())
+                {
+                    logDeferred(level, format, args...);
+                }
+            }
+
+            /**
+             * @brief Logs how many messages of a call site were suppressed.
+             * @param site The call site.
+             * @param level The severity level of the log message.
+             * @param count The number of suppressed messages.
+             */
+            void logSuppressedCount(const LogCallSite &site, LogLevel level, std::uint64_t count)
+            {
+                logDeferred(level, "%llu similar messages suppressed at %s:%u.",
+                            static_cast<unsigned long long>(count), site.getFile(),
+                            site.getLine());
+            }
+
+            /**
+             * @brief Logs a message from a format string and encoded arguments.
+             *
+             * The default implementation formats the message immediately and forwards it to
+             * log().
+             *
+             * @param level The severity level of the log message.
+             * @param format A printf-style format string with static storage duration.
+             * @param payload The arguments encoded by encodeLogArguments().
+             * @param length The payload length.
+             */
+            virtual void logEncoded(LogLevel level, const char *format, const char *payload,
+                                    std::uint32_t length)
+            {
+                std::string message;
+                formatLogArguments(format, payload, length, message);
+                log(level, "%s", message.c_str());
+            }
+
+            /**
+             * @brief Logs a message from a "{}" format string and type-erased arguments.
+             *
+             * The default implementation formats the message and forwards it to log().
+             *
+             * @param level The severity level of the log message.
+             * @param format The format string.
+             * @param args The arguments, made by makeLogFormatArg().
+             * @param count The number of arguments.
+             */
+            virtual void logFormatArgs(LogLevel level, std::string_view format,
+                                       const LogFormatArg *args, std::size_t count)
+            {
+                std::string message;
+                appendLogFormatArgs(message, format, args, count);
+                log(level, "%s", message.c_str());
+            }
+
+          protected:
+            /**
+             * @brief Updates the level checked by shouldLog().
+             * @param enabled Whether the logger is enabled.
+             * @param threshold The minimum severity level to be logged.
+             *
+             * Implementations call this whenever their enable flag or threshold changes.
+             * Until then shouldLog() lets every message through.
+             */
+            void setActiveLevel(bool enabled, LogLevel threshold)
+            {
+                _activeLevel.store(enabled ? static_cast<int>(threshold) : DISABLED_LEVEL,
+                                   std::memory_order_relaxed);
+            }
+
+          private:
+            /**
+             * @brief Logs the suppressed count of a call site if a report is due.
+             */
+            void logSuppressedReport(LogCallSite &site, LogLevel level)
+            {
+                const std::uint64_t count = site.takeSuppressedReport();
+                if (count > 0)
+                {
+                    logSuppressedCount(site, level, count);
+                }
+            }
+
+            static constexpr int DISABLED_LEVEL = 1 << 30; /**< Above every LogLevel. */
+            static constexpr double NO_SIMULATION_TIME =
+                std::numeric_limits<double>::quiet_NaN(); /**< Simulation time when unset. */
+
+            std::atomic<int> _activeLevel{0};                        /**< Lowest accepted level. */
+            std::atomic<std::uint32_t> _stamps{LogStamp::Default};   /**< LogStamp flags. */
+            std::atomic<double> _simulationTime{NO_SIMULATION_TIME}; /**< Stamped time, or NaN. */
+            std::atomic<std::uint64_t> _simulationStep{0};           /**< Stamped step. */
         };
     }  // namespace Tools
 }  // namespace Core
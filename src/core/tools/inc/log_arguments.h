@@ -0,0 +1,226 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_arguments.h
+ * @brief Compact binary encoding of log arguments for deferred formatting.
+ *
+ * @details A deferred log call keeps the format string pointer and copies its arguments into a
+ * small tagged byte payload; the printf-style formatting happens later, on the writer thread or
+ * offline. Each argument is one ArgumentType tag followed by its value: 8 bytes for numbers and
+ * pointers, or a 4-byte length and the characters for strings. Values use the host byte order.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_ARGUMENTS_H
+#define INERTIAFX_CORE_TOOLS_LOG_ARGUMENTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief Size of a log payload: a formatted message or encoded arguments.
+         */
+        constexpr std::size_t MAX_LOG_PAYLOAD = 512;
+
+        /**
+         * @brief Type tag preceding each encoded argument.
+         */
+        enum class ArgumentType : std::uint8_t
+        {
+            Int,     /**< Signed integer, stored as int64. */
+            UInt,    /**< Unsigned integer, stored as uint64. */
+            Double,  /**< Floating point, stored as double. */
+            String,  /**< Characters, stored as uint32 length and bytes. */
+            Pointer  /**< Address, stored as uint64. */
+        };
+
+        /**
+         * @class LogArgumentWriter
+         * @brief Appends tagged arguments to a fixed buffer, truncating what does not fit.
+         */
+        class LogArgumentWriter
+        {
+          public:
+            /**
+             * @brief Constructs a writer over a buffer.
+             * @param buffer Destination bytes.
+             * @param capacity Size of the buffer.
+             */
+            LogArgumentWriter(char *buffer, std::size_t capacity) :
+                _buffer(buffer), _capacity(capacity), _size(0), _truncated(false)
+            {
+            }
+
+            /**
+             * @brief Retrieves the number of bytes written.
+             * @return The payload length, which ends at the last argument written in full.
+             */
+            std::uint32_t size() const
+            {
+                return static_cast<std::uint32_t>(_size);
+            }
+
+            /**
+             * @brief Checks whether an argument was cut or left out for lack of space.
+             * @return True if the payload is truncated.
+             */
+            bool isTruncated() const
+            {
+                return _truncated;
+            }
+
+            /**
+             * @brief Encodes one argument; once one does not fit, it and all later ones are left
+             * out.
+             * @param value The argument.
+             */
+            template <typename T> void write(const T &value)
+            {
+                using Type = std::decay_t<T>;
+                if (_truncated)
+                {
+                    return;
+                }
+                if constexpr (std::is_array_v<T>)
+                {
+                    // Character arrays and literals are never null
+                    writeString(std::string_view(value));
+                }
+                else if constexpr (std::is_same_v<Type, bool>)
+                {
+                    writeNumber(ArgumentType::Int, static_cast<std::int64_t>(value));
+                }
+                else if constexpr (std::is_enum_v<Type>)
+                {
+                    write(static_cast<std::underlying_type_t<Type>>(value));
+                }
+                else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+                {
+                    writeNumber(ArgumentType::Int, static_cast<std::int64_t>(value));
+                }
+                else if constexpr (std::is_integral_v<Type>)
+                {
+                    writeNumber(ArgumentType::UInt, static_cast<std::uint64_t>(value));
+                }
+                else if constexpr (std::is_floating_point_v<Type>)
+                {
+                    writeNumber(ArgumentType::Double, static_cast<double>(value));
+                }
+                else if constexpr (std::is_same_v<Type, const char *> ||
+                                   std::is_same_v<Type, char *>)
+                {
+                    writeString(value != nullptr ? std::string_view(value) : "(null)");
+                }
+                else if constexpr (std::is_convertible_v<const Type &, std::string_view>)
+                {
+                    writeString(std::string_view(value));
+                }
+                else if constexpr (std::is_pointer_v<Type>)
+                {
+                    const auto address = reinterpret_cast<std::uintptr_t>(value);
+                    writeNumber(ArgumentType::Pointer, static_cast<std::uint64_t>(address));
+                }
+                else
+                {
+                    static_assert(sizeof(Type) == 0, "Unsupported deferred log argument type");
+                }
+            }
+
+          private:
+            template <typename N> void writeNumber(ArgumentType type, N number)
+            {
+                if (_size + 1 + sizeof(N) > _capacity)
+                {
+                    _truncated = true;
+                    return;
+                }
+                _buffer[_size++] = static_cast<char>(type);
+                std::memcpy(_buffer + _size, &number, sizeof(N));
+                _size += sizeof(N);
+            }
+
+            void writeString(std::string_view text)
+            {
+                constexpr std::size_t header = 1 + sizeof(std::uint32_t);
+                if (_size + header > _capacity)
+                {
+                    _truncated = true;
+                    return;
+                }
+                // Long strings are cut to the space left
+                const std::uint32_t length = static_cast<std::uint32_t>(
+                    text.size() < _capacity - _size - header ? text.size()
+                                                             : _capacity - _size - header);
+                _truncated                 = length < text.size();
+                _buffer[_size++] = static_cast<char>(ArgumentType::String);
+                std::memcpy(_buffer + _size, &length, sizeof(length));
+                _size += sizeof(length);
+                std::memcpy(_buffer + _size, text.data(), length);
+                _size += length;
+            }
+
+            char *_buffer;         /**< Destination bytes. */
+            std::size_t _capacity; /**< Size of the buffer. */
+            std::size_t _size;     /**< Bytes written so far. */
+            bool _truncated;       /**< An argument was cut or left out. */
+        };
+
+        /**
+         * @brief Encodes arguments for deferred formatting.
+         * @param buffer Destination bytes.
+         * @param capacity Size of the buffer.
+         * @param args The arguments, in format string order.
+         * @return The payload length.
+         */
+        template <typename... Args>
+        std::uint32_t encodeLogArguments(char *buffer, std::size_t capacity, const Args &...args)
+        {
+            LogArgumentWriter writer(buffer, capacity);
+            (writer.write(args), ...);
+            return writer.size();
+        }
+
+        /**
+         * @brief Formats a printf-style format string with encoded arguments.
+         * @param format The format string.
+         * @param payload The encoded arguments.
+         * @param length The payload length.
+         * @param out String the formatted text is appended to.
+         *
+         * Conversions are matched to arguments in order; numbers are converted to the type the
+         * conversion expects. Conversions without an argument are copied through unchanged.
+         */
+        void formatLogArguments(const char *format, const char *payload, std::uint32_t length,
+                                std::string &out);
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_ARGUMENTS_H
@@ -0,0 +1,166 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_call_site.h
+ * @brief Declaration of the LogCallSite class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_CALL_SITE_H
+#define INERTIAFX_CORE_TOOLS_LOG_CALL_SITE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        class ILogger;
+        enum class LogLevel;
+
+        /**
+         * @class LogCallSite
+         * @brief State of one logging statement: rate limit, sampling, log-once and the count
+         * of messages they suppressed.
+         *
+         * Meant as a static local of the statement, as the IFX_LOG_<LEVEL>_RATE_LIMITED,
+         * IFX_LOG_<LEVEL>_SAMPLED and IFX_LOG_<LEVEL>_ONCE macros declare it. The decisions are
+         * lock-free and may be taken from any thread; under contention the rate limit is
+         * approximate. Every call site registers itself so reportAll() can log the counts still
+         * unreported, e.g. at the end of a run.
+         */
+        class LogCallSite
+        {
+          public:
+            /**
+             * @brief Interval between two reports of suppressed messages of a call site.
+             */
+            static constexpr std::chrono::nanoseconds REPORT_INTERVAL = std::chrono::seconds(1);
+
+            /**
+             * @brief Constructs and registers a call site.
+             * @param file Source file of the statement, with static storage duration.
+             * @param line Source line of the statement.
+             */
+            LogCallSite(const char *file, unsigned int line);
+
+            /**
+             * @brief Unregisters the call site.
+             */
+            ~LogCallSite();
+
+            LogCallSite(const LogCallSite &)            = delete;
+            LogCallSite &operator=(const LogCallSite &) = delete;
+
+            /**
+             * @brief Lets at most limit messages through per period.
+             * @param limit Messages allowed per period.
+             * @param period Length of the window; one second by default.
+             * @return True if the message may be logged, false if it is suppressed.
+             */
+            bool allowRate(std::uint32_t limit,
+                           std::chrono::nanoseconds period = std::chrono::seconds(1));
+
+            /**
+             * @brief Lets the first message, then one in every K, through.
+             * @param every Sampling period K; 0 and 1 let every message through.
+             * @return True if the message may be logged, false if it is suppressed.
+             */
+            bool allowSample(std::uint32_t every);
+
+            /**
+             * @brief Lets the first message through and suppresses the following ones.
+             * @return True for the first call only.
+             */
+            bool allowOnce();
+
+            /**
+             * @brief Takes the suppressed count to report, at most once per interval.
+             * @param interval Minimum time since the previous report.
+             * @return Messages suppressed since the previous report, or 0 if there are none or
+             * a report is not due yet.
+             */
+            std::uint64_t takeSuppressedReport(std::chrono::nanoseconds interval = REPORT_INTERVAL);
+
+            /**
+             * @brief Retrieves the number of messages suppressed since construction.
+             * @return The suppressed count, reported or not.
+             */
+            std::uint64_t getSuppressedCount() const;
+
+            /**
+             * @brief Retrieves the source file of the statement.
+             * @return The file name.
+             */
+            const char *getFile() const;
+
+            /**
+             * @brief Retrieves the source line of the statement.
+             * @return The line number.
+             */
+            unsigned int getLine() const;
+
+            /**
+             * @brief Logs the unreported suppressed count of every call site that has one.
+             * @param logger Logger receiving one message per call site.
+             * @param level Severity level of the messages.
+             */
+            static void reportAll(ILogger &logger, LogLevel level);
+
+            /**
+             * @brief Returns every registered call site to its state at construction, discarding
+             * the unreported counts; meant for tests.
+             */
+            static void resetAll();
+
+          private:
+            /**
+             * @brief Counts a suppressed message.
+             */
+            void suppress();
+
+            /**
+             * @brief Returns the call site to its state at construction.
+             */
+            void reset();
+
+            const char *const _file;  /**< Source file. */
+            const unsigned int _line; /**< Source line. */
+
+            std::atomic<std::int64_t> _windowStart;  /**< Start of the rate window, in ns. */
+            std::atomic<std::uint32_t> _windowCount; /**< Calls in the rate window. */
+            std::atomic<std::uint64_t> _calls;       /**< Calls seen by allowSample(). */
+            std::atomic<bool> _logged;               /**< Set by the first allowOnce(). */
+            std::atomic<std::uint64_t> _suppressed;  /**< Suppressed since construction. */
+            std::atomic<std::uint64_t> _unreported;  /**< Suppressed since the last report. */
+            std::atomic<std::int64_t> _lastReport;   /**< Time of the last report, in ns. */
+
+            LogCallSite *_previous; /**< Previous registered call site. */
+            LogCallSite *_next;     /**< Next registered call site. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_CALL_SITE_H
@@ -0,0 +1,111 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_clock.h
+ * @brief Declaration of the log time stamps and the TimestampCache class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_CLOCK_H
+#define INERTIAFX_CORE_TOOLS_LOG_CLOCK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief Flags selecting the stamps at the start of each log line.
+         *
+         * The stamps appear in this order, each between brackets, before the level:
+         * "[2026-10-17 10:42:07.123456] [+12.345678] [t=0.5 s] [step 42] [Info] message".
+         */
+        namespace LogStamp
+        {
+            constexpr std::uint32_t Date           = 1u << 0; /**< Local date and time, to 1 s. */
+            constexpr std::uint32_t Microseconds   = 1u << 1; /**< Sub-second part of Date. */
+            constexpr std::uint32_t Monotonic      = 1u << 2; /**< Steady seconds since start. */
+            constexpr std::uint32_t SimulationTime = 1u << 3; /**< Simulation time, if set. */
+            constexpr std::uint32_t Step           = 1u << 4; /**< Simulation step, if set. */
+
+            constexpr std::uint32_t Default    = Date;                  /**< Historic format. */
+            constexpr std::uint32_t Simulation = SimulationTime | Step; /**< Engine progress. */
+        }  // namespace LogStamp
+
+        /**
+         * @brief Nanoseconds elapsed on the steady clock since the first call in the process.
+         * @return The monotonic time stamp of a record.
+         */
+        std::int64_t getLogMonotonicTime();
+
+        /**
+         * @class TimestampCache
+         * @brief Formats "YYYY-MM-DD HH:MM:SS" local times, only when the second changes.
+         *
+         * Converting to local time is costly, so consecutive records within the same second
+         * reuse the previous text. Not thread-safe: keep one cache per thread, as
+         * getThreadTimestampCache() does.
+         */
+        class TimestampCache
+        {
+          public:
+            /**
+             * @brief Constructs an empty cache.
+             */
+            TimestampCache();
+
+            /**
+             * @brief Formats the local date and time of a wall-clock second.
+             * @param seconds Seconds since the epoch.
+             * @return The text, valid until the next call.
+             */
+            std::string_view format(std::time_t seconds);
+
+            /**
+             * @brief Retrieves the number of times the text was rebuilt.
+             * @return The conversion count.
+             */
+            std::uint64_t getConversionCount() const;
+
+          private:
+            std::time_t _seconds;       /**< Second of the cached text. */
+            bool _valid;                /**< Whether _text holds a second yet. */
+            std::size_t _length;        /**< Length of the cached text. */
+            char _text[32];             /**< Cached text. */
+            std::uint64_t _conversions; /**< Number of conversions. */
+        };
+
+        /**
+         * @brief Retrieves the calling thread's timestamp cache.
+         * @return The cache, created on first use by each thread.
+         */
+        TimestampCache &getThreadTimestampCache();
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_CLOCK_H
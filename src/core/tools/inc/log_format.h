@@ -0,0 +1,218 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_format.h
+ * @brief Type-safe "{}" formatting of log messages.
+ *
+ * @details appendLogFormat() follows the std::format syntax: "{}" takes the next argument,
+ * "{N}" argument N, "{{" and "}}" are literal braces, and ":spec" after the index selects the
+ * presentation, e.g. "{:.3f}". Each argument is written by LogFormatter<T>, with std::to_chars for
+ * numbers, straight into the destination string. Other modules specialise LogFormatter for their
+ * types; see quantity_format.h for the SI quantities.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_FORMAT_H
+#define INERTIAFX_CORE_TOOLS_LOG_FORMAT_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief Presentation options of one "{}" placeholder.
+         */
+        struct LogFormatSpec
+        {
+            int precision = -1; /**< Digits, as for printf; -1 for the shortest exact form. */
+            char type     = 0;  /**< 'f', 'e' or 'g' for numbers, 'x' for hex; 0 for default. */
+        };
+
+        /**
+         * @brief Parses the text after the ':' of a placeholder.
+         * @param spec The specification, e.g. ".3f"; characters it does not know are ignored.
+         * @return The presentation options.
+         */
+        constexpr LogFormatSpec parseLogFormatSpec(std::string_view spec)
+        {
+            LogFormatSpec result;
+            std::size_t position = 0;
+            if (position < spec.size() && spec[position] == '.')
+            {
+                result.precision = 0;
+                for (++position; position < spec.size() && spec[position] >= '0' &&
+                                 spec[position] <= '9' && result.precision < 1000;
+                     ++position)
+                {
+                    result.precision = result.precision * 10 + (spec[position] - '0');
+                }
+            }
+            if (position < spec.size())
+            {
+                const char type = spec[position];
+                if (type == 'f' || type == 'e' || type == 'g' || type == 'x')
+                {
+                    result.type = type;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Appends a floating point number with std::to_chars.
+         * @param out String the number is appended to.
+         * @param value The number.
+         * @param spec Precision and 'f', 'e' or 'g'; the default is the shortest exact form.
+         */
+        void appendLogFloat(std::string &out, double value, const LogFormatSpec &spec);
+
+        /**
+         * @brief Appends an integer with std::to_chars, in decimal or, for 'x', hexadecimal.
+         * @param out String the number is appended to.
+         * @param value The number.
+         * @param spec The presentation options.
+         */
+        template <typename I>
+        void appendLogInteger(std::string &out, I value, const LogFormatSpec &spec)
+        {
+            // Enough for any integer in base 10 or 16, sign included
+            const std::size_t offset = out.size();
+            out.resize(offset + std::numeric_limits<I>::digits10 + 2);
+            const std::to_chars_result result = std::to_chars(
+                out.data() + offset, out.data() + out.size(), value, spec.type == 'x' ? 16 : 10);
+            out.resize(static_cast<std::size_t>(result.ptr - out.data()));
+        }
+
+        /**
+         * @brief Writes one argument type; specialise it to log other types.
+         *
+         * A specialisation provides
+         * static void format(std::string &out, const T &value, const LogFormatSpec &spec)
+         * appending the value to out. The primary template handles integers, floating point
+         * numbers, enums, characters, strings and pointers. Enable allows partial
+         * specialisations for families of types with std::enable_if_t.
+         */
+        template <typename T, typename Enable = void> struct LogFormatter
+        {
+            static void format(std::string &out, const T &value, const LogFormatSpec &spec)
+            {
+                if constexpr (std::is_same_v<T, bool>)
+                {
+                    out += value ? "true" : "false";
+                }
+                else if constexpr (std::is_same_v<T, char>)
+                {
+                    out.push_back(value);
+                }
+                else if constexpr (std::is_enum_v<T>)
+                {
+                    appendLogInteger(out, static_cast<std::underlying_type_t<T>>(value), spec);
+                }
+                else if constexpr (std::is_integral_v<T>)
+                {
+                    appendLogInteger(out, value, spec);
+                }
+                else if constexpr (std::is_floating_point_v<T>)
+                {
+                    appendLogFloat(out, static_cast<double>(value), spec);
+                }
+                else if constexpr (std::is_same_v<T, const char *> || std::is_same_v<T, char *>)
+                {
+                    out += value != nullptr ? std::string_view(value) : "(null)";
+                }
+                else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+                {
+                    out += std::string_view(value);
+                }
+                else if constexpr (std::is_pointer_v<T>)
+                {
+                    out += "0x";
+                    appendLogInteger(out, reinterpret_cast<std::uintptr_t>(value),
+                                     LogFormatSpec{-1, 'x'});
+                }
+                else
+                {
+                    static_assert(sizeof(T) == 0, "No LogFormatter for this log argument type");
+                }
+            }
+        };
+
+        /**
+         * @brief A type-erased reference to one argument and its formatter.
+         */
+        struct LogFormatArg
+        {
+            const void *value; /**< The argument. */
+            void (*append)(std::string &out, const void *value,
+                           const LogFormatSpec &spec); /**< Its LogFormatter. */
+        };
+
+        /**
+         * @brief Wraps an argument for appendLogFormatArgs().
+         * @param value The argument; it must outlive the returned reference.
+         * @return The type-erased argument.
+         */
+        template <typename T> LogFormatArg makeLogFormatArg(const T &value)
+        {
+            return {&value, [](std::string &out, const void *erased, const LogFormatSpec &spec) {
+                        LogFormatter<T>::format(out, *static_cast<const T *>(erased), spec);
+                    }};
+        }
+
+        /**
+         * @brief Formats a "{}" format string with type-erased arguments.
+         * @param out String the formatted text is appended to.
+         * @param format The format string.
+         * @param args The arguments.
+         * @param count The number of arguments.
+         *
+         * Placeholders without an argument, and an unterminated '{', are copied through
+         * unchanged.
+         */
+        void appendLogFormatArgs(std::string &out, std::string_view format,
+                                 const LogFormatArg *args, std::size_t count);
+
+        /**
+         * @brief Formats a "{}" format string.
+         * @param out String the formatted text is appended to.
+         * @param format The format string.
+         * @param args The arguments, each with a LogFormatter.
+         */
+        template <typename... Args>
+        void appendLogFormat(std::string &out, std::string_view format, const Args &...args)
+        {
+            const LogFormatArg list[] = {makeLogFormatArg(args)..., LogFormatArg{}};
+            appendLogFormatArgs(out, format, list, sizeof...(Args));
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_FORMAT_H
@@ -0,0 +1,219 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_macros.h
+ * @brief Logging macros with compile-time level elimination.
+ *
+ * @details IFX_LOG_DEBUG(logger, format, ...) and its Info, Warning, Error and Critical
+ * siblings log through ILogger::logDeferred(). Below IFX_LOG_MIN_LEVEL a macro expands to
+ * nothing, so neither the call nor its arguments are compiled. Otherwise the arguments are only
+ * evaluated when ILogger::shouldLog() accepts the level, a relaxed atomic load. The logger may
+ * be a null pointer, and the format must be a string literal.
+ *
+ * IFX_LOG_MIN_LEVEL is set with the INERTIAFX_LOG_MIN_LEVEL CMake cache variable:
+ * 0 Debug, 1 Info, 2 Warning, 3 Error, 4 Critical, 5 off.
+ *
+ * IFX_LOG_FORMAT_DEBUG(logger, format, ...) and its siblings do the same through
+ * ILogger::logFormat(), with "{}" placeholders and any argument that has a LogFormatter, such as
+ * the SI quantities.
+ *
+ * IFX_LOG_DEBUG_RATE_LIMITED(logger, perSecond, format, ...), IFX_LOG_DEBUG_SAMPLED(logger,
+ * every, format, ...), IFX_LOG_DEBUG_ONCE(logger, format, ...) and their siblings for the other
+ * levels keep a static LogCallSite per statement, for per-entity diagnostics in hot loops, and are
+ * compiled out below IFX_LOG_MIN_LEVEL like the plain macros. Their suppressed message counts are
+ * logged periodically by the statement itself, and on demand by LogCallSite::reportAll().
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_MACROS_H
+#define INERTIAFX_CORE_TOOLS_LOG_MACROS_H
+
+#include "ilogger.h"
+
+#define IFX_LOG_LEVEL_DEBUG 0
+#define IFX_LOG_LEVEL_INFO 1
+#define IFX_LOG_LEVEL_WARNING 2
+#define IFX_LOG_LEVEL_ERROR 3
+#define IFX_LOG_LEVEL_CRITICAL 4
+#define IFX_LOG_LEVEL_OFF 5
+
+#ifndef IFX_LOG_MIN_LEVEL
+#define IFX_LOG_MIN_LEVEL IFX_LOG_LEVEL_DEBUG
+#endif
+
+#define IFX_LOG_DISCARD()                                                                          \
+    do                                                                                             \
+    {                                                                                              \
+    } while (0)
+
+#define IFX_LOG_AT(logger, level, ...)                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        ::InertiaFX::Core::Tools::ILogger *ifxLogger = (logger);                                   \
+        if (ifxLogger != nullptr && ifxLogger->shouldLog(level))                                   \
+        {                                                                                          \
+            ifxLogger->logDeferred(level, __VA_ARGS__);                                            \
+        }                                                                                          \
+    } while (0)
+
+#define IFX_LOG_FORMAT_AT(logger, level, ...)                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        ::InertiaFX::Core::Tools::ILogger *ifxLogger = (logger);                                   \
+        if (ifxLogger != nullptr && ifxLogger->shouldLog(level))                                   \
+        {                                                                                          \
+            ifxLogger->logFormat(level, __VA_ARGS__);                                              \
+        }                                                                                          \
+    } while (0)
+
+#define IFX_LOG_RATE_LIMITED_AT(logger, level, perSecond, ...)                                     \
+    do                                                                                             \
+    {                                                                                              \
+        ::InertiaFX::Core::Tools::ILogger *ifxLogger = (logger);                                   \
+        if (ifxLogger != nullptr && ifxLogger->shouldLog(level))                                   \
+        {                                                                                          \
+            static ::InertiaFX::Core::Tools::LogCallSite ifxSite(__FILE__, __LINE__);              \
+            ifxLogger->logRateLimited(ifxSite, (perSecond), level, __VA_ARGS__);                   \
+        }                                                                                          \
+    } while (0)
+
+#define IFX_LOG_SAMPLED_AT(logger, level, every, ...)                                              \
+    do                                                                                             \
+    {                                                                                              \
+        ::InertiaFX::Core::Tools::ILogger *ifxLogger = (logger);                                   \
+        if (ifxLogger != nullptr && ifxLogger->shouldLog(level))                                   \
+        {                                                                                          \
+            static ::InertiaFX::Core::Tools::LogCallSite ifxSite(__FILE__, __LINE__);              \
+            ifxLogger->logSampled(ifxSite, (every), level, __VA_ARGS__);                           \
+        }                                                                                          \
+    } while (0)
+
+#define IFX_LOG_ONCE_AT(logger, level, ...)                                                        \
+    do                                                                                             \
+    {                                                                                              \
+        ::InertiaFX::Core::Tools::ILogger *ifxLogger = (logger);                                   \
+        if (ifxLogger != nullptr && ifxLogger->shouldLog(level))                                   \
+        {                                                                                          \
+            static ::InertiaFX::Core::Tools::LogCallSite ifxSite(__FILE__, __LINE__);              \
+            ifxLogger->logOnce(ifxSite, level, __VA_ARGS__);                                       \
+        }                                                                                          \
+    } while (0)
+
+#if IFX_LOG_MIN_LEVEL <= IFX_LOG_LEVEL_DEBUG
+#define IFX_LOG_DEBUG(logger, ...)                                                                 \
+    IFX_LOG_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Debug, __VA_ARGS__)
+#define IFX_LOG_FORMAT_DEBUG(logger, ...)                                                          \
+    IFX_LOG_FORMAT_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Debug, __VA_ARGS__)
+#define IFX_LOG_DEBUG_RATE_LIMITED(logger, perSecond, ...)                                         \
+    IFX_LOG_RATE_LIMITED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Debug, perSecond,          \
+                            __VA_ARGS__)
+#define IFX_LOG_DEBUG_SAMPLED(logger, every, ...)                                                  \
+    IFX_LOG_SAMPLED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Debug, every, __VA_ARGS__)
+#define IFX_LOG_DEBUG_ONCE(logger, ...)                                                            \
+    IFX_LOG_ONCE_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Debug, __VA_ARGS__)
+#else
+#define IFX_LOG_DEBUG(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_FORMAT_DEBUG(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_DEBUG_RATE_LIMITED(logger, perSecond, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_DEBUG_SAMPLED(logger, every, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_DEBUG_ONCE(logger, ...) IFX_LOG_DISCARD()
+#endif
+
+#if IFX_LOG_MIN_LEVEL <= IFX_LOG_LEVEL_INFO
+#define IFX_LOG_INFO(logger, ...)                                                                  \
+    IFX_LOG_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Info, __VA_ARGS__)
+#define IFX_LOG_FORMAT_INFO(logger, ...)                                                           \
+    IFX_LOG_FORMAT_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Info, __VA_ARGS__)
+#define IFX_LOG_INFO_RATE_LIMITED(logger, perSecond, ...)                                          \
+    IFX_LOG_RATE_LIMITED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Info, perSecond,           \
+                            __VA_ARGS__)
+#define IFX_LOG_INFO_SAMPLED(logger, every, ...)                                                   \
+    IFX_LOG_SAMPLED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Info, every, __VA_ARGS__)
+#define IFX_LOG_INFO_ONCE(logger, ...)                                                             \
+    IFX_LOG_ONCE_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Info, __VA_ARGS__)
+#else
+#define IFX_LOG_INFO(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_FORMAT_INFO(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_INFO_RATE_LIMITED(logger, perSecond, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_INFO_SAMPLED(logger, every, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_INFO_ONCE(logger, ...) IFX_LOG_DISCARD()
+#endif
+
+#if IFX_LOG_MIN_LEVEL <= IFX_LOG_LEVEL_WARNING
+#define IFX_LOG_WARNING(logger, ...)                                                               \
+    IFX_LOG_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Warning, __VA_ARGS__)
+#define IFX_LOG_FORMAT_WARNING(logger, ...)                                                        \
+    IFX_LOG_FORMAT_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Warning, __VA_ARGS__)
+#define IFX_LOG_WARNING_RATE_LIMITED(logger, perSecond, ...)                                       \
+    IFX_LOG_RATE_LIMITED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Warning, perSecond,        \
+                            __VA_ARGS__)
+#define IFX_LOG_WARNING_SAMPLED(logger, every, ...)                                                \
+    IFX_LOG_SAMPLED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Warning, every, __VA_ARGS__)
+#define IFX_LOG_WARNING_ONCE(logger, ...)                                                          \
+    IFX_LOG_ONCE_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Warning, __VA_ARGS__)
+#else
+#define IFX_LOG_WARNING(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_FORMAT_WARNING(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_WARNING_RATE_LIMITED(logger, perSecond, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_WARNING_SAMPLED(logger, every, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_WARNING_ONCE(logger, ...) IFX_LOG_DISCARD()
+#endif
+
+#if IFX_LOG_MIN_LEVEL <= IFX_LOG_LEVEL_ERROR
+#define IFX_LOG_ERROR(logger, ...)                                                                 \
+    IFX_LOG_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Error, __VA_ARGS__)
+#define IFX_LOG_FORMAT_ERROR(logger, ...)                                                          \
+    IFX_LOG_FORMAT_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Error, __VA_ARGS__)
+#define IFX_LOG_ERROR_RATE_LIMITED(logger, perSecond, ...)                                         \
+    IFX_LOG_RATE_LIMITED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Error, perSecond,          \
+                            __VA_ARGS__)
+#define IFX_LOG_ERROR_SAMPLED(logger, every, ...)                                                  \
+    IFX_LOG_SAMPLED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Error, every, __VA_ARGS__)
+#define IFX_LOG_ERROR_ONCE(logger, ...)                                                            \
+    IFX_LOG_ONCE_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Error, __VA_ARGS__)
+#else
+#define IFX_LOG_ERROR(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_FORMAT_ERROR(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_ERROR_RATE_LIMITED(logger, perSecond, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_ERROR_SAMPLED(logger, every, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_ERROR_ONCE(logger, ...) IFX_LOG_DISCARD()
+#endif
+
+#if IFX_LOG_MIN_LEVEL <= IFX_LOG_LEVEL_CRITICAL
+#define IFX_LOG_CRITICAL(logger, ...)                                                              \
+    IFX_LOG_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Critical, __VA_ARGS__)
+#define IFX_LOG_FORMAT_CRITICAL(logger, ...)                                                       \
+    IFX_LOG_FORMAT_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Critical, __VA_ARGS__)
+#define IFX_LOG_CRITICAL_RATE_LIMITED(logger, perSecond, ...)                                      \
+    IFX_LOG_RATE_LIMITED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Critical, perSecond,       \
+                            __VA_ARGS__)
+#define IFX_LOG_CRITICAL_SAMPLED(logger, every, ...)                                               \
+    IFX_LOG_SAMPLED_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Critical, every, __VA_ARGS__)
+#define IFX_LOG_CRITICAL_ONCE(logger, ...)                                                         \
+    IFX_LOG_ONCE_AT(logger, ::InertiaFX::Core::Tools::LogLevel::Critical, __VA_ARGS__)
+#else
+#define IFX_LOG_CRITICAL(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_FORMAT_CRITICAL(logger, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_CRITICAL_RATE_LIMITED(logger, perSecond, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_CRITICAL_SAMPLED(logger, every, ...) IFX_LOG_DISCARD()
+#define IFX_LOG_CRITICAL_ONCE(logger, ...) IFX_LOG_DISCARD()
+#endif
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_MACROS_H
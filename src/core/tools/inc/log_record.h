@@ -0,0 +1,116 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_record.h
+ * @brief Declaration of the LogRecord structure.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_LOG_RECORD_H
+#define INERTIAFX_CORE_TOOLS_LOG_RECORD_H
+
+#include "ilogger.h"
+#include "log_arguments.h"
+#include "log_clock.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @struct LogRecord
+         * @brief Fixed-size log message, captured by the producer and written out later.
+         *
+         * With a null format, message holds the formatted text. Otherwise the record is
+         * deferred: format points to a format string with static storage and message holds the
+         * arguments encoded by encodeLogArguments().
+         */
+        struct LogRecord
+        {
+            static constexpr std::size_t MAX_MESSAGE_LENGTH = MAX_LOG_PAYLOAD; /**< Payload size. */
+
+            LogLevel level;                             /**< Severity level. */
+            std::chrono::system_clock::time_point time; /**< Wall-clock time of the call. */
+            std::int64_t monotonic;                     /**< getLogMonotonicTime(), or 0. */
+            double simulationTime;                      /**< Simulation time, or NaN. */
+            std::uint64_t step;                         /**< Simulation step. */
+            const char *format;                         /**< Deferred format, or nullptr. */
+            std::uint32_t length;                       /**< Bytes used in message. */
+            char message[MAX_MESSAGE_LENGTH];           /**< Text, or encoded arguments. */
+        };
+
+        /**
+         * @brief Converts a LogLevel enum into a string for display.
+         * @param level The log level to convert.
+         * @return The string representation of the log level.
+         */
+        const char *logLevelName(LogLevel level);
+
+        /**
+         * @brief Fills the header of a record: level, clocks and simulation stamp.
+         * @param record The record; its format, length and message are left untouched.
+         * @param level The severity level.
+         * @param logger The logger, providing its stamps and simulation time and step.
+         *
+         * The steady clock is only read when the logger writes monotonic stamps.
+         */
+        void stampLogRecord(LogRecord &record, LogLevel level, const ILogger &logger);
+
+        /**
+         * @brief Appends the stamps and level prefix of a log line, e.g.
+         * "[YYYY-MM-DD HH:MM:SS] [LEVEL] ".
+         * @param record The record; only its header is used.
+         * @param stamps A combination of LogStamp flags. Simulation stamps are skipped for
+         * records without a simulation time.
+         * @param line Output line to append to.
+         *
+         * The date text comes from the calling thread's TimestampCache.
+         */
+        void appendLogPrefix(const LogRecord &record, std::uint32_t stamps, std::string &line);
+
+        /**
+         * @brief Appends a printf-style formatted message, growing line as needed.
+         * @param line Output line to append to.
+         * @param format A printf-style format string.
+         * @param args Variadic argument list; it is left unspecified afterwards, as with
+         * vsnprintf.
+         */
+        void appendLogMessage(std::string &line, const char *format, va_list args);
+
+        /**
+         * @brief Formats a record as "[YYYY-MM-DD HH:MM:SS] [LEVEL] message\n".
+         * @param record The record.
+         * @param line Output line; its previous content is replaced.
+         * @param stamps A combination of LogStamp flags, see appendLogPrefix().
+         */
+        void formatLogLine(const LogRecord &record, std::string &line,
+                           std::uint32_t stamps = LogStamp::Default);
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_LOG_RECORD_H
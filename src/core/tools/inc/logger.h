@@ -27,8 +27,17 @@
 #define INERTIAFX_CORE_TOOLS_LOGGER_H
 
 #include "ILogger.h"
+#include "ilog_sink.h"
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
-#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace InertiaFX
 {
@@ -38,13 +47,23 @@ namespace Core
     {
         /**
          * @class Logger
-         * @brief Concrete implementation of ILogger for logging to stdout/stderr.
+         * @brief Concrete implementation of ILogger writing each message to a set of sinks.
+         *
+         * Each message is timestamped and formatted once, then the same line is written to every
+         * enabled sink: console, file, memory ring or any custom ILogSink. A default-constructed
+         * Logger writes to a ConsoleSink, i.e. stdout, or stderr for Error and Critical.
+         *
+         * log() may be called from any number of threads. Each thread formats into its own
+         * staging buffer; whichever thread holds the sinks then merges the staged lines of every
+         * thread, in timestamp order, and writes them whole, so lines never interleave. A
+         * message may thus be written by another thread shortly after log() returns; flush()
+         * waits for it. The enable flag and threshold are read without locking.
          */
         class Logger : public ILogger
         {
           public:
             /**
-             * @brief Constructor initializes the logger with default settings.
+             * @brief Constructor initializes the logger with default settings and a console sink.
              */
             Logger();
 
@@ -62,6 +81,14 @@ namespace Core
              */
             void log(LogLevel level, const char *format, ...) override;
 
+            /**
+             * @copydoc ILogger::logFormatArgs()
+             *
+             * The message is formatted straight into the calling thread's staging buffer.
+             */
+            void logFormatArgs(LogLevel level, std::string_view format, const LogFormatArg *args,
+                               std::size_t count) override;
+
             /**
              * @brief Enables the logger, allowing log output.
              */
@@ -79,9 +106,52 @@ namespace Core
              */
             void setThreshold(LogLevel level) override;
 
+            /**
+             * @brief Adds a destination for the messages.
+             * @param sink A unique pointer to the sink. It is owned by the logger.
+             * @return A reference to the sink, e.g. for setSinkEnabled().
+             */
+            ILogSink &addSink(std::unique_ptr<ILogSink> sink);
+
+            /**
+             * @brief Removes every sink, including the default console sink.
+             */
+            void clearSinks();
+
+            /**
+             * @brief Retrieves the number of sinks.
+             * @return The sink count, enabled or not.
+             */
+            std::size_t getSinkCount() const;
+
+            /**
+             * @brief Retrieves the number of staging buffers.
+             * @return One per thread that logged through this logger and is still running, plus
+             * the free buffers left by threads that have exited.
+             */
+            std::size_t getThreadBufferCount() const;
+
+            /**
+             * @brief Enables or disables one sink without removing it.
+             * @param sink A sink returned by addSink().
+             * @param enabled If false, the sink receives no messages.
+             */
+            void setSinkEnabled(const ILogSink &sink, bool enabled);
+
+            /**
+             * @brief Sets whether every sink is flushed after each message.
+             * @param autoFlush If true, each message reaches its destination before log() returns.
+             */
+            void setAutoFlush(bool autoFlush);
+
+            /**
+             * @brief Writes every staged message and flushes every sink.
+             */
+            void flush();
+
           protected:
-            bool _enabled;       /**< Indicates whether logging is enabled. */
-            LogLevel _threshold; /**< Minimum severity level for messages to be logged. */
+            std::atomic<bool> _enabled;       /**< Indicates whether logging is enabled. */
+            std::atomic<LogLevel> _threshold; /**< Minimum severity level to be logged. */
 
             /**
              * @brief Converts a LogLevel enum into a string for display.
@@ -91,16 +161,124 @@ namespace Core
              */
             const char *logLevelToString(LogLevel level) const;
 
-          private:
             /**
-             * @brief Internal helper to perform the formatted output.
+             * @brief Formats a message once and writes it to every enabled sink.
              *
              * @param level The severity level of the log message.
-             * @param outputFile File handle to write into (stdout or stderr).
              * @param format A printf-style format string.
              * @param args Variadic argument list.
              */
-            void vLog(LogLevel level, FILE *outputFile, const char *format, va_list args);
+            void vLog(LogLevel level, const char *format, va_list args);
+
+          private:
+            /**
+             * @brief A sink and whether it receives messages.
+             */
+            struct SinkEntry
+            {
+                std::unique_ptr<ILogSink> sink; /**< The sink. */
+                bool enabled;                   /**< False to skip the sink. */
+            };
+
+            /**
+             * @brief A formatted line waiting in a staging buffer.
+             */
+            struct StagedLine
+            {
+                std::int64_t order;                         /**< Steady clock, for merging. */
+                LogLevel level;                             /**< Severity level. */
+                std::chrono::system_clock::time_point time; /**< Wall-clock time. */
+                std::int64_t monotonic;                     /**< Monotonic stamp. */
+                double simulationTime;                      /**< Simulation time, or NaN. */
+                std::uint64_t step;                         /**< Simulation step. */
+                std::size_t offset;                         /**< Start of the line in text. */
+                std::size_t prefixLength;                   /**< Length of the stamps. */
+                std::size_t length;                         /**< Line length, with newline. */
+            };
+
+            /**
+             * @brief Lines staged together.
+             */
+            struct StagedBatch
+            {
+                std::string text;              /**< Concatenated lines. */
+                std::vector<StagedLine> lines; /**< Lines, in the order they were logged. */
+            };
+
+            /**
+             * @brief Lines staged by one thread.
+             */
+            struct ThreadBuffer
+            {
+                std::atomic<std::thread::id> owner; /**< Thread writing to it; none if free. */
+                std::mutex mutex;                   /**< Guards batch. */
+                StagedBatch batch;                  /**< Lines waiting to be merged. */
+            };
+
+            /**
+             * @brief A staged line being merged.
+             */
+            struct MergedLine
+            {
+                const StagedLine *line;  /**< The line. */
+                const std::string *text; /**< Text of its batch. */
+            };
+
+            /**
+             * @brief Stamps a line and appends it to the calling thread's staging buffer, then
+             * writes the staged lines.
+             * @param level The severity level of the message.
+             * @param appendMessage Callable appending the message text to a std::string.
+             */
+            template <typename AppendMessage>
+            void stageLine(LogLevel level, const AppendMessage &appendMessage);
+
+            /**
+             * @brief Retrieves the calling thread's staging buffer, taking a free one or creating
+             * it on first use.
+             *
+             * The buffer is released when the thread exits, for a later thread to reuse.
+             */
+            ThreadBuffer &getThreadBuffer();
+
+            /**
+             * @brief Writes the staged lines unless another thread is already doing so.
+             *
+             * Whoever holds the sinks checks for staged lines again after releasing them, so no
+             * line is left behind.
+             */
+            void writeStaged();
+
+            /**
+             * @brief Moves out the staged lines of every thread and writes them in timestamp
+             * order; the caller holds the sinks.
+             */
+            void mergeStaged();
+
+            /**
+             * @brief Waits until no other thread writes to the sinks.
+             */
+            void lockSinks();
+
+            /**
+             * @brief Releases the sinks, then writes lines staged in the meantime.
+             */
+            void unlockSinks();
+
+            const std::uint64_t _id; /**< Identifies the logger in the thread buffer cache. */
+
+            std::vector<SinkEntry> _sinks; /**< Destinations of the messages. */
+            bool _autoFlush;               /**< Flush the sinks after each message. */
+            bool _recordSinks;             /**< Some enabled sink consumes records. */
+
+            std::atomic<bool> _writing;          /**< Held by the thread writing to the sinks. */
+            std::atomic<std::int64_t> _staged;   /**< Lines not yet merged; may dip below 0. */
+            std::atomic<std::size_t> _sinkCount; /**< Size of _sinks, for lock-free reads. */
+
+            mutable std::mutex _buffersMutex;                    /**< Guards _buffers. */
+            std::vector<std::shared_ptr<ThreadBuffer>> _buffers; /**< One per logging thread. */
+            std::vector<StagedBatch> _merging;                   /**< Batches being written. */
+            std::vector<MergedLine> _order;                      /**< Their lines, in order. */
         };
 
     }  // namespace Tools
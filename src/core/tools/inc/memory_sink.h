@@ -0,0 +1,94 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file memory_sink.h
+ * @brief Declaration of the MemorySink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_MEMORY_SINK_H
+#define INERTIAFX_CORE_TOOLS_MEMORY_SINK_H
+
+#include "ilog_sink.h"
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @class MemorySink
+         * @brief Keeps the most recent lines in a fixed-size in-memory ring.
+         *
+         * Useful to inspect recent output from tests or tools, or to dump it after a failure.
+         * The line strings are reused once the ring has wrapped, so a steady stream of lines
+         * stops allocating. getLines() may be called from any thread.
+         */
+        class MemorySink : public ILogSink
+        {
+          public:
+            /**
+             * @brief Constructs a MemorySink.
+             * @param capacity Number of lines kept; at least one.
+             */
+            explicit MemorySink(std::size_t capacity = 1024);
+
+            /**
+             * @copydoc ILogSink::write(LogLevel, std::string_view)
+             */
+            void write(LogLevel level, std::string_view line) override;
+
+            /**
+             * @copydoc ILogSink::flush()
+             */
+            void flush() override;
+
+            /**
+             * @brief Retrieves a copy of the kept lines, oldest first.
+             * @return The lines, each terminated by a newline.
+             */
+            std::vector<std::string> getLines() const;
+
+            /**
+             * @brief Retrieves the number of lines written since construction or clear().
+             * @return The line count, including lines no longer kept.
+             */
+            std::size_t getWrittenCount() const;
+
+            /**
+             * @brief Discards every kept line.
+             */
+            void clear();
+
+          private:
+            mutable std::mutex _mutex;       /**< Guards the ring. */
+            std::vector<std::string> _lines; /**< Ring of lines. */
+            std::size_t _written;            /**< Lines written; the next slot is _written % size. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_MEMORY_SINK_H
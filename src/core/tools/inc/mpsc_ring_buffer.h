@@ -0,0 +1,175 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file mpsc_ring_buffer.h
+ * @brief Declaration of the MpscRingBuffer class template.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_MPSC_RING_BUFFER_H
+#define INERTIAFX_CORE_TOOLS_MPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @class MpscRingBuffer
+         * @brief Bounded lock-free ring buffer for many producers and one consumer.
+         *
+         * Each slot carries a sequence number telling whether it is free for the producer of a
+         * given lap or ready for the consumer, so no lock is ever taken. Popping is safe from
+         * several threads as well, which lets producers evict the oldest element when full.
+         *
+         * @tparam T Element type. It must be default constructible.
+         */
+        template <typename T> class MpscRingBuffer
+        {
+          public:
+            /**
+             * @brief Constructs a new MpscRingBuffer object.
+             * @param capacity Minimum number of elements; rounded up to a power of two >= 2.
+             */
+            explicit MpscRingBuffer(std::size_t capacity) :
+                _capacity(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+                _mask(_capacity - 1), _slots(std::make_unique<Slot[]>(_capacity)), _head(0),
+                _tail(0)
+            {
+                for (std::size_t i = 0; i < _capacity; ++i)
+                {
+                    _slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            MpscRingBuffer(const MpscRingBuffer &)            = delete;
+            MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+            /**
+             * @brief Retrieves the number of slots.
+             * @return The capacity.
+             */
+            std::size_t capacity() const
+            {
+                return _capacity;
+            }
+
+            /**
+             * @brief Claims a slot and fills it in place.
+             * @param write Callable invoked as write(T &) on the claimed slot, only on success.
+             * @return True if a slot was claimed, false if the buffer is full.
+             */
+            template <typename Writer> bool tryPush(Writer &&write)
+            {
+                std::size_t position = _head.load(std::memory_order_relaxed);
+                Slot *slot           = nullptr;
+                while (true)
+                {
+                    slot                    = &_slots[position & _mask];
+                    const std::size_t seq   = slot->sequence.load(std::memory_order_acquire);
+                    const std::intptr_t lap = static_cast<std::intptr_t>(seq - position);
+                    if (lap == 0)
+                    {
+                        if (_head.compare_exchange_weak(position, position + 1,
+                                                        std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (lap < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = _head.load(std::memory_order_relaxed);
+                    }
+                }
+
+                write(slot->value);
+                slot->sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * @brief Takes the oldest element.
+             * @param read Callable invoked as read(T &) on the element, only on success.
+             * @return True if an element was taken, false if the buffer is empty.
+             */
+            template <typename Reader> bool tryPop(Reader &&read)
+            {
+                std::size_t position = _tail.load(std::memory_order_relaxed);
+                Slot *slot           = nullptr;
+                while (true)
+                {
+                    slot                    = &_slots[position & _mask];
+                    const std::size_t seq   = slot->sequence.load(std::memory_order_acquire);
+                    const std::intptr_t lap = static_cast<std::intptr_t>(seq - (position + 1));
+                    if (lap == 0)
+                    {
+                        if (_tail.compare_exchange_weak(position, position + 1,
+                                                        std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (lap < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = _tail.load(std::memory_order_relaxed);
+                    }
+                }
+
+                read(slot->value);
+                slot->sequence.store(position + _capacity, std::memory_order_release);
+                return true;
+            }
+
+          private:
+            /**
+             * @brief One element and its lap marker, on its own cache line.
+             */
+            struct alignas(64) Slot
+            {
+                std::atomic<std::size_t> sequence; /**< Lap marker of the slot. */
+                T value;                           /**< Stored element. */
+            };
+
+            const std::size_t _capacity;                /**< Number of slots, a power of two. */
+            const std::size_t _mask;                    /**< _capacity - 1, maps positions. */
+            std::unique_ptr<Slot[]> _slots;             /**< Slot storage. */
+            alignas(64) std::atomic<std::size_t> _head; /**< Next position to push. */
+            alignas(64) std::atomic<std::size_t> _tail; /**< Next position to pop. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_MPSC_RING_BUFFER_H
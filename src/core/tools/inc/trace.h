@@ -0,0 +1,233 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file trace.h
+ * @brief Declaration of the Tracer and TraceZone classes.
+ *
+ * @details A TraceZone measures the scope it lives in and, on exit, records one event with its
+ * begin and end time in the calling thread's ring buffer. The Tracer owns the buffers and
+ * exports them as Chrome Trace Event JSON, loadable in chrome://tracing or ui.perfetto.dev.
+ * Zones are normally placed with the IFX_TRACE_* macros of trace_macros.h, which compile to
+ * nothing unless tracing is enabled in the build.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_TRACE_H
+#define INERTIAFX_CORE_TOOLS_TRACE_H
+
+#include "log_clock.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        /**
+         * @brief A traced zone: where and when it ran.
+         */
+        struct TraceEvent
+        {
+            const char *category; /**< Group of the zone, e.g. "engine"; static storage. */
+            const char *name;     /**< Name of the zone; static storage. */
+            std::int64_t begin;   /**< Monotonic time the zone was entered, in ns. */
+            std::int64_t end;     /**< Monotonic time the zone was left, in ns. */
+        };
+
+        /**
+         * @class Tracer
+         * @brief Process-wide collector of trace events.
+         *
+         * Each thread records into its own ring buffer, created on its first event and kept
+         * after the thread exits, so the whole run can be exported at the end. Once a buffer
+         * holds its capacity, new events overwrite the oldest. Recording is off until enable()
+         * is called.
+         */
+        class Tracer
+        {
+          public:
+            /**
+             * @brief Default number of events kept per thread.
+             */
+            static constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 1 << 16;
+
+            /**
+             * @brief Retrieves the process-wide tracer.
+             * @return The tracer.
+             */
+            static Tracer &instance();
+
+            /**
+             * @brief Starts recording zones.
+             */
+            void enable();
+
+            /**
+             * @brief Stops recording zones; recorded events are kept.
+             */
+            void disable();
+
+            /**
+             * @brief Cheap check of whether zones are recorded.
+             * @return True if enabled.
+             */
+            bool isEnabled() const
+            {
+                return _enabled.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Sets the number of events each thread keeps.
+             * @param capacity Events per thread, at least 1. Applies to buffers after clear().
+             */
+            void setBufferCapacity(std::size_t capacity);
+
+            /**
+             * @brief Names the calling thread in the exported timeline.
+             * @param name The thread name, e.g. "Worker 2".
+             */
+            void setThreadName(const std::string &name);
+
+            /**
+             * @brief Records a zone of the calling thread.
+             * @param category Group of the zone; a string with static storage duration.
+             * @param name Name of the zone; a string with static storage duration.
+             * @param begin Monotonic time the zone was entered, in ns.
+             * @param end Monotonic time the zone was left, in ns.
+             */
+            void record(const char *category, const char *name, std::int64_t begin,
+                        std::int64_t end);
+
+            /**
+             * @brief Discards every recorded event; thread names are kept.
+             */
+            void clear();
+
+            /**
+             * @brief Retrieves the number of events held, over every thread.
+             * @return The event count.
+             */
+            std::size_t getEventCount() const;
+
+            /**
+             * @brief Retrieves the number of events overwritten by newer ones since clear().
+             * @return The overwritten event count.
+             */
+            std::uint64_t getOverwrittenCount() const;
+
+            /**
+             * @brief Writes the events as Chrome Trace Event JSON.
+             * @param out The destination stream.
+             *
+             * Each zone is a complete ("X") event with microsecond timestamps; threads are
+             * named with "thread_name" metadata events.
+             */
+            void writeChromeTrace(std::ostream &out) const;
+
+            /**
+             * @brief Writes the events as Chrome Trace Event JSON to a file.
+             * @param filepath Path of the file, replaced if it exists.
+             * @throws std::runtime_error If the file cannot be written.
+             */
+            void writeChromeTrace(const std::string &filepath) const;
+
+          private:
+            /**
+             * @brief Events recorded by one thread.
+             */
+            struct ThreadBuffer
+            {
+                std::uint32_t id;               /**< Thread id in the exported trace. */
+                std::string name;               /**< Thread name in the exported trace. */
+                std::mutex mutex;               /**< Guards the members below. */
+                std::vector<TraceEvent> events; /**< Ring of events; grows up to capacity. */
+                std::size_t capacity;           /**< Events kept. */
+                std::size_t next;               /**< Slot overwritten next once full. */
+                std::uint64_t overwritten;      /**< Events lost to newer ones. */
+            };
+
+            Tracer();
+
+            /**
+             * @brief Retrieves the calling thread's buffer, creating it on first use.
+             */
+            ThreadBuffer &getThreadBuffer();
+
+            std::atomic<bool> _enabled;         /**< Zones are recorded. */
+            std::atomic<std::size_t> _capacity; /**< Events kept per thread. */
+
+            mutable std::mutex _buffersMutex;                    /**< Guards _buffers. */
+            std::vector<std::unique_ptr<ThreadBuffer>> _buffers; /**< One per traced thread. */
+        };
+
+        /**
+         * @class TraceZone
+         * @brief Records the scope it lives in as one trace event.
+         *
+         * When tracing is disabled at construction, the zone costs one relaxed atomic load.
+         */
+        class TraceZone
+        {
+          public:
+            /**
+             * @brief Enters the zone.
+             * @param category Group of the zone; a string with static storage duration.
+             * @param name Name of the zone; a string with static storage duration.
+             */
+            TraceZone(const char *category, const char *name) :
+                _category(category), _name(name),
+                _begin(Tracer::instance().isEnabled() ? getLogMonotonicTime() : NOT_RECORDED)
+            {
+            }
+
+            /**
+             * @brief Leaves the zone and records it.
+             */
+            ~TraceZone()
+            {
+                if (_begin != NOT_RECORDED)
+                {
+                    Tracer::instance().record(_category, _name, _begin, getLogMonotonicTime());
+                }
+            }
+
+            TraceZone(const TraceZone &)            = delete;
+            TraceZone &operator=(const TraceZone &) = delete;
+
+          private:
+            static constexpr std::int64_t NOT_RECORDED = -1; /**< Begin of a skipped zone. */
+
+            const char *_category; /**< Group of the zone. */
+            const char *_name;     /**< Name of the zone. */
+            std::int64_t _begin;   /**< Monotonic time the zone was entered, or NOT_RECORDED. */
+        };
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
+
+#endif  // INERTIAFX_CORE_TOOLS_TRACE_H
@@ -0,0 +1,55 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file trace_macros.h
+ * @brief Tracing macros that compile to nothing unless tracing is enabled in the build.
+ *
+ * @details IFX_TRACE_ZONE(category, name) records the enclosing scope as a TraceZone, and
+ * IFX_TRACE_THREAD_NAME(name) names the calling thread in the exported timeline. Both expand to
+ * nothing, arguments included, unless IFX_TRACING_ENABLED is 1. It is set with the
+ * INERTIAFX_ENABLE_TRACING CMake option; zones compiled in still record only once
+ * Tracer::instance().enable() is called. The category and name must be string literals.
+ *
+ * @date 17, Oct 2026
+ */
+
+#ifndef INERTIAFX_CORE_TOOLS_TRACE_MACROS_H
+#define INERTIAFX_CORE_TOOLS_TRACE_MACROS_H
+
+#ifndef IFX_TRACING_ENABLED
+#define IFX_TRACING_ENABLED 0
+#endif
+
+#if IFX_TRACING_ENABLED
+#include "trace.h"
+
+#define IFX_TRACE_CONCAT_IMPL(a, b) a##b
+#define IFX_TRACE_CONCAT(a, b) IFX_TRACE_CONCAT_IMPL(a, b)
+
+#define IFX_TRACE_ZONE(category, name)                                                             \
+    const ::InertiaFX::Core::Tools::TraceZone IFX_TRACE_CONCAT(ifxTraceZone, __LINE__)(            \
+        category, name)
+
+#define IFX_TRACE_THREAD_NAME(name) ::InertiaFX::Core::Tools::Tracer::instance().setThreadName(name)
+#else
+#define IFX_TRACE_ZONE(category, name) static_cast<void>(0)
+#define IFX_TRACE_THREAD_NAME(name) static_cast<void>(0)
+#endif
+
+#endif  // INERTIAFX_CORE_TOOLS_TRACE_MACROS_H
@@ -0,0 +1,252 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file async_logger.cpp
+ * @brief Definition of the AsyncLogger class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "async_logger.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        AsyncLogger::AsyncLogger(std::size_t capacity, OverflowPolicy policy) :
+            _queue(capacity), _policy(policy), _enabled(true), _threshold(LogLevel::Debug),
+            _dropped(0), _signal(0), _flushRequests(0), _flushesDone(0), _stopping(false),
+            _current{}
+        {
+            setActiveLevel(true, LogLevel::Debug);
+            _writer = std::thread(&AsyncLogger::writerLoop, this);
+        }
+
+        AsyncLogger::~AsyncLogger()
+        {
+            _stopping.store(true, std::memory_order_release);
+            signalWriter();
+            _writer.join();
+        }
+
+        void AsyncLogger::addSink(std::unique_ptr<ILogSink> sink)
+        {
+            std::lock_guard<std::mutex> lock(_sinkMutex);
+            _sinks.push_back(std::move(sink));
+        }
+
+        template <typename Fill> void AsyncLogger::enqueue(Fill &&fill)
+        {
+            // The slot is only filled once claimed, so retries never format twice
+            while (!_queue.tryPush(fill))
+            {
+                if (_policy == OverflowPolicy::DropNewest)
+                {
+                    _dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                if (_policy == OverflowPolicy::DropOldest)
+                {
+                    if (_queue.tryPop([](LogRecord &) {}))
+                    {
+                        _dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    continue;
+                }
+
+                // Block: make sure the writer is draining, then let it run
+                signalWriter();
+                std::this_thread::yield();
+            }
+            signalWriter();
+        }
+
+        void AsyncLogger::log(LogLevel level, const char *format, ...)
+        {
+            // If logging is disabled or level is below threshold, skip.
+            if (!_enabled.load(std::memory_order_relaxed) ||
+                level < _threshold.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            va_list args;
+            va_start(args, format);
+            enqueue([&](LogRecord &record) {
+                stampLogRecord(record, level, *this);
+                record.format    = nullptr;
+                const int length = vsnprintf(record.message, sizeof(record.message), format, args);
+                record.length    = static_cast<std::uint32_t>(
+                    std::clamp(length, 0, static_cast<int>(LogRecord::MAX_MESSAGE_LENGTH) - 1));
+            });
+            va_end(args);
+        }
+
+        void AsyncLogger::logEncoded(LogLevel level, const char *format, const char *payload,
+                                     std::uint32_t length)
+        {
+            if (!_enabled.load(std::memory_order_relaxed) ||
+                level < _threshold.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            enqueue([&](LogRecord &record) {
+                stampLogRecord(record, level, *this);
+                record.format = format;
+                record.length = std::min<std::uint32_t>(length, LogRecord::MAX_MESSAGE_LENGTH);
+                std::memcpy(record.message, payload, record.length);
+            });
+        }
+
+        void AsyncLogger::enable()
+        {
+            _enabled.store(true, std::memory_order_relaxed);
+            setActiveLevel(_enabled.load(std::memory_order_relaxed),
+                           _threshold.load(std::memory_order_relaxed));
+        }
+
+        void AsyncLogger::disable()
+        {
+            _enabled.store(false, std::memory_order_relaxed);
+            setActiveLevel(_enabled.load(std::memory_order_relaxed),
+                           _threshold.load(std::memory_order_relaxed));
+        }
+
+        void AsyncLogger::setThreshold(LogLevel level)
+        {
+            _threshold.store(level, std::memory_order_relaxed);
+            setActiveLevel(_enabled.load(std::memory_order_relaxed),
+                           _threshold.load(std::memory_order_relaxed));
+        }
+
+        void AsyncLogger::flush()
+        {
+            const std::uint64_t request =
+                _flushRequests.fetch_add(1, std::memory_order_acq_rel) + 1;
+            signalWriter();
+
+            std::uint64_t done = _flushesDone.load(std::memory_order_acquire);
+            while (done < request)
+            {
+                _flushesDone.wait(done, std::memory_order_acquire);
+                done = _flushesDone.load(std::memory_order_acquire);
+            }
+        }
+
+        std::uint64_t AsyncLogger::getDroppedCount() const
+        {
+            return _dropped.load(std::memory_order_relaxed);
+        }
+
+        void AsyncLogger::signalWriter()
+        {
+            _signal.fetch_add(1, std::memory_order_release);
+            _signal.notify_one();
+        }
+
+        void AsyncLogger::writerLoop()
+        {
+            bool unflushed = false;
+            while (true)
+            {
+                // Read the requests before draining: everything queued before them gets written
+                const std::uint32_t signal  = _signal.load(std::memory_order_acquire);
+                const std::uint64_t request = _flushRequests.load(std::memory_order_acquire);
+                const bool stopping         = _stopping.load(std::memory_order_acquire);
+
+                const std::size_t written = drain();
+                unflushed                 = unflushed || written > 0;
+
+                // Flush once the queue runs dry rather than after every record
+                const bool flushRequested = request != _flushesDone.load(std::memory_order_relaxed);
+                if ((written == 0 && unflushed) || flushRequested || stopping)
+                {
+                    std::lock_guard<std::mutex> lock(_sinkMutex);
+                    for (const std::unique_ptr<ILogSink> &sink : _sinks)
+                    {
+                        sink->flush();
+                    }
+                    unflushed = false;
+                }
+                if (flushRequested)
+                {
+                    _flushesDone.store(request, std::memory_order_release);
+                    _flushesDone.notify_all();
+                }
+
+                if (stopping)
+                {
+                    return;
+                }
+                if (written == 0)
+                {
+                    _signal.wait(signal, std::memory_order_acquire);
+                }
+            }
+        }
+
+        std::size_t AsyncLogger::drain()
+        {
+            std::lock_guard<std::mutex> lock(_sinkMutex);
+            const std::uint32_t stamps = getStamps();
+            std::size_t written        = 0;
+
+            // Copy the record out so its slot is free again while the sinks run
+            auto take = [this](LogRecord &record) {
+                _current.level          = record.level;
+                _current.time           = record.time;
+                _current.monotonic      = record.monotonic;
+                _current.simulationTime = record.simulationTime;
+                _current.step           = record.step;
+                _current.format         = record.format;
+                _current.length         = record.length;
+                std::memcpy(_current.message, record.message, record.length);
+            };
+            while (_queue.tryPop(take))
+            {
+                // Format the line once, and only if a text sink needs it
+                bool formatted = false;
+                for (const std::unique_ptr<ILogSink> &sink : _sinks)
+                {
+                    if (sink->consumesRecords())
+                    {
+                        sink->writeRecord(_current);
+                        continue;
+                    }
+                    if (!formatted)
+                    {
+                        formatLogLine(_current, _line, stamps);
+                        formatted = true;
+                    }
+                    sink->write(_current.level, _line);
+                }
+                ++written;
+            }
+            return written;
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
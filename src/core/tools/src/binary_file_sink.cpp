@@ -0,0 +1,96 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file binary_file_sink.cpp
+ * @brief Definition of the BinaryFileSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "binary_file_sink.h"
+#include "binary_log_format.h"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        BinaryFileSink::BinaryFileSink(const std::string &filepath)
+        {
+            _fileStream.open(filepath, std::ios::trunc | std::ios::binary);
+            if (!_fileStream.is_open())
+            {
+                throw std::runtime_error("Failed to open log file: " + filepath);
+            }
+            _fileStream.write(BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+        }
+
+        void BinaryFileSink::write(LogLevel, std::string_view)
+        {
+        }
+
+        void BinaryFileSink::flush()
+        {
+            _fileStream.flush();
+        }
+
+        bool BinaryFileSink::consumesRecords() const
+        {
+            return true;
+        }
+
+        void BinaryFileSink::writeRecord(const LogRecord &record)
+        {
+            const std::uint64_t formatId = reinterpret_cast<std::uintptr_t>(record.format);
+
+            // Define each format string before its first use
+            if (record.format != nullptr && _formats.insert(record.format).second)
+            {
+                const std::uint32_t size = static_cast<std::uint32_t>(std::strlen(record.format));
+                writeValue(BinaryLogEntry::Format);
+                writeValue(formatId);
+                writeValue(size);
+                _fileStream.write(record.format, size);
+            }
+
+            const std::int64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          record.time.time_since_epoch())
+                                          .count();
+            writeValue(BinaryLogEntry::Record);
+            writeValue(static_cast<std::uint8_t>(record.level));
+            writeValue(time);
+            writeValue(record.monotonic);
+            writeValue(record.simulationTime);
+            writeValue(record.step);
+            writeValue(formatId);
+            writeValue(record.length);
+            _fileStream.write(record.message, record.length);
+        }
+
+        template <typename T> void BinaryFileSink::writeValue(const T &value)
+        {
+            _fileStream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,123 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file binary_log_reader.cpp
+ * @brief Definition of the BinaryLogReader class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "binary_log_reader.h"
+#include "binary_log_format.h"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        BinaryLogReader::BinaryLogReader(std::istream &input, std::uint32_t stamps) :
+            _input(input), _stamps(stamps), _record{}
+        {
+            char magic[sizeof(BINARY_LOG_MAGIC)];
+            if (!_input.read(magic, sizeof(magic)) ||
+                std::memcmp(magic, BINARY_LOG_MAGIC, sizeof(magic)) != 0)
+            {
+                throw std::runtime_error("Not an InertiaFX binary log.");
+            }
+        }
+
+        bool BinaryLogReader::next(std::string &line)
+        {
+            BinaryLogEntry entry;
+            while (readValue(entry))
+            {
+                std::uint64_t formatId = 0;
+                std::uint32_t size     = 0;
+                if (entry == BinaryLogEntry::Format)
+                {
+                    if (!readValue(formatId) || !readValue(size))
+                    {
+                        throw std::runtime_error("Truncated binary log format entry.");
+                    }
+                    std::string &format = _formats[formatId];
+                    format.resize(size);
+                    readBytes(format.data(), size);
+                    continue;
+                }
+                if (entry != BinaryLogEntry::Record)
+                {
+                    throw std::runtime_error("Corrupt binary log entry.");
+                }
+
+                std::uint8_t level     = 0;
+                std::int64_t time      = 0;
+                std::int64_t monotonic = 0;
+                double simulationTime  = 0.0;
+                std::uint64_t step     = 0;
+                if (!readValue(level) || !readValue(time) || !readValue(monotonic) ||
+                    !readValue(simulationTime) || !readValue(step) || !readValue(formatId) ||
+                    !readValue(size) || size > LogRecord::MAX_MESSAGE_LENGTH)
+                {
+                    throw std::runtime_error("Truncated binary log record.");
+                }
+                readBytes(_record.message, size);
+
+                _record.level          = static_cast<LogLevel>(level);
+                _record.time           = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        std::chrono::nanoseconds(time)));
+                _record.monotonic      = monotonic;
+                _record.simulationTime = simulationTime;
+                _record.step           = step;
+                _record.length         = size;
+                _record.format         = nullptr;
+                if (formatId != 0)
+                {
+                    const auto format = _formats.find(formatId);
+                    if (format == _formats.end())
+                    {
+                        throw std::runtime_error("Binary log record uses an undefined format.");
+                    }
+                    _record.format = format->second.c_str();
+                }
+                formatLogLine(_record, line, _stamps);
+                return true;
+            }
+            return false;
+        }
+
+        template <typename T> bool BinaryLogReader::readValue(T &value)
+        {
+            return static_cast<bool>(_input.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+
+        void BinaryLogReader::readBytes(char *destination, std::size_t size)
+        {
+            if (!_input.read(destination, static_cast<std::streamsize>(size)))
+            {
+                throw std::runtime_error("Truncated binary log.");
+            }
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
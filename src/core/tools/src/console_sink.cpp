@@ -0,0 +1,49 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file console_sink.cpp
+ * @brief Definition of the ConsoleSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "console_sink.h"
+#include <cstdio>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        void ConsoleSink::write(LogLevel level, std::string_view line)
+        {
+            FILE *outputFile =
+                (level == LogLevel::Error || level == LogLevel::Critical) ? stderr : stdout;
+            std::fwrite(line.data(), 1, line.size(), outputFile);
+        }
+
+        void ConsoleSink::flush()
+        {
+            std::fflush(stdout);
+            std::fflush(stderr);
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
@@ -24,11 +24,8 @@
  */
 
 #include "file_logger.h"
-
-#include <cstdarg>  // For va_list, va_start, va_end, va_copy
-#include <ctime>    // For std::time, std::localtime, std::strftime
-#include <iomanip>  // For std::setw, std::setfill
-#include <sstream>  // For std::ostringstream
+#include <cstring>
+#include <memory>
 #include <stdexcept>
 
 namespace InertiaFX
@@ -38,101 +35,48 @@ namespace Core
     namespace Tools
     {
         FileLogger::FileLogger(const std::string &filepath, LogLevel levelThreshold,
-                               bool printToFile) : _filepath(filepath), _printToFile(printToFile)
+                               bool printToFile, const FileSinkOptions &fileOptions) :
+            _printToFile(printToFile),
+            _fileSink(static_cast<FileSink &>(
+                addSink(std::make_unique<FileSink>(filepath, fileOptions))))
         {
             // Set the base logger threshold
             setThreshold(levelThreshold);
-
-            // Attempt to open file in append mode
-            _fileStream.open(filepath, std::ios::app);
-            if (!_fileStream.is_open())
-            {
-                throw std::runtime_error("Failed to open log file: " + filepath);
-            }
+            setSinkEnabled(_fileSink, _printToFile);
         }
 
-        FileLogger::~FileLogger()
-        {
-            if (_fileStream.is_open())
-            {
-                _fileStream.close();  // Close the file stream if it is open
-            }
-        }
+        FileLogger::~FileLogger() = default;
 
         void FileLogger::setPrintToFile(bool printToFile)
         {
             _printToFile = printToFile;
+            setSinkEnabled(_fileSink, _printToFile);
         }
 
         void FileLogger::clearLogs()
         {
-            if (_fileStream.is_open())
-            {
-                _fileStream.close();  // Close the file stream if it is open
-            }
-            _fileStream.open(_filepath, std::ios::trunc);  // Clear the log file
+            _fileSink.truncate();  // Clear the log file
         }
 
         void FileLogger::log(LogLevel level, const char *format, ...)
         {
-            if (_enabled && level >= _threshold)
+            if (shouldLog(level))
             {
-                std::string formatStr(format);
-                if (formatStr.size() > FileLogger::MAX_LOG_MESSAGE_LENGTH)
+                if (std::strlen(format) > FileLogger::MAX_LOG_MESSAGE_LENGTH)
                 {
                     std::string errorMsg = "Log message exceeds maximum length of " +
                                            std::to_string(FileLogger::MAX_LOG_MESSAGE_LENGTH) +
                                            " characters.";
                     throw std::runtime_error(errorMsg);
                 }
+
                 va_list args;
                 va_start(args, format);
-
-                // Duplicate variadic arguments for file logging
-                va_list argsFile;
-                va_copy(argsFile, args);
-
-                char msgBuffer[FileLogger::MAX_LOG_MESSAGE_LENGTH + 40];
-                vsnprintf(msgBuffer, sizeof(msgBuffer), format, args);
+                vLog(level, format, args);
                 va_end(args);
-
-                // Log to console using the base Logger
-                Logger::log(level, "%s", msgBuffer);
-
-                // Log to file using the duplicated arguments
-                if (_fileStream.is_open())
-                {
-                    vLogFile(level, format, argsFile);
-                }
-                va_end(argsFile);
             }
         }
 
-        void FileLogger::vLogFile(LogLevel level, const char *format, va_list args)
-        {
-            // Get current time
-            std::time_t now   = std::time(nullptr);
-            std::tm localTime = *std::localtime(&now);
-
-            // Format the time string: [YYYY-MM-DD HH:MM:SS]
-            char timeBuf[32];
-            std::strftime(timeBuf, sizeof(timeBuf), "%Y-%m-%d %H:%M:%S", &localTime);
-
-            // Convert LogLevel to string
-            const char *levelStr = logLevelToString(level);
-
-            // Format the user message
-            char messageBuffer[FileLogger::MAX_LOG_MESSAGE_LENGTH + 40];
-            vsnprintf(messageBuffer, sizeof(messageBuffer), format, args);
-
-            // Output to file: [time] [level] message
-            _fileStream << "[" << timeBuf << "] "
-                        << "[" << levelStr << "] " << messageBuffer << "\n";
-
-            // Flush to ensure timely writes (optional, but often helpful for log files)
-            _fileStream.flush();
-        }
-
     }  // namespace Tools
 }  // namespace Core
 }  // namespace InertiaFX
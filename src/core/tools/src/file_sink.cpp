@@ -0,0 +1,313 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file file_sink.cpp
+ * @brief Definition of the FileSink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "file_sink.h"
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        namespace
+        {
+            /**
+             * @brief Sinks flushed by the terminate handler, and the handler they replaced.
+             */
+            struct TerminateRegistry
+            {
+                std::mutex mutex;
+                std::vector<FileSink *> sinks;
+                std::terminate_handler previous = nullptr;
+                bool installed                  = false;
+            };
+
+            TerminateRegistry &getTerminateRegistry()
+            {
+                static TerminateRegistry registry;
+                return registry;
+            }
+        }  // namespace
+
+        FileSink::FileSink(const std::string &filepath, const FileSinkOptions &options) :
+            _filepath(filepath), _options(options), _file(nullptr), _fileSize(0), _records(0),
+            _writes(0), _stopping(false)
+        {
+            _buffer.reserve(_options.bufferSize);
+            open();
+
+            if (_options.flushInterval.count() > 0)
+            {
+                _timer = std::thread(&FileSink::flushPeriodically, this);
+            }
+
+            if (_options.flushOnTerminate)
+            {
+                TerminateRegistry &registry = getTerminateRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                if (!registry.installed)
+                {
+                    registry.previous  = std::set_terminate(&FileSink::terminateHandler);
+                    registry.installed = true;
+                }
+                registry.sinks.push_back(this);
+            }
+        }
+
+        FileSink::~FileSink()
+        {
+            if (_options.flushOnTerminate)
+            {
+                TerminateRegistry &registry = getTerminateRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                std::vector<FileSink *> &sinks = registry.sinks;
+                sinks.erase(std::remove(sinks.begin(), sinks.end(), this), sinks.end());
+                // The last sink hands the process its handler back
+                if (sinks.empty() && registry.installed)
+                {
+                    std::set_terminate(registry.previous);
+                    registry.previous  = nullptr;
+                    registry.installed = false;
+                }
+            }
+
+            if (_timer.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stopping = true;
+                }
+                _timerWake.notify_one();
+                _timer.join();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            writeBuffer();
+            if (_file != nullptr)
+            {
+                std::fclose(_file);
+            }
+        }
+
+        void FileSink::write(LogLevel level, std::string_view line)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // Rotate on a line boundary, before the file would outgrow its limit
+            const std::size_t pending = _fileSize + _buffer.size();
+            if (_options.maxFileSize > 0 && pending > 0 &&
+                pending + line.size() > _options.maxFileSize)
+            {
+                writeBuffer();
+                rotate();
+            }
+
+            // Lines that do not fit the buffer go straight to the file
+            if (line.size() >= _options.bufferSize)
+            {
+                writeBuffer();
+                writeToFile(line.data(), line.size());
+                return;
+            }
+            if (_buffer.size() + line.size() > _options.bufferSize)
+            {
+                writeBuffer();
+            }
+
+            const bool timed = _options.flushInterval.count() > 0;
+            const auto now   = timed ? std::chrono::steady_clock::now()
+                                     : std::chrono::steady_clock::time_point();
+            if (_records == 0)
+            {
+                _oldest = now;
+                if (timed)
+                {
+                    _timerWake.notify_one();
+                }
+            }
+            _buffer.append(line);
+            ++_records;
+
+            const bool due = (_options.flushEveryRecords > 0 &&
+                              _records >= _options.flushEveryRecords) ||
+                             (_options.flushLevel && level >= *_options.flushLevel) ||
+                             (timed && now - _oldest >= _options.flushInterval);
+            if (due)
+            {
+                writeBuffer();
+            }
+        }
+
+        void FileSink::flush()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            writeBuffer();
+        }
+
+        void FileSink::truncate()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _buffer.clear();
+            _records = 0;
+
+            // The file is opened for appending, so the next write lands at the new end
+            std::error_code error;
+            std::filesystem::resize_file(_filepath, 0, error);
+            if (error)
+            {
+                throw std::runtime_error("Failed to truncate log file: " + _filepath);
+            }
+            _fileSize = 0;
+        }
+
+        std::size_t FileSink::getWriteCount() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _writes;
+        }
+
+        std::size_t FileSink::getBufferedSize() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _buffer.size();
+        }
+
+        void FileSink::flushPeriodically()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (!_stopping)
+            {
+                if (_records == 0)
+                {
+                    _timerWake.wait(lock);
+                    continue;
+                }
+                const auto deadline = _oldest + _options.flushInterval;
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    writeBuffer();
+                }
+                else
+                {
+                    _timerWake.wait_until(lock, deadline);
+                }
+            }
+        }
+
+        void FileSink::open()
+        {
+            _file = std::fopen(_filepath.c_str(), "ab");
+            if (_file == nullptr)
+            {
+                throw std::runtime_error("Failed to open log file: " + _filepath);
+            }
+
+            // The sink does its own buffering: each fwrite becomes a single write
+            std::setvbuf(_file, nullptr, _IONBF, 0);
+
+            std::error_code error;
+            const std::uintmax_t size = std::filesystem::file_size(_filepath, error);
+            _fileSize                 = error ? 0 : static_cast<std::size_t>(size);
+        }
+
+        void FileSink::writeBuffer()
+        {
+            if (_buffer.empty())
+            {
+                return;
+            }
+            writeToFile(_buffer.data(), _buffer.size());
+            _buffer.clear();
+            _records = 0;
+        }
+
+        void FileSink::writeToFile(const char *data, std::size_t size)
+        {
+            // Only null after a failed rotation; the lines are lost rather than thrown
+            if (_file == nullptr)
+            {
+                return;
+            }
+            std::fwrite(data, 1, size, _file);
+            _fileSize += size;
+            ++_writes;
+        }
+
+        void FileSink::rotate()
+        {
+            std::fclose(_file);
+            _file = nullptr;
+
+            // <path>.N-1 -> <path>.N, ..., <path> -> <path>.1; the oldest backup is replaced
+            std::error_code error;
+            for (std::size_t index = _options.maxBackups; index > 1; --index)
+            {
+                std::filesystem::rename(_filepath + "." + std::to_string(index - 1),
+                                        _filepath + "." + std::to_string(index), error);
+            }
+            if (_options.maxBackups > 0)
+            {
+                std::filesystem::rename(_filepath, _filepath + ".1", error);
+            }
+            else
+            {
+                std::filesystem::remove(_filepath, error);
+            }
+            open();
+        }
+
+        void FileSink::terminateHandler()
+        {
+            // Best effort: skip whatever is locked, the terminating thread may hold it
+            TerminateRegistry &registry = getTerminateRegistry();
+            if (registry.mutex.try_lock())
+            {
+                for (FileSink *sink : registry.sinks)
+                {
+                    if (sink->_mutex.try_lock())
+                    {
+                        sink->writeBuffer();
+                        sink->_mutex.unlock();
+                    }
+                }
+                registry.mutex.unlock();
+            }
+
+            if (registry.previous != nullptr)
+            {
+                registry.previous();
+            }
+            std::abort();
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
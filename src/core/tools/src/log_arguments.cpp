@@ -0,0 +1,305 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_arguments.cpp
+ * @brief Definition of the deferred log argument formatting.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "log_arguments.h"
+#include <cstdio>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        namespace
+        {
+            // One decoded argument
+            struct Argument
+            {
+                ArgumentType type           = ArgumentType::Int;
+                std::int64_t signedValue    = 0;
+                std::uint64_t unsignedValue = 0;
+                double doubleValue          = 0.0;
+                std::string_view text;
+            };
+
+            // Reads the argument at offset and advances it; false once the payload is exhausted
+            bool readArgument(const char *payload, std::uint32_t length, std::size_t &offset,
+                              Argument &argument)
+            {
+                if (offset + 1 > length)
+                {
+                    return false;
+                }
+                argument.type          = static_cast<ArgumentType>(payload[offset]);
+                const char *value      = payload + offset + 1;
+                const std::size_t left = length - offset - 1;
+                switch (argument.type)
+                {
+                    case ArgumentType::Int:
+                    case ArgumentType::UInt:
+                    case ArgumentType::Double:
+                    case ArgumentType::Pointer:
+                        if (left < 8)
+                        {
+                            return false;
+                        }
+                        std::memcpy(&argument.signedValue, value, 8);
+                        std::memcpy(&argument.unsignedValue, value, 8);
+                        std::memcpy(&argument.doubleValue, value, 8);
+                        offset += 9;
+                        return true;
+                    case ArgumentType::String:
+                    {
+                        std::uint32_t size = 0;
+                        if (left < sizeof(size))
+                        {
+                            return false;
+                        }
+                        std::memcpy(&size, value, sizeof(size));
+                        if (left - sizeof(size) < size)
+                        {
+                            return false;
+                        }
+                        argument.text = std::string_view(value + sizeof(size), size);
+                        offset += 1 + sizeof(size) + size;
+                        return true;
+                    }
+                    default:
+                        return false;
+                }
+            }
+
+            long long asSigned(const Argument &argument)
+            {
+                switch (argument.type)
+                {
+                    case ArgumentType::Double:
+                        return static_cast<long long>(argument.doubleValue);
+                    case ArgumentType::UInt:
+                    case ArgumentType::Pointer:
+                        return static_cast<long long>(argument.unsignedValue);
+                    default:
+                        return static_cast<long long>(argument.signedValue);
+                }
+            }
+
+            unsigned long long asUnsigned(const Argument &argument)
+            {
+                if (argument.type == ArgumentType::Double)
+                {
+                    return static_cast<unsigned long long>(argument.doubleValue);
+                }
+                return static_cast<unsigned long long>(argument.unsignedValue);
+            }
+
+            double asDouble(const Argument &argument)
+            {
+                switch (argument.type)
+                {
+                    case ArgumentType::Int:
+                        return static_cast<double>(argument.signedValue);
+                    case ArgumentType::UInt:
+                    case ArgumentType::Pointer:
+                        return static_cast<double>(argument.unsignedValue);
+                    default:
+                        return argument.doubleValue;
+                }
+            }
+
+            // snprintf straight into the output, growing it when the value is long
+            template <typename T>
+            void appendFormatted(std::string &out, const std::string &spec, T value)
+            {
+                char buffer[128];
+                const int size = std::snprintf(buffer, sizeof(buffer), spec.c_str(), value);
+                if (size < 0)
+                {
+                    return;
+                }
+                if (static_cast<std::size_t>(size) < sizeof(buffer))
+                {
+                    out.append(buffer, static_cast<std::size_t>(size));
+                    return;
+                }
+                const std::size_t start = out.size();
+                out.resize(start + static_cast<std::size_t>(size) + 1);
+                std::snprintf(&out[start], static_cast<std::size_t>(size) + 1, spec.c_str(), value);
+                out.resize(start + static_cast<std::size_t>(size));
+            }
+
+            // Text of a number printed through %s
+            std::string numberText(const Argument &argument)
+            {
+                char buffer[32];
+                int size = 0;
+                switch (argument.type)
+                {
+                    case ArgumentType::Int:
+                        size = std::snprintf(buffer, sizeof(buffer), "%lld", asSigned(argument));
+                        break;
+                    case ArgumentType::UInt:
+                        size = std::snprintf(buffer, sizeof(buffer), "%llu", asUnsigned(argument));
+                        break;
+                    case ArgumentType::Pointer:
+                        size =
+                            std::snprintf(buffer, sizeof(buffer), "0x%llx", asUnsigned(argument));
+                        break;
+                    default:
+                        size = std::snprintf(buffer, sizeof(buffer), "%g", argument.doubleValue);
+                        break;
+                }
+                return std::string(buffer, size > 0 ? static_cast<std::size_t>(size) : 0);
+            }
+
+            // Formats one argument; spec holds the flags, width and precision
+            void appendConversion(std::string &out, std::string spec, char conversion,
+                                  const Argument &argument)
+            {
+                switch (conversion)
+                {
+                    case 'd':
+                    case 'i':
+                        spec += "ll";
+                        spec += conversion;
+                        appendFormatted(out, spec, asSigned(argument));
+                        break;
+                    case 'u':
+                    case 'o':
+                    case 'x':
+                    case 'X':
+                        spec += "ll";
+                        spec += conversion;
+                        appendFormatted(out, spec, asUnsigned(argument));
+                        break;
+                    case 'c':
+                        spec += conversion;
+                        appendFormatted(out, spec, static_cast<int>(asSigned(argument)));
+                        break;
+                    case 'p':
+                        spec += conversion;
+                        appendFormatted(out, spec,
+                                        reinterpret_cast<void *>(
+                                            static_cast<std::uintptr_t>(asUnsigned(argument))));
+                        break;
+                    case 's':
+                    {
+                        spec += conversion;
+                        const std::string text = argument.type == ArgumentType::String
+                                                     ? std::string(argument.text)
+                                                     : numberText(argument);
+                        appendFormatted(out, spec, text.c_str());
+                        break;
+                    }
+                    default:
+                        // Floating point conversions
+                        spec += conversion;
+                        appendFormatted(out, spec, asDouble(argument));
+                        break;
+                }
+            }
+        }  // namespace
+
+        void formatLogArguments(const char *format, const char *payload, std::uint32_t length,
+                                std::string &out)
+        {
+            std::size_t offset = 0;
+            const char *cursor = format;
+            while (*cursor != '\0')
+            {
+                // Copy plain text up to the next conversion
+                if (*cursor != '%')
+                {
+                    const char *next = std::strchr(cursor, '%');
+                    if (next == nullptr)
+                    {
+                        out.append(cursor);
+                        return;
+                    }
+                    out.append(cursor, static_cast<std::size_t>(next - cursor));
+                    cursor = next;
+                    continue;
+                }
+                if (cursor[1] == '%')
+                {
+                    out.push_back('%');
+                    cursor += 2;
+                    continue;
+                }
+
+                // Parse flags, width, precision and length modifiers; '*' takes an argument
+                const char *start = cursor++;
+                std::string spec  = "%";
+                bool complete     = true;
+                Argument argument;
+                while (*cursor != '\0' && std::strchr("-+ #0", *cursor) != nullptr)
+                {
+                    spec += *cursor++;
+                }
+                for (int field = 0; field < 2; ++field)
+                {
+                    if (field == 1)
+                    {
+                        if (*cursor != '.')
+                        {
+                            break;
+                        }
+                        spec += *cursor++;
+                    }
+                    if (*cursor == '*')
+                    {
+                        ++cursor;
+                        complete = complete && readArgument(payload, length, offset, argument);
+                        spec += std::to_string(asSigned(argument));
+                    }
+                    while (*cursor >= '0' && *cursor <= '9')
+                    {
+                        spec += *cursor++;
+                    }
+                }
+                while (*cursor != '\0' && std::strchr("hlLqjzt", *cursor) != nullptr)
+                {
+                    ++cursor;
+                }
+
+                const char conversion = *cursor;
+                if (conversion == '\0' || std::strchr("diuoxXcpsfFeEgGaA", conversion) == nullptr)
+                {
+                    // Unknown or truncated conversion: copy it through
+                    out.append(start, static_cast<std::size_t>(cursor - start));
+                    continue;
+                }
+                ++cursor;
+
+                if (!complete || !readArgument(payload, length, offset, argument))
+                {
+                    out.append(start, static_cast<std::size_t>(cursor - start));
+                    continue;
+                }
+                appendConversion(out, spec, conversion, argument);
+            }
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
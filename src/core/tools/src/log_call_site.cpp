@@ -0,0 +1,205 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_call_site.cpp
+ * @brief Definition of the LogCallSite class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "log_call_site.h"
+#include "ilogger.h"
+#include "log_clock.h"
+#include <limits>
+#include <mutex>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        namespace
+        {
+            /**
+             * @brief Every constructed call site, as an intrusive list.
+             */
+            struct CallSiteRegistry
+            {
+                std::mutex mutex;
+                LogCallSite *head = nullptr;
+            };
+
+            CallSiteRegistry &getCallSiteRegistry()
+            {
+                static CallSiteRegistry registry;
+                return registry;
+            }
+        }  // namespace
+
+        LogCallSite::LogCallSite(const char *file, unsigned int line) :
+            _file(file), _line(line), _windowStart(std::numeric_limits<std::int64_t>::min()),
+            _windowCount(0), _calls(0), _logged(false), _suppressed(0), _unreported(0),
+            _lastReport(getLogMonotonicTime()), _previous(nullptr), _next(nullptr)
+        {
+            CallSiteRegistry &registry = getCallSiteRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            _next = registry.head;
+            if (_next != nullptr)
+            {
+                _next->_previous = this;
+            }
+            registry.head = this;
+        }
+
+        LogCallSite::~LogCallSite()
+        {
+            CallSiteRegistry &registry = getCallSiteRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            if (_previous != nullptr)
+            {
+                _previous->_next = _next;
+            }
+            else
+            {
+                registry.head = _next;
+            }
+            if (_next != nullptr)
+            {
+                _next->_previous = _previous;
+            }
+        }
+
+        bool LogCallSite::allowRate(std::uint32_t limit, std::chrono::nanoseconds period)
+        {
+            // Whoever moves the window on resets its count; racing callers may see either count
+            const std::int64_t now = getLogMonotonicTime();
+            std::int64_t start     = _windowStart.load(std::memory_order_relaxed);
+            if (start == std::numeric_limits<std::int64_t>::min() || now - start >= period.count())
+            {
+                if (_windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+                {
+                    _windowCount.store(0, std::memory_order_relaxed);
+                }
+            }
+            if (_windowCount.fetch_add(1, std::memory_order_relaxed) < limit)
+            {
+                return true;
+            }
+            suppress();
+            return false;
+        }
+
+        bool LogCallSite::allowSample(std::uint32_t every)
+        {
+            if (every <= 1 || _calls.fetch_add(1, std::memory_order_relaxed) % every == 0)
+            {
+                return true;
+            }
+            suppress();
+            return false;
+        }
+
+        bool LogCallSite::allowOnce()
+        {
+            // Plain load first: once logged, the flag is only read
+            if (!_logged.load(std::memory_order_relaxed) &&
+                !_logged.exchange(true, std::memory_order_relaxed))
+            {
+                return true;
+            }
+            suppress();
+            return false;
+        }
+
+        std::uint64_t LogCallSite::takeSuppressedReport(std::chrono::nanoseconds interval)
+        {
+            if (_unreported.load(std::memory_order_relaxed) == 0)
+            {
+                return 0;
+            }
+            const std::int64_t now = getLogMonotonicTime();
+            std::int64_t last      = _lastReport.load(std::memory_order_relaxed);
+            if (now - last < interval.count() ||
+                !_lastReport.compare_exchange_strong(last, now, std::memory_order_relaxed))
+            {
+                return 0;
+            }
+            return _unreported.exchange(0, std::memory_order_relaxed);
+        }
+
+        std::uint64_t LogCallSite::getSuppressedCount() const
+        {
+            return _suppressed.load(std::memory_order_relaxed);
+        }
+
+        const char *LogCallSite::getFile() const
+        {
+            return _file;
+        }
+
+        unsigned int LogCallSite::getLine() const
+        {
+            return _line;
+        }
+
+        void LogCallSite::reportAll(ILogger &logger, LogLevel level)
+        {
+            CallSiteRegistry &registry = getCallSiteRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (LogCallSite *site = registry.head; site != nullptr; site = site->_next)
+            {
+                const std::uint64_t count =
+                    site->_unreported.exchange(0, std::memory_order_relaxed);
+                if (count > 0)
+                {
+                    logger.logSuppressedCount(*site, level, count);
+                }
+            }
+        }
+
+        void LogCallSite::resetAll()
+        {
+            CallSiteRegistry &registry = getCallSiteRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (LogCallSite *site = registry.head; site != nullptr; site = site->_next)
+            {
+                site->reset();
+            }
+        }
+
+        void LogCallSite::suppress()
+        {
+            _suppressed.fetch_add(1, std::memory_order_relaxed);
+            _unreported.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void LogCallSite::reset()
+        {
+            _windowStart.store(std::numeric_limits<std::int64_t>::min(), std::memory_order_relaxed);
+            _windowCount.store(0, std::memory_order_relaxed);
+            _calls.store(0, std::memory_order_relaxed);
+            _logged.store(false, std::memory_order_relaxed);
+            _suppressed.store(0, std::memory_order_relaxed);
+            _unreported.store(0, std::memory_order_relaxed);
+            _lastReport.store(getLogMonotonicTime(), std::memory_order_relaxed);
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
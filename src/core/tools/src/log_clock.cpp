@@ -0,0 +1,79 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_clock.cpp
+ * @brief Definition of the log time stamps and the TimestampCache class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "log_clock.h"
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        std::int64_t getLogMonotonicTime()
+        {
+            static const std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                .count();
+        }
+
+        TimestampCache::TimestampCache() :
+            _seconds(0), _valid(false), _length(0), _text{}, _conversions(0)
+        {
+        }
+
+        std::string_view TimestampCache::format(std::time_t seconds)
+        {
+            if (!_valid || seconds != _seconds)
+            {
+                // localtime_r is reentrant, unlike localtime, and takes no global lock
+                std::tm localTime{};
+#ifdef _WIN32
+                localtime_s(&localTime, &seconds);
+#else
+                localtime_r(&seconds, &localTime);
+#endif
+                _length  = std::strftime(_text, sizeof(_text), "%Y-%m-%d %H:%M:%S", &localTime);
+                _seconds = seconds;
+                _valid   = true;
+                ++_conversions;
+            }
+            return std::string_view(_text, _length);
+        }
+
+        std::uint64_t TimestampCache::getConversionCount() const
+        {
+            return _conversions;
+        }
+
+        TimestampCache &getThreadTimestampCache()
+        {
+            thread_local TimestampCache cache;
+            return cache;
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
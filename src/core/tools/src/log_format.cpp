@@ -0,0 +1,153 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_format.cpp
+ * @brief Definition of the "{}" log message formatting.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "log_format.h"
+#include <algorithm>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        namespace
+        {
+            // The std::to_chars notation of a presentation type
+            std::chars_format charsFormat(char type)
+            {
+                switch (type)
+                {
+                    case 'f':
+                        return std::chars_format::fixed;
+                    case 'e':
+                        return std::chars_format::scientific;
+                    default:
+                        return std::chars_format::general;
+                }
+            }
+        }  // namespace
+
+        void appendLogFloat(std::string &out, double value, const LogFormatSpec &spec)
+        {
+            // Write into the string's own storage; retry with room for every digit of a
+            // large fixed value
+            const std::size_t offset = out.size();
+            const std::size_t digits = static_cast<std::size_t>(std::max(spec.precision, 0));
+            for (std::size_t room = 32 + digits;; room = 328 + digits)
+            {
+                out.resize(offset + room);
+                char *first = out.data() + offset;
+                char *last  = out.data() + out.size();
+                std::to_chars_result result;
+                if (spec.type == 0 && spec.precision < 0)
+                {
+                    result = std::to_chars(first, last, value);
+                }
+                else
+                {
+                    const std::chars_format format = charsFormat(spec.type);
+                    result = spec.precision < 0 ? std::to_chars(first, last, value, format)
+                                                : std::to_chars(first, last, value, format,
+                                                                spec.precision);
+                }
+                if (result.ec == std::errc())
+                {
+                    out.resize(static_cast<std::size_t>(result.ptr - out.data()));
+                    return;
+                }
+                if (room > 32 + digits)
+                {
+                    out.resize(offset);
+                    return;
+                }
+            }
+        }
+
+        void appendLogFormatArgs(std::string &out, std::string_view format,
+                                 const LogFormatArg *args, std::size_t count)
+        {
+            std::size_t next     = 0;
+            std::size_t position = 0;
+            while (position < format.size())
+            {
+                const std::size_t brace = format.find_first_of("{}", position);
+                if (brace == std::string_view::npos)
+                {
+                    out.append(format.substr(position));
+                    return;
+                }
+                out.append(format.substr(position, brace - position));
+
+                // "{{" and "}}" are literal braces; a lone '}' is copied as is
+                if (format[brace] == '}' || (brace + 1 < format.size() && format[brace + 1] == '{'))
+                {
+                    out.push_back(format[brace]);
+                    const bool doubled =
+                        brace + 1 < format.size() && format[brace + 1] == format[brace];
+                    position = brace + (doubled ? 2 : 1);
+                    continue;
+                }
+
+                const std::size_t close = format.find('}', brace);
+                if (close == std::string_view::npos)
+                {
+                    out.append(format.substr(brace));
+                    return;
+                }
+
+                // {[index][:spec]}
+                const std::string_view field = format.substr(brace + 1, close - brace - 1);
+                const std::size_t colon      = field.find(':');
+                const std::string_view index = field.substr(0, colon);
+                std::size_t argument         = next++;
+                if (!index.empty())
+                {
+                    const std::from_chars_result parsed =
+                        std::from_chars(index.data(), index.data() + index.size(), argument);
+                    if (parsed.ec != std::errc() || parsed.ptr != index.data() + index.size())
+                    {
+                        argument = count;
+                    }
+                }
+
+                if (argument < count)
+                {
+                    std::string_view spec;
+                    if (colon != std::string_view::npos)
+                    {
+                        spec = field.substr(colon + 1);
+                    }
+                    args[argument].append(out, args[argument].value, parseLogFormatSpec(spec));
+                }
+                else
+                {
+                    out.append(format.substr(brace, close - brace + 1));
+                }
+                position = close + 1;
+            }
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
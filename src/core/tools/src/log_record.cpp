@@ -0,0 +1,160 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file log_record.cpp
+ * @brief Definition of the log record helpers.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "log_record.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        const char *logLevelName(LogLevel level)
+        {
+            switch (level)
+            {
+                case LogLevel::Debug:
+                    return "Debug";
+                case LogLevel::Info:
+                    return "Info";
+                case LogLevel::Warning:
+                    return "Warning";
+                case LogLevel::Error:
+                    return "Error";
+                case LogLevel::Critical:
+                    return "Critical";
+                default:
+                    return "Unknown";
+            }
+        }
+
+        void stampLogRecord(LogRecord &record, LogLevel level, const ILogger &logger)
+        {
+            record.level          = level;
+            record.time           = std::chrono::system_clock::now();
+            record.monotonic      = (logger.getStamps() & LogStamp::Monotonic) != 0
+                                        ? getLogMonotonicTime()
+                                        : 0;
+            record.simulationTime = logger.getSimulationTime();
+            record.step           = logger.getSimulationStep();
+        }
+
+        void appendLogPrefix(const LogRecord &record, std::uint32_t stamps, std::string &line)
+        {
+            char buffer[64];
+            if ((stamps & LogStamp::Date) != 0)
+            {
+                // Only the first record of each second converts to local time
+                const auto sinceEpoch = record.time.time_since_epoch();
+                const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+                line.push_back('[');
+                line.append(getThreadTimestampCache().format(
+                    static_cast<std::time_t>(seconds.count())));
+                if ((stamps & LogStamp::Microseconds) != 0)
+                {
+                    const auto micros =
+                        std::chrono::duration_cast<std::chrono::microseconds>(sinceEpoch - seconds);
+                    std::snprintf(buffer, sizeof(buffer), ".%06lld",
+                                  static_cast<long long>(micros.count()));
+                    line.append(buffer);
+                }
+                line.append("] ");
+            }
+            if ((stamps & LogStamp::Monotonic) != 0)
+            {
+                std::snprintf(buffer, sizeof(buffer), "[+%.6f] ",
+                              static_cast<double>(record.monotonic) * 1e-9);
+                line.append(buffer);
+            }
+            if (!std::isnan(record.simulationTime))
+            {
+                if ((stamps & LogStamp::SimulationTime) != 0)
+                {
+                    std::snprintf(buffer, sizeof(buffer), "[t=%.9g s] ", record.simulationTime);
+                    line.append(buffer);
+                }
+                if ((stamps & LogStamp::Step) != 0)
+                {
+                    std::snprintf(buffer, sizeof(buffer), "[step %llu] ",
+                                  static_cast<unsigned long long>(record.step));
+                    line.append(buffer);
+                }
+            }
+
+            // [level]
+            line.push_back('[');
+            line.append(logLevelName(record.level));
+            line.append("] ");
+        }
+
+        void appendLogMessage(std::string &line, const char *format, va_list args)
+        {
+            va_list retry;
+            va_copy(retry, args);
+
+            // Format straight into the spare capacity; only overlong messages format twice
+            const std::size_t offset = line.size();
+            const std::size_t room   = std::max<std::size_t>(line.capacity() - offset, 256);
+            line.resize(offset + room);
+            const int length = vsnprintf(line.data() + offset, room + 1, format, args);
+            if (length < 0)
+            {
+                line.resize(offset);
+            }
+            else if (static_cast<std::size_t>(length) > room)
+            {
+                line.resize(offset + static_cast<std::size_t>(length));
+                vsnprintf(line.data() + offset, static_cast<std::size_t>(length) + 1, format,
+                          retry);
+            }
+            else
+            {
+                line.resize(offset + static_cast<std::size_t>(length));
+            }
+            va_end(retry);
+        }
+
+        void formatLogLine(const LogRecord &record, std::string &line, std::uint32_t stamps)
+        {
+            // [time] [level] message
+            line.clear();
+            appendLogPrefix(record, stamps, line);
+            if (record.format != nullptr)
+            {
+                formatLogArguments(record.format, record.message, record.length, line);
+            }
+            else
+            {
+                line.append(record.message, record.length);
+            }
+            line.push_back('\n');
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
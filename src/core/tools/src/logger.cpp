@@ -24,7 +24,12 @@
  */
 
 #include "Logger.h"
-#include <ctime>
+#include "console_sink.h"
+#include "log_record.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
 
 namespace InertiaFX
 {
@@ -32,90 +37,373 @@ namespace Core
 {
     namespace Tools
     {
-        Logger::Logger() : _enabled(true), _threshold(LogLevel::Debug)
+        namespace
         {
+            std::atomic<std::uint64_t> nextLoggerId{1}; /**< Id of the next Logger. */
+
+            constexpr std::size_t CACHED_LOGGERS = 4; /**< Loggers whose buffer a thread caches. */
+        }  // namespace
+
+        Logger::Logger() :
+            _enabled(true), _threshold(LogLevel::Debug),
+            _id(nextLoggerId.fetch_add(1, std::memory_order_relaxed)), _autoFlush(false),
+            _recordSinks(false), _writing(false), _staged(0), _sinkCount(0)
+        {
+            setActiveLevel(_enabled, _threshold);
+            addSink(std::make_unique<ConsoleSink>());
         }
 
-        Logger::~Logger() = default;
+        Logger::~Logger()
+        {
+            lockSinks();
+            mergeStaged();
+            _writing.store(false);
+        }
 
         void Logger::log(LogLevel level, const char *format, ...)
         {
             // If logging is disabled or level is below threshold, skip.
-            if (!_enabled || level < _threshold)
+            if (!shouldLog(level))
             {
                 return;
             }
 
-            // Decide which stream to write to based on log level.
-            FILE *outputFile =
-                (level == LogLevel::Error || level == LogLevel::Critical) ? stderr : stdout;
-
             // Variadic argument handling
             va_list args;
             va_start(args, format);
-            vLog(level, outputFile, format, args);
+            vLog(level, format, args);
             va_end(args);
         }
 
         void Logger::enable()
         {
             _enabled = true;
+            setActiveLevel(_enabled, _threshold);
         }
 
         void Logger::disable()
         {
             _enabled = false;
+            setActiveLevel(_enabled, _threshold);
         }
 
         void Logger::setThreshold(LogLevel level)
         {
             _threshold = level;
+            setActiveLevel(_enabled, _threshold);
         }
 
-        void Logger::vLog(LogLevel level, FILE *outputFile, const char *format, va_list args)
+        ILogSink &Logger::addSink(std::unique_ptr<ILogSink> sink)
         {
-            // Get current time
-            std::time_t now   = std::time(nullptr);
-            std::tm localTime = *std::localtime(&now);
+            lockSinks();
+            _recordSinks = _recordSinks || sink->consumesRecords();
+            _sinks.push_back({std::move(sink), true});
+            _sinkCount.store(_sinks.size(), std::memory_order_relaxed);
+            ILogSink &added = *_sinks.back().sink;
+            unlockSinks();
+            return added;
+        }
 
-            // Format the time string
-            char timeBuf[32];
-            std::strftime(timeBuf, sizeof(timeBuf), "%Y-%m-%d %H:%M:%S", &localTime);
+        void Logger::clearSinks()
+        {
+            lockSinks();
+            _sinks.clear();
+            _sinkCount.store(0, std::memory_order_relaxed);
+            _recordSinks = false;
+            unlockSinks();
+        }
 
-            // Print prefix: [YYYY-MM-DD HH:MM:SS] [LEVEL]
-            fprintf(outputFile, "[%s] [%s] ", timeBuf, logLevelToString(level));
+        std::size_t Logger::getSinkCount() const
+        {
+            // _sinks is only read by the thread holding the sinks
+            return _sinkCount.load(std::memory_order_relaxed);
+        }
 
-            // Print the user-supplied message
-            vfprintf(outputFile, format, args);
+        std::size_t Logger::getThreadBufferCount() const
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            return _buffers.size();
+        }
 
-            // Terminate with a newline
-            fprintf(outputFile, "\n");
+        void Logger::setSinkEnabled(const ILogSink &sink, bool enabled)
+        {
+            lockSinks();
+            _recordSinks = false;
+            for (SinkEntry &entry : _sinks)
+            {
+                if (entry.sink.get() == &sink)
+                {
+                    entry.enabled = enabled;
+                }
+                _recordSinks = _recordSinks || (entry.enabled && entry.sink->consumesRecords());
+            }
+            unlockSinks();
         }
 
-        const char *Logger::logLevelToString(LogLevel level) const
+        void Logger::setAutoFlush(bool autoFlush)
+        {
+            lockSinks();
+            _autoFlush = autoFlush;
+            unlockSinks();
+        }
+
+        void Logger::flush()
+        {
+            lockSinks();
+            mergeStaged();
+            for (const SinkEntry &entry : _sinks)
+            {
+                entry.sink->flush();
+            }
+            unlockSinks();
+        }
+
+        template <typename AppendMessage>
+        void Logger::stageLine(LogLevel level, const AppendMessage &appendMessage)
+        {
+            LogRecord header;
+            stampLogRecord(header, level, *this);
+            const std::int64_t order = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now().time_since_epoch())
+                                           .count();
+
+            // Format [YYYY-MM-DD HH:MM:SS] [LEVEL] message once, whatever the number of sinks,
+            // straight into this thread's staging buffer
+            ThreadBuffer &buffer = getThreadBuffer();
+            {
+                std::lock_guard<std::mutex> lock(buffer.mutex);
+                std::string &text = buffer.batch.text;
+                StagedLine line{order,
+                                level,
+                                header.time,
+                                header.monotonic,
+                                header.simulationTime,
+                                header.step,
+                                text.size(),
+                                0,
+                                0};
+                appendLogPrefix(header, getStamps(), text);
+                line.prefixLength = text.size() - line.offset;
+                appendMessage(text);
+                text.push_back('\n');
+                line.length = text.size() - line.offset;
+                buffer.batch.lines.push_back(line);
+            }
+            _staged.fetch_add(1);
+
+            writeStaged();
+        }
+
+        void Logger::vLog(LogLevel level, const char *format, va_list args)
+        {
+            stageLine(level, [format, &args](std::string &text) {
+                appendLogMessage(text, format, args);
+            });
+        }
+
+        void Logger::logFormatArgs(LogLevel level, std::string_view format,
+                                   const LogFormatArg *args, std::size_t count)
+        {
+            if (!shouldLog(level))
+            {
+                return;
+            }
+            stageLine(level, [format, args, count](std::string &text) {
+                appendLogFormatArgs(text, format, args, count);
+            });
+        }
+
+        Logger::ThreadBuffer &Logger::getThreadBuffer()
+        {
+            // Remember the buffers of the last few loggers used by this thread, so alternating
+            // between loggers stays lock-free; the id, unlike the address, is never reused by a
+            // later logger. Every buffer the thread took is freed when it exits, so short-lived
+            // threads do not grow the logger's buffer list
+            struct Entry
+            {
+                std::uint64_t loggerId = 0;
+                ThreadBuffer *buffer   = nullptr;
+            };
+            struct Cache
+            {
+                std::array<Entry, CACHED_LOGGERS> entries;
+                std::size_t next = 0; /**< Entry replaced on the next miss. */
+                std::vector<std::weak_ptr<ThreadBuffer>> taken;
+
+                ~Cache()
+                {
+                    // A buffer outliving its logger is skipped; staged lines stay for the merge
+                    for (const std::weak_ptr<ThreadBuffer> &weak : taken)
+                    {
+                        if (const std::shared_ptr<ThreadBuffer> buffer = weak.lock())
+                        {
+                            buffer->owner.store(std::thread::id());
+                        }
+                    }
+                }
+
+                ThreadBuffer &remember(std::uint64_t loggerId, ThreadBuffer *buffer)
+                {
+                    entries[next] = {loggerId, buffer};
+                    next          = (next + 1) % entries.size();
+                    return *buffer;
+                }
+            };
+            thread_local Cache cache;
+            for (const Entry &entry : cache.entries)
+            {
+                if (entry.loggerId == _id)
+                {
+                    return *entry.buffer;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            const std::thread::id self = std::this_thread::get_id();
+            const auto owned =
+                std::find_if(_buffers.begin(), _buffers.end(),
+                             [self](const std::shared_ptr<ThreadBuffer> &buffer) {
+                                 return buffer->owner.load() == self;
+                             });
+            if (owned != _buffers.end())
+            {
+                return cache.remember(_id, owned->get());
+            }
+
+            // Take a buffer freed by an exited thread before creating one. Its unmerged lines are
+            // older than any this thread stages, so the batch stays in order
+            auto free = std::find_if(_buffers.begin(), _buffers.end(),
+                                     [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                                         return buffer->owner.load() == std::thread::id();
+                                     });
+            if (free == _buffers.end())
+            {
+                _buffers.push_back(std::make_shared<ThreadBuffer>());
+                free = std::prev(_buffers.end());
+            }
+            (*free)->owner.store(self);
+
+            std::erase_if(cache.taken, [](const std::weak_ptr<ThreadBuffer> &weak) {
+                return weak.expired();
+            });
+            cache.taken.push_back(*free);
+            return cache.remember(_id, free->get());
+        }
+
+        void Logger::writeStaged()
         {
-            switch (level)
-            {
-                case LogLevel::Debug:
-                    return "Debug";
-                    break;
-                case LogLevel::Info:
-                    return "Info";
-                    break;
-                case LogLevel::Warning:
-                    return "Warning";
-                    break;
-                case LogLevel::Error:
-                    return "Error";
-                    break;
-                case LogLevel::Critical:
-                    return "Critical";
-                    break;
-                default:
-                    return "Unknown";
+            // Sequentially consistent: a thread failing to take _writing has staged its line
+            // before the holder re-reads _staged
+            while (_staged.load() > 0 && !_writing.exchange(true))
+            {
+                mergeStaged();
+                _writing.store(false);
+            }
+        }
+
+        void Logger::lockSinks()
+        {
+            while (_writing.exchange(true))
+            {
+                std::this_thread::yield();
             }
         }
 
+        void Logger::unlockSinks()
+        {
+            _writing.store(false);
+            writeStaged();
+        }
+
+        void Logger::mergeStaged()
+        {
+            // Swap each thread's batch with an empty one, keeping the allocations in circulation
+            {
+                std::lock_guard<std::mutex> lock(_buffersMutex);
+                if (_merging.size() < _buffers.size())
+                {
+                    _merging.resize(_buffers.size());
+                }
+                for (std::size_t i = 0; i < _buffers.size(); ++i)
+                {
+                    std::lock_guard<std::mutex> bufferLock(_buffers[i]->mutex);
+                    std::swap(_merging[i], _buffers[i]->batch);
+                }
+            }
+
+            _order.clear();
+            for (const StagedBatch &batch : _merging)
+            {
+                for (const StagedLine &line : batch.lines)
+                {
+                    _order.push_back({&line, &batch.text});
+                }
+            }
+            if (_order.empty())
+            {
+                return;
+            }
+            _staged.fetch_sub(static_cast<std::int64_t>(_order.size()));
+
+            // Each batch is already in order; merge them by timestamp
+            std::stable_sort(_order.begin(), _order.end(),
+                             [](const MergedLine &a, const MergedLine &b) {
+                                 return a.line->order < b.line->order;
+                             });
+
+            LogRecord record;
+            for (const MergedLine &merged : _order)
+            {
+                const StagedLine &line = *merged.line;
+                const std::string_view text(merged.text->data() + line.offset, line.length);
+
+                // Record sinks get the message text, truncated to fit the record
+                if (_recordSinks)
+                {
+                    record.level          = line.level;
+                    record.time           = line.time;
+                    record.monotonic      = line.monotonic;
+                    record.simulationTime = line.simulationTime;
+                    record.step           = line.step;
+                    record.format         = nullptr;
+                    record.length         = static_cast<std::uint32_t>(std::min(
+                        line.length - line.prefixLength - 1, LogRecord::MAX_MESSAGE_LENGTH - 1));
+                    std::memcpy(record.message, text.data() + line.prefixLength, record.length);
+                }
+
+                for (const SinkEntry &entry : _sinks)
+                {
+                    if (!entry.enabled)
+                    {
+                        continue;
+                    }
+                    if (entry.sink->consumesRecords())
+                    {
+                        entry.sink->writeRecord(record);
+                    }
+                    else
+                    {
+                        entry.sink->write(line.level, text);
+                    }
+                    if (_autoFlush)
+                    {
+                        entry.sink->flush();
+                    }
+                }
+            }
+
+            for (StagedBatch &batch : _merging)
+            {
+                batch.text.clear();
+                batch.lines.clear();
+            }
+        }
+
+        const char *Logger::logLevelToString(LogLevel level) const
+        {
+            return logLevelName(level);
+        }
+
     }  // namespace Tools
 }  // namespace Core
 }  // namespace InertiaFX
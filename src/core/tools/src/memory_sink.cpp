@@ -0,0 +1,79 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file memory_sink.cpp
+ * @brief Definition of the MemorySink class.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "memory_sink.h"
+#include <algorithm>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        MemorySink::MemorySink(std::size_t capacity) :
+            _lines(std::max<std::size_t>(capacity, 1)), _written(0)
+        {
+        }
+
+        void MemorySink::write(LogLevel, std::string_view line)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _lines[_written % _lines.size()].assign(line);
+            ++_written;
+        }
+
+        void MemorySink::flush()
+        {
+        }
+
+        std::vector<std::string> MemorySink::getLines() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const std::size_t count = std::min(_written, _lines.size());
+            const std::size_t first = _written - count;
+
+            std::vector<std::string> lines;
+            lines.reserve(count);
+            for (std::size_t i = first; i < _written; ++i)
+            {
+                lines.push_back(_lines[i % _lines.size()]);
+            }
+            return lines;
+        }
+
+        std::size_t MemorySink::getWrittenCount() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _written;
+        }
+
+        void MemorySink::clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _written = 0;
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,237 @@
+/**
+ * InertiaFX_Lib - Physics Simulation Library.
+ * Copyright (C) 2025  Ricardo Tonet <https://github.com/blackchacal>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file trace.cpp
+ * @brief Definition of the Tracer class and the Chrome Trace Event export.
+ *
+ * @date 17, Oct 2026
+ */
+
+#include "trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+namespace InertiaFX
+{
+namespace Core
+{
+    namespace Tools
+    {
+        namespace
+        {
+            // Writes text as a JSON string, quotes included
+            void writeJsonString(std::ostream &out, const char *text)
+            {
+                out.put('"');
+                for (; *text != '\0'; ++text)
+                {
+                    const unsigned char c = static_cast<unsigned char>(*text);
+                    if (c == '"' || c == '\\')
+                    {
+                        out.put('\\');
+                        out.put(static_cast<char>(c));
+                    }
+                    else if (c < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out << escaped;
+                    }
+                    else
+                    {
+                        out.put(static_cast<char>(c));
+                    }
+                }
+                out.put('"');
+            }
+
+            // Writes nanoseconds as microseconds, the unit of the trace format
+            void writeMicroseconds(std::ostream &out, std::int64_t nanoseconds)
+            {
+                char text[32];
+                std::snprintf(text, sizeof(text), "%lld.%03lld",
+                              static_cast<long long>(nanoseconds / 1000),
+                              static_cast<long long>(nanoseconds % 1000));
+                out << text;
+            }
+        }  // namespace
+
+        Tracer &Tracer::instance()
+        {
+            // Never destroyed, so threads still running at exit can record safely
+            static Tracer *const tracer = new Tracer();
+            return *tracer;
+        }
+
+        Tracer::Tracer() : _enabled(false), _capacity(DEFAULT_BUFFER_CAPACITY)
+        {
+        }
+
+        void Tracer::enable()
+        {
+            _enabled.store(true, std::memory_order_relaxed);
+        }
+
+        void Tracer::disable()
+        {
+            _enabled.store(false, std::memory_order_relaxed);
+        }
+
+        void Tracer::setBufferCapacity(std::size_t capacity)
+        {
+            _capacity.store(std::max<std::size_t>(capacity, 1), std::memory_order_relaxed);
+        }
+
+        void Tracer::setThreadName(const std::string &name)
+        {
+            ThreadBuffer &buffer = getThreadBuffer();
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            buffer.name = name;
+        }
+
+        void Tracer::record(const char *category, const char *name, std::int64_t begin,
+                            std::int64_t end)
+        {
+            ThreadBuffer &buffer = getThreadBuffer();
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            if (buffer.events.size() < buffer.capacity)
+            {
+                buffer.events.push_back(TraceEvent{category, name, begin, end});
+                return;
+            }
+            buffer.events[buffer.next] = TraceEvent{category, name, begin, end};
+            buffer.next                = (buffer.next + 1) % buffer.capacity;
+            ++buffer.overwritten;
+        }
+
+        void Tracer::clear()
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                buffer->events.clear();
+                buffer->capacity    = _capacity.load(std::memory_order_relaxed);
+                buffer->next        = 0;
+                buffer->overwritten = 0;
+            }
+        }
+
+        std::size_t Tracer::getEventCount() const
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            std::size_t count = 0;
+            for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                count += buffer->events.size();
+            }
+            return count;
+        }
+
+        std::uint64_t Tracer::getOverwrittenCount() const
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            std::uint64_t count = 0;
+            for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                count += buffer->overwritten;
+            }
+            return count;
+        }
+
+        void Tracer::writeChromeTrace(std::ostream &out) const
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            bool first = true;
+            for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+            {
+                // Copy the events so the thread is held up only briefly
+                std::vector<TraceEvent> events;
+                std::string name;
+                {
+                    std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                    events = buffer->events;
+                    name   = buffer->name;
+                }
+
+                out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                    << "\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+                writeJsonString(out, name.c_str());
+                out << "}}";
+                first = false;
+
+                for (const TraceEvent &event : events)
+                {
+                    out << ",\n{\"name\":";
+                    writeJsonString(out, event.name);
+                    out << ",\"cat\":";
+                    writeJsonString(out, event.category);
+                    out << ",\"ph\":\"X\",\"ts\":";
+                    writeMicroseconds(out, event.begin);
+                    out << ",\"dur\":";
+                    writeMicroseconds(out, event.end - event.begin);
+                    out << ",\"pid\":1,\"tid\":" << buffer->id << "}";
+                }
+            }
+            out << "\n]}\n";
+        }
+
+        void Tracer::writeChromeTrace(const std::string &filepath) const
+        {
+            std::ofstream file(filepath, std::ios::trunc);
+            if (!file)
+            {
+                throw std::runtime_error("Failed to open trace file: " + filepath);
+            }
+            writeChromeTrace(file);
+            if (!file.flush())
+            {
+                throw std::runtime_error("Failed to write trace file: " + filepath);
+            }
+        }
+
+        Tracer::ThreadBuffer &Tracer::getThreadBuffer()
+        {
+            // The tracer lives as long as the process, so the pointer never dangles
+            thread_local ThreadBuffer *cached = nullptr;
+            if (cached != nullptr)
+            {
+                return *cached;
+            }
+
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            _buffers.push_back(std::make_unique<ThreadBuffer>());
+            ThreadBuffer &buffer = *_buffers.back();
+            buffer.id            = static_cast<std::uint32_t>(_buffers.size());
+            buffer.name          = "Thread " + std::to_string(buffer.id);
+            buffer.capacity      = _capacity.load(std::memory_order_relaxed);
+            buffer.next          = 0;
+            buffer.overwritten   = 0;
+            cached               = &buffer;
+            return buffer;
+        }
+    }  // namespace Tools
+}  // namespace Core
+}  // namespace InertiaFX
@@ -0,0 +1,238 @@
+#include "async_logger.h"
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InertiaFX::Core::Tools;
+
+// Sink keeping every line; optionally holds the writer on its first write
+class CaptureSink : public ILogSink
+{
+  public:
+    void write(LogLevel level, std::string_view line) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (holdFirst && lines.empty())
+        {
+            entered = true;
+            changed.notify_all();
+            changed.wait(lock, [this] { return released; });
+        }
+        lines.emplace_back(line);
+        levels.push_back(level);
+    }
+
+    void flush() override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++flushes;
+    }
+
+    void waitUntilHeld()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return entered; });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+        changed.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::string> lines;
+    std::vector<LogLevel> levels;
+    int flushes    = 0;
+    bool holdFirst = false;
+    bool entered   = false;
+    bool released  = false;
+};
+
+class AsyncLoggerTest : public ::testing::Test
+{
+  protected:
+    // Creates a logger writing to a capture sink that stays readable after the logger dies
+    std::unique_ptr<AsyncLogger> makeLogger(std::size_t capacity, OverflowPolicy policy,
+                                            bool holdFirst = false)
+    {
+        auto logger        = std::make_unique<AsyncLogger>(capacity, policy);
+        auto capture       = std::make_unique<CaptureSink>();
+        capture->holdFirst = holdFirst;
+        sink               = capture.get();
+        logger->addSink(std::move(capture));
+        return logger;
+    }
+
+    CaptureSink *sink = nullptr;
+};
+
+// Test records reach the sinks formatted like the synchronous loggers
+TEST_F(AsyncLoggerTest, WritesFormattedLines)
+{
+    auto logger = makeLogger(16, OverflowPolicy::Block);
+    logger->log(LogLevel::Warning, "Step %d at %.1f s", 3, 0.5);
+    logger->flush();
+
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    ASSERT_EQ(sink->lines.size(), 1u);
+    std::regex pattern("\\[\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\] \\[Warning\\] "
+                       "Step 3 at 0.5 s\n");
+    EXPECT_TRUE(std::regex_match(sink->lines[0], pattern));
+    EXPECT_EQ(sink->levels[0], LogLevel::Warning);
+    EXPECT_GE(sink->flushes, 1);
+}
+
+// Test the threshold and the enable flag are honoured
+TEST_F(AsyncLoggerTest, ThresholdAndDisable)
+{
+    auto logger = makeLogger(16, OverflowPolicy::Block);
+    logger->setThreshold(LogLevel::Error);
+    logger->log(LogLevel::Info, "hidden");
+    logger->log(LogLevel::Error, "shown");
+    logger->disable();
+    logger->log(LogLevel::Critical, "hidden");
+    logger->enable();
+    logger->log(LogLevel::Critical, "shown");
+    logger->flush();
+
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    EXPECT_EQ(sink->lines.size(), 2u);
+}
+
+// Test drop-newest keeps the queued records and counts the rejected ones
+TEST_F(AsyncLoggerTest, DropNewestCountsDrops)
+{
+    auto logger = makeLogger(4, OverflowPolicy::DropNewest, true);
+    logger->log(LogLevel::Info, "held");
+    sink->waitUntilHeld();
+
+    for (int i = 0; i < 7; ++i)
+    {
+        logger->log(LogLevel::Info, "record %d", i);
+    }
+    EXPECT_EQ(logger->getDroppedCount(), 3u);
+
+    sink->release();
+    logger->flush();
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    ASSERT_EQ(sink->lines.size(), 5u);
+    EXPECT_NE(sink->lines.back().find("record 3"), std::string::npos);
+}
+
+// Test drop-oldest keeps the most recent records
+TEST_F(AsyncLoggerTest, DropOldestKeepsNewest)
+{
+    auto logger = makeLogger(4, OverflowPolicy::DropOldest, true);
+    logger->log(LogLevel::Info, "held");
+    sink->waitUntilHeld();
+
+    for (int i = 0; i < 7; ++i)
+    {
+        logger->log(LogLevel::Info, "record %d", i);
+    }
+    EXPECT_EQ(logger->getDroppedCount(), 3u);
+
+    sink->release();
+    logger->flush();
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    ASSERT_EQ(sink->lines.size(), 5u);
+    EXPECT_NE(sink->lines[1].find("record 3"), std::string::npos);
+    EXPECT_NE(sink->lines.back().find("record 6"), std::string::npos);
+}
+
+// Test the blocking policy delivers every record from concurrent producers
+TEST_F(AsyncLoggerTest, BlockDeliversEverything)
+{
+    constexpr int producers = 4;
+    constexpr int perThread = 2000;
+    auto logger             = makeLogger(8, OverflowPolicy::Block);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&logger, p] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                logger->log(LogLevel::Debug, "producer %d record %d", p, i);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    logger->flush();
+
+    EXPECT_EQ(logger->getDroppedCount(), 0u);
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    EXPECT_EQ(sink->lines.size(), static_cast<std::size_t>(producers * perThread));
+}
+
+// Sink appending to a vector owned by the test, so it can be read after the logger dies
+class VectorSink : public ILogSink
+{
+  public:
+    explicit VectorSink(std::vector<std::string> &lines) : _lines(lines)
+    {
+    }
+
+    void write(LogLevel, std::string_view line) override
+    {
+        _lines.emplace_back(line);
+    }
+
+    void flush() override
+    {
+    }
+
+  private:
+    std::vector<std::string> &_lines;
+};
+
+// Test destruction writes whatever is still queued
+TEST_F(AsyncLoggerTest, DestructorDrainsQueue)
+{
+    std::vector<std::string> lines;
+    {
+        AsyncLogger logger(64, OverflowPolicy::Block);
+        logger.addSink(std::make_unique<VectorSink>(lines));
+        for (int i = 0; i < 50; ++i)
+        {
+            logger.log(LogLevel::Info, "record %d", i);
+        }
+    }
+    EXPECT_EQ(lines.size(), 50u);
+}
+
+// Test long messages are truncated to the record size
+TEST_F(AsyncLoggerTest, TruncatesLongMessages)
+{
+    auto logger = makeLogger(4, OverflowPolicy::Block);
+    const std::string longMessage(2 * LogRecord::MAX_MESSAGE_LENGTH, 'x');
+    logger->log(LogLevel::Info, "%s", longMessage.c_str());
+    logger->flush();
+
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    ASSERT_EQ(sink->lines.size(), 1u);
+    EXPECT_NE(sink->lines[0].find(std::string(LogRecord::MAX_MESSAGE_LENGTH - 1, 'x') + "\n"),
+              std::string::npos);
+}
+
+// Test deferred records are formatted on the writer thread
+TEST_F(AsyncLoggerTest, DeferredRecordsAreFormatted)
+{
+    auto logger = makeLogger(16, OverflowPolicy::Block);
+    logger->logDeferred(LogLevel::Info, "Entity %u at %.1f m", 7u, 2.5);
+    logger->flush();
+
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    ASSERT_EQ(sink->lines.size(), 1u);
+    EXPECT_NE(sink->lines[0].find("[Info] Entity 7 at 2.5 m\n"), std::string::npos);
+}
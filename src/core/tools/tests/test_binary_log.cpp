@@ -0,0 +1,105 @@
+#include "async_logger.h"
+#include "binary_file_sink.h"
+#include "binary_log_reader.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace InertiaFX::Core::Tools;
+
+class BinaryLogTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    std::vector<std::string> decode()
+    {
+        std::ifstream input(path, std::ios::binary);
+        BinaryLogReader reader(input);
+        std::vector<std::string> lines;
+        std::string line;
+        while (reader.next(line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    const std::string path = "test_binary_log.bin";
+};
+
+// Test deferred and preformatted records decode to the text logger lines
+TEST_F(BinaryLogTest, RoundTrip)
+{
+    {
+        AsyncLogger logger(64, OverflowPolicy::Block);
+        logger.addSink(std::make_unique<BinaryFileSink>(path));
+        for (int step = 0; step < 3; ++step)
+        {
+            logger.logDeferred(LogLevel::Debug, "Step %d at %.2f s in %s", step, 0.25 * step,
+                               std::string("EmptySpace"));
+        }
+        logger.log(LogLevel::Error, "Formatted %s", "eagerly");
+    }
+
+    const std::vector<std::string> lines = decode();
+    ASSERT_EQ(lines.size(), 4u);
+    std::regex pattern("\\[\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\] \\[Debug\\] "
+                       "Step 2 at 0.50 s in EmptySpace\n");
+    EXPECT_TRUE(std::regex_match(lines[2], pattern));
+    EXPECT_NE(lines[3].find("[Error] Formatted eagerly\n"), std::string::npos);
+}
+
+// Test the clocks and simulation stamps survive the round trip
+TEST_F(BinaryLogTest, KeepsSimulationStamps)
+{
+    {
+        AsyncLogger logger(64, OverflowPolicy::Block);
+        logger.addSink(std::make_unique<BinaryFileSink>(path));
+        logger.setSimulationStamp(0.25, 7);
+        logger.logDeferred(LogLevel::Info, "Step %d", 7);
+    }
+
+    const std::vector<std::string> lines = decode();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("] [t=0.25 s] [step 7] [Info] Step 7\n"), std::string::npos);
+}
+
+// Test each format string is stored once
+TEST_F(BinaryLogTest, StoresFormatOnce)
+{
+    static const char *format = "A fairly long format string used by every record %d";
+    {
+        AsyncLogger logger(64, OverflowPolicy::Block);
+        logger.addSink(std::make_unique<BinaryFileSink>(path));
+        for (int i = 0; i < 10; ++i)
+        {
+            logger.logDeferred(LogLevel::Info, format, i);
+        }
+    }
+
+    std::ifstream input(path, std::ios::binary);
+    std::stringstream content;
+    content << input.rdbuf();
+    const std::string bytes = content.str();
+    EXPECT_EQ(bytes.find(format), bytes.rfind(format));
+    EXPECT_EQ(decode().size(), 10u);
+}
+
+// Test files that are not binary logs are rejected
+TEST_F(BinaryLogTest, RejectsOtherFiles)
+{
+    {
+        std::ofstream output(path);
+        output << "[2026-01-01 00:00:00] [Info] text log\n";
+    }
+    std::ifstream input(path, std::ios::binary);
+    EXPECT_THROW(BinaryLogReader reader(input), std::runtime_error);
+}
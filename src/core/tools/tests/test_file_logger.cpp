@@ -29,6 +29,7 @@ class FileLoggerTest : public ::testing::Test
 
     std::string ReadLogFile()
     {
+        logger->flush();  // Write out the buffered lines
         std::ifstream file(testLogPath);  // Open file in read mode
         if (!file.is_open())
         {
@@ -181,4 +182,19 @@ TEST_F(FileLoggerTest, MultipleMessages)
     EXPECT_TRUE(output.find("Message 1") != std::string::npos);
     EXPECT_TRUE(output.find("Message 2") != std::string::npos);
     EXPECT_TRUE(output.find("Message 3") != std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(FileLoggerTest, PrintToFile)
+{
+    logger->setPrintToFile(false);
+    testing::internal::CaptureStdout();
+    logger->log(LogLevel::Info, "Console only");
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    EXPECT_TRUE(ReadLogFile().empty());
+
+    logger->setPrintToFile(true);
+    testing::internal::CaptureStdout();
+    logger->log(LogLevel::Info, "Both");
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    EXPECT_TRUE(MatchLogPattern(ReadLogFile(), LogLevel::Info, "Both"));
+}
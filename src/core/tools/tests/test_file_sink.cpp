@@ -0,0 +1,189 @@
+#include "file_sink.h"
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace InertiaFX::Core::Tools;
+
+class FileSinkTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        for (const std::string &file : {path, path + ".1", path + ".2", path + ".3"})
+        {
+            std::filesystem::remove(file);
+        }
+    }
+
+    std::string read(const std::string &file) const
+    {
+        std::ifstream input(file, std::ios::binary);
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        return buffer.str();
+    }
+
+    // Buffers until told otherwise
+    static FileSinkOptions manual()
+    {
+        FileSinkOptions options;
+        options.flushLevel = std::nullopt;
+        return options;
+    }
+
+    const std::string path = "test_file_sink.log";
+};
+
+TEST_F(FileSinkTest, BuffersUntilFlush)
+{
+    FileSink sink(path, manual());
+    sink.write(LogLevel::Info, "one\n");
+    sink.write(LogLevel::Error, "two\n");
+    EXPECT_TRUE(read(path).empty());
+    EXPECT_EQ(sink.getBufferedSize(), 8u);
+
+    sink.flush();
+    EXPECT_EQ(read(path), "one\ntwo\n");
+    EXPECT_EQ(sink.getWriteCount(), 1u);
+    EXPECT_EQ(sink.getBufferedSize(), 0u);
+}
+
+TEST_F(FileSinkTest, FlushesOnDestruction)
+{
+    {
+        FileSink sink(path, manual());
+        sink.write(LogLevel::Info, "line\n");
+    }
+    EXPECT_EQ(read(path), "line\n");
+}
+
+TEST_F(FileSinkTest, FlushEveryRecords)
+{
+    FileSinkOptions options   = manual();
+    options.flushEveryRecords = 2;
+    FileSink sink(path, options);
+
+    sink.write(LogLevel::Info, "one\n");
+    EXPECT_TRUE(read(path).empty());
+    sink.write(LogLevel::Info, "two\n");
+    EXPECT_EQ(read(path), "one\ntwo\n");
+    EXPECT_EQ(sink.getWriteCount(), 1u);
+}
+
+TEST_F(FileSinkTest, FlushOnLevel)
+{
+    FileSink sink(path);
+    sink.write(LogLevel::Info, "info\n");
+    EXPECT_TRUE(read(path).empty());
+    sink.write(LogLevel::Warning, "warning\n");
+    EXPECT_EQ(read(path), "info\nwarning\n");
+}
+
+TEST_F(FileSinkTest, FlushInterval)
+{
+    FileSinkOptions options = manual();
+    options.flushInterval   = std::chrono::milliseconds(1);
+    FileSink sink(path, options);
+
+    // The timer writes the line out without waiting for another record
+    sink.write(LogLevel::Info, "one\n");
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (read(path).empty() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(read(path), "one\n");
+    EXPECT_EQ(sink.getBufferedSize(), 0u);
+}
+
+TEST_F(FileSinkTest, CoalescesUntilBufferIsFull)
+{
+    FileSinkOptions options = manual();
+    options.bufferSize      = 16;
+    FileSink sink(path, options);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        sink.write(LogLevel::Info, "line 0\n");  // 7 bytes, two per buffer
+    }
+    EXPECT_EQ(sink.getWriteCount(), 2u);
+    EXPECT_EQ(read(path).size(), 28u);
+
+    // Longer than the buffer: written directly, after what was buffered
+    sink.write(LogLevel::Info, std::string(20, 'x') + "\n");
+    EXPECT_EQ(sink.getWriteCount(), 4u);
+    EXPECT_EQ(read(path).size(), 63u);
+}
+
+TEST_F(FileSinkTest, RotatesBySize)
+{
+    FileSinkOptions options = manual();
+    options.maxFileSize     = 30;
+    options.maxBackups      = 2;
+    {
+        FileSink sink(path, options);
+        for (int i = 0; i < 8; ++i)
+        {
+            sink.write(LogLevel::Info, "record " + std::to_string(i) + "\n");  // 9 bytes
+        }
+    }
+
+    // Three records per file, the oldest file dropped
+    EXPECT_EQ(read(path), "record 6\nrecord 7\n");
+    EXPECT_EQ(read(path + ".1"), "record 3\nrecord 4\nrecord 5\n");
+    EXPECT_EQ(read(path + ".2"), "record 0\nrecord 1\nrecord 2\n");
+    EXPECT_FALSE(std::filesystem::exists(path + ".3"));
+}
+
+TEST_F(FileSinkTest, Truncate)
+{
+    FileSink sink(path, manual());
+    sink.write(LogLevel::Info, "written\n");
+    sink.flush();
+    sink.write(LogLevel::Info, "buffered\n");
+
+    sink.truncate();
+    sink.flush();
+    EXPECT_TRUE(read(path).empty());
+
+    sink.write(LogLevel::Info, "after\n");
+    sink.flush();
+    EXPECT_EQ(read(path), "after\n");
+}
+
+TEST_F(FileSinkTest, FlushesOnTerminate)
+{
+    EXPECT_DEATH(
+        {
+            FileSinkOptions options  = manual();
+            options.flushOnTerminate = true;
+            FileSink sink(path, options);
+            sink.write(LogLevel::Info, "last words\n");
+            std::terminate();
+        },
+        "");
+    EXPECT_EQ(read(path), "last words\n");
+}
+
+TEST_F(FileSinkTest, TerminateHandlerIsOptIn)
+{
+    const std::terminate_handler original = std::get_terminate();
+    {
+        FileSink sink(path, manual());
+        EXPECT_EQ(std::get_terminate(), original);
+    }
+
+    FileSinkOptions options  = manual();
+    options.flushOnTerminate = true;
+    {
+        FileSink first(path, options);
+        FileSink second(path, options);
+        EXPECT_NE(std::get_terminate(), original);
+    }
+    EXPECT_EQ(std::get_terminate(), original);
+}
@@ -0,0 +1,93 @@
+#include "log_arguments.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+// Test fixture encoding arguments and formatting them back
+class LogArgumentsTest : public ::testing::Test
+{
+  protected:
+    template <typename... Args> std::string format(const char *format, const Args &...args)
+    {
+        char payload[MAX_LOG_PAYLOAD];
+        const std::uint32_t length = encodeLogArguments(payload, sizeof(payload), args...);
+        std::string out;
+        formatLogArguments(format, payload, length, out);
+        return out;
+    }
+};
+
+// Test the common conversions match printf
+TEST_F(LogArgumentsTest, MatchesPrintf)
+{
+    EXPECT_EQ(format("Step %d of %u", -3, 10u), "Step -3 of 10");
+    EXPECT_EQ(format("%.3f s, %g m", 0.125, 1e-9), "0.125 s, 1e-09 m");
+    EXPECT_EQ(format("[%5s|%-4d|%05.1f]", "ab", 7, 3.14159), "[   ab|7   |003.1]");
+    EXPECT_EQ(format("%ld %llu %zu %x", 1L, 2ULL, std::size_t{3}, 255), "1 2 3 ff");
+    EXPECT_EQ(format("%c%c", 'o', 'k'), "ok");
+    EXPECT_EQ(format("100%% done"), "100% done");
+}
+
+// Test strings are copied, whatever their type
+TEST_F(LogArgumentsTest, CopiesStrings)
+{
+    std::string unit = "m/s";
+    EXPECT_EQ(format("%s %s %s", unit, std::string_view("kg"), static_cast<const char *>(nullptr)),
+              "m/s kg (null)");
+}
+
+// Test star width and precision take their value from the arguments
+TEST_F(LogArgumentsTest, StarWidthAndPrecision)
+{
+    EXPECT_EQ(format("[%*.*f]", 8, 2, 3.14159), "[    3.14]");
+}
+
+// Test numbers are converted to the type the conversion expects
+TEST_F(LogArgumentsTest, ConvertsMismatchedNumbers)
+{
+    EXPECT_EQ(format("%d %f %s", 2.9, 1, 42), "2 1.000000 42");
+}
+
+// Test conversions without an argument are copied through
+TEST_F(LogArgumentsTest, MissingArgumentsAreKept)
+{
+    EXPECT_EQ(format("%d and %s", 5), "5 and %s");
+}
+
+// Test a long string is cut to the payload size rather than overflowing it
+TEST_F(LogArgumentsTest, TruncatesLongStrings)
+{
+    const std::string longText(2 * MAX_LOG_PAYLOAD, 'x');
+    const std::string out = format("%s|%d", longText, 1);
+    EXPECT_EQ(out, std::string(MAX_LOG_PAYLOAD - 5, 'x') + "|%d");
+}
+
+// Test a payload that overflows ends at the last argument written, with no unwritten bytes
+TEST_F(LogArgumentsTest, OverflowKeepsCompleteArguments)
+{
+    char payload[MAX_LOG_PAYLOAD];
+    LogArgumentWriter writer(payload, sizeof(payload));
+    const std::string text(MAX_LOG_PAYLOAD - 20, 'x');
+    writer.write(text);
+    const std::uint32_t afterString = writer.size();
+    EXPECT_EQ(afterString, 1 + sizeof(std::uint32_t) + text.size());
+    EXPECT_FALSE(writer.isTruncated());
+
+    writer.write(1.5);
+    writer.write(2);
+    EXPECT_EQ(writer.size(), afterString + 9);
+    EXPECT_TRUE(writer.isTruncated());
+
+    // Later arguments stay out even when they would fit
+    writer.write(std::string_view());
+    EXPECT_EQ(writer.size(), afterString + 9);
+    EXPECT_LT(writer.size(), MAX_LOG_PAYLOAD);
+}
+
+// Test character arrays and literals are encoded as strings
+TEST_F(LogArgumentsTest, EncodesCharacterArrays)
+{
+    const char name[] = "ball";
+    EXPECT_EQ(format("%s %s", name, "literal"), "ball literal");
+}
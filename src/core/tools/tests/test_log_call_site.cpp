@@ -0,0 +1,126 @@
+#include "log_call_site.h"
+#include "log_macros.h"
+#include "logger.h"
+#include "memory_sink.h"
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InertiaFX::Core::Tools;
+
+class LogCallSiteTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // The macros' static call sites outlive a test; start each one afresh
+        LogCallSite::resetAll();
+        logger.clearSinks();
+        logger.setStamps(0);
+        sink = &static_cast<MemorySink &>(logger.addSink(std::make_unique<MemorySink>(64)));
+    }
+
+    std::vector<std::string> lines() const
+    {
+        return sink->getLines();
+    }
+
+    Logger logger;
+    MemorySink *sink = nullptr;
+};
+
+TEST_F(LogCallSiteTest, RateLimit)
+{
+    LogCallSite site(__FILE__, __LINE__);
+    int allowed = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        allowed += site.allowRate(3, std::chrono::milliseconds(20)) ? 1 : 0;
+    }
+    EXPECT_EQ(allowed, 3);
+    EXPECT_EQ(site.getSuppressedCount(), 7u);
+
+    // A new window lets messages through again
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(site.allowRate(3, std::chrono::milliseconds(20)));
+}
+
+TEST_F(LogCallSiteTest, Sampling)
+{
+    LogCallSite site(__FILE__, __LINE__);
+    std::vector<int> allowed;
+    for (int i = 0; i < 10; ++i)
+    {
+        if (site.allowSample(4))
+        {
+            allowed.push_back(i);
+        }
+    }
+    EXPECT_EQ(allowed, (std::vector<int>{0, 4, 8}));
+    EXPECT_EQ(site.getSuppressedCount(), 7u);
+}
+
+TEST_F(LogCallSiteTest, Once)
+{
+    LogCallSite site(__FILE__, __LINE__);
+    EXPECT_TRUE(site.allowOnce());
+    EXPECT_FALSE(site.allowOnce());
+    EXPECT_FALSE(site.allowOnce());
+    EXPECT_EQ(site.getSuppressedCount(), 2u);
+}
+
+TEST_F(LogCallSiteTest, SuppressedReportIsPeriodic)
+{
+    LogCallSite site(__FILE__, __LINE__);
+    site.allowOnce();
+    site.allowOnce();
+    site.allowOnce();
+    EXPECT_EQ(site.takeSuppressedReport(std::chrono::hours(1)), 0u);
+    EXPECT_EQ(site.takeSuppressedReport(std::chrono::nanoseconds(0)), 2u);
+    EXPECT_EQ(site.takeSuppressedReport(std::chrono::nanoseconds(0)), 0u);
+}
+
+TEST_F(LogCallSiteTest, Macros)
+{
+    for (int entity = 0; entity < 100; ++entity)
+    {
+        IFX_LOG_WARNING_RATE_LIMITED(&logger, 2, "Entity %d left the world", entity);
+        IFX_LOG_INFO_SAMPLED(&logger, 50, "Entity %d sampled", entity);
+        IFX_LOG_ERROR_ONCE(&logger, "Entity %d first", entity);
+    }
+
+    EXPECT_EQ(lines(), (std::vector<std::string>{
+                           "[Warning] Entity 0 left the world\n", "[Info] Entity 0 sampled\n",
+                           "[Error] Entity 0 first\n", "[Warning] Entity 1 left the world\n",
+                           "[Info] Entity 50 sampled\n"}));
+}
+
+TEST_F(LogCallSiteTest, ReportAll)
+{
+    const unsigned int line = __LINE__ + 3;
+    for (int entity = 0; entity < 5; ++entity)
+    {
+        IFX_LOG_INFO_ONCE(&logger, "Entity %d", entity);
+    }
+    sink->clear();
+
+    LogCallSite::reportAll(logger, LogLevel::Info);
+    const std::string expected = "[Info] 4 similar messages suppressed at " +
+                                 std::string(__FILE__) + ":" + std::to_string(line) + ".\n";
+
+    // Call sites of other tests may report too
+    const std::vector<std::string> reported = lines();
+    EXPECT_NE(std::find(reported.begin(), reported.end(), expected), reported.end());
+}
+
+TEST_F(LogCallSiteTest, FilteredLevelIsNotCounted)
+{
+    logger.setThreshold(LogLevel::Error);
+    LogCallSite site(__FILE__, __LINE__);
+    logger.logOnce(site, LogLevel::Info, "Filtered");
+    EXPECT_EQ(site.getSuppressedCount(), 0u);
+    EXPECT_TRUE(lines().empty());
+}
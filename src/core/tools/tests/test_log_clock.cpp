@@ -0,0 +1,86 @@
+#include "log_clock.h"
+#include "log_record.h"
+#include "logger.h"
+#include "memory_sink.h"
+#include <chrono>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+// Test the local time is only converted again when the second changes
+TEST(TimestampCacheTest, ConvertsOncePerSecond)
+{
+    TimestampCache cache;
+    const std::time_t now   = std::time(nullptr);
+    const std::string first = std::string(cache.format(now));
+    EXPECT_EQ(cache.format(now), first);
+    EXPECT_EQ(cache.getConversionCount(), 1u);
+
+    EXPECT_NE(cache.format(now + 1), first);
+    EXPECT_EQ(cache.getConversionCount(), 2u);
+    EXPECT_TRUE(std::regex_match(first, std::regex("\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}")));
+}
+
+TEST(TimestampCacheTest, MonotonicTimeIncreases)
+{
+    const std::int64_t first = getLogMonotonicTime();
+    EXPECT_GE(getLogMonotonicTime(), first);
+    EXPECT_GE(first, 0);
+}
+
+class LogStampTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        logger.clearSinks();
+        sink = &static_cast<MemorySink &>(logger.addSink(std::make_unique<MemorySink>(8)));
+    }
+
+    std::string lastLine() const
+    {
+        return sink->getLines().back();
+    }
+
+    Logger logger;
+    MemorySink *sink = nullptr;
+};
+
+TEST_F(LogStampTest, DefaultIsDateOnly)
+{
+    logger.log(LogLevel::Info, "message");
+    EXPECT_TRUE(std::regex_match(
+        lastLine(),
+        std::regex("\\[\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\] \\[Info\\] message\n")));
+}
+
+TEST_F(LogStampTest, SubSecondAndMonotonic)
+{
+    logger.setStamps(LogStamp::Date | LogStamp::Microseconds | LogStamp::Monotonic);
+    logger.log(LogLevel::Info, "message");
+    EXPECT_TRUE(std::regex_match(lastLine(), std::regex("\\[\\d{4}-\\d{2}-\\d{2} "
+                                                        "\\d{2}:\\d{2}:\\d{2}\\.\\d{6}\\] "
+                                                        "\\[\\+\\d+\\.\\d{6}\\] \\[Info\\] "
+                                                        "message\n")));
+}
+
+TEST_F(LogStampTest, SimulationStamps)
+{
+    logger.setStamps(LogStamp::Simulation);
+
+    // Nothing to print before a simulation time is set
+    logger.log(LogLevel::Info, "before");
+    EXPECT_EQ(lastLine(), "[Info] before\n");
+
+    logger.setSimulationStamp(1.5, 42);
+    logger.log(LogLevel::Warning, "during");
+    EXPECT_EQ(lastLine(), "[t=1.5 s] [step 42] [Warning] during\n");
+
+    logger.clearSimulationStamp();
+    EXPECT_TRUE(std::isnan(logger.getSimulationTime()));
+    logger.log(LogLevel::Info, "after");
+    EXPECT_EQ(lastLine(), "[Info] after\n");
+}
@@ -0,0 +1,95 @@
+#include "log_format.h"
+#include "logger.h"
+#include "memory_sink.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+namespace
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    enum class Mode : std::uint8_t
+    {
+        Idle = 2
+    };
+
+    template <typename... Args> std::string format(std::string_view format, const Args &...args)
+    {
+        std::string out;
+        appendLogFormat(out, format, args...);
+        return out;
+    }
+}  // namespace
+
+// A type made loggable by the test
+template <> struct InertiaFX::Core::Tools::LogFormatter<Point>
+{
+    static void format(std::string &out, const Point &point, const LogFormatSpec &spec)
+    {
+        out.push_back('<');
+        appendLogInteger(out, point.x, spec);
+        out.push_back(',');
+        appendLogInteger(out, point.y, spec);
+        out.push_back('>');
+    }
+};
+
+// Test numbers are written in their shortest exact form by default
+TEST(LogFormatTest, WritesBuiltInTypes)
+{
+    EXPECT_EQ(format("Step {} of {}", -3, 10u), "Step -3 of 10");
+    EXPECT_EQ(format("{} s, {} m, {}", 0.1, 1e-9, 2.0), "0.1 s, 1e-09 m, 2");
+    EXPECT_EQ(format("{} {} {}", true, 'c', Mode::Idle), "true c 2");
+    EXPECT_EQ(format("{} {} {}", std::string("m/s"), std::string_view("kg"), "N"), "m/s kg N");
+    EXPECT_EQ(format("{}", static_cast<const char *>(nullptr)), "(null)");
+}
+
+// Test the precision and presentation type of a placeholder
+TEST(LogFormatTest, AppliesSpecifications)
+{
+    EXPECT_EQ(format("{:.3f}", 0.125), "0.125");
+    EXPECT_EQ(format("{:.2f}", 1e20), "100000000000000000000.00");
+    EXPECT_EQ(format("{:.3}", 3.14159), "3.14");
+    EXPECT_EQ(format("{:e}", 1500.0), "1.5e+03");
+    EXPECT_EQ(format("{:x}", 255), "ff");
+}
+
+// Test indexed placeholders, escaped braces and placeholders without an argument
+TEST(LogFormatTest, ParsesPlaceholders)
+{
+    EXPECT_EQ(format("{1} before {0}", "a", "b"), "b before a");
+    EXPECT_EQ(format("{{{}}}", 5), "{5}");
+    EXPECT_EQ(format("{} and {}", 1), "1 and {}");
+    EXPECT_EQ(format("{7} {x}", 1), "{7} {x}");
+    EXPECT_EQ(format("open {", 1), "open {");
+}
+
+// Test types with a LogFormatter specialisation are written by it
+TEST(LogFormatTest, UsesCustomFormatters)
+{
+    EXPECT_EQ(format("at {}", Point{3, -4}), "at <3,-4>");
+    EXPECT_EQ(format("at {:x}", Point{10, 11}), "at <a,b>");
+}
+
+// Test a logger formats into its staging buffer and skips rejected levels
+TEST(LogFormatTest, LoggerFormatsMessages)
+{
+    Logger logger;
+    logger.clearSinks();
+    logger.setStamps(0);
+    auto &sink = static_cast<MemorySink &>(logger.addSink(std::make_unique<MemorySink>(4)));
+
+    logger.logFormat(LogLevel::Info, "Step {} took {:.2f} s", 7, 0.5);
+    logger.setThreshold(LogLevel::Warning);
+    logger.logFormat(LogLevel::Info, "Dropped {}", 8);
+
+    ASSERT_EQ(sink.getWrittenCount(), 1u);
+    EXPECT_EQ(sink.getLines().front(), "[Info] Step 7 took 0.50 s\n");
+}
@@ -0,0 +1,91 @@
+// Compile Debug calls out of this file only, whatever the build sets
+#undef IFX_LOG_MIN_LEVEL
+#define IFX_LOG_MIN_LEVEL IFX_LOG_LEVEL_INFO
+
+#include "log_macros.h"
+#include "logger.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+// Logger recording the last message instead of printing it
+class RecordingLogger : public Logger
+{
+  public:
+    void log(LogLevel level, const char *format, ...) override
+    {
+        va_list args;
+        va_start(args, format);
+        char buffer[256];
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        lastLevel   = level;
+        lastMessage = buffer;
+        ++calls;
+    }
+
+    LogLevel lastLevel = LogLevel::Debug;
+    std::string lastMessage;
+    int calls = 0;
+};
+
+class LogMacrosTest : public ::testing::Test
+{
+  protected:
+    // Counts evaluations, to check arguments of discarded messages are never built
+    int argument()
+    {
+        return ++evaluations;
+    }
+
+    RecordingLogger logger;
+    int evaluations = 0;
+};
+
+// Test enabled levels reach the logger, formatted
+TEST_F(LogMacrosTest, LogsEnabledLevels)
+{
+    IFX_LOG_WARNING(&logger, "Step %d of %s", 3, std::string("run"));
+    EXPECT_EQ(logger.calls, 1);
+    EXPECT_EQ(logger.lastLevel, LogLevel::Warning);
+    EXPECT_EQ(logger.lastMessage, "Step 3 of run");
+}
+
+// Test levels below the compile-time minimum are compiled out
+TEST_F(LogMacrosTest, CompiledOutBelowMinimum)
+{
+    IFX_LOG_DEBUG(&logger, "value %d", argument());
+    IFX_LOG_DEBUG_RATE_LIMITED(&logger, 1, "value %d", argument());
+    IFX_LOG_DEBUG_SAMPLED(&logger, 1, "value %d", argument());
+    IFX_LOG_DEBUG_ONCE(&logger, "value %d", argument());
+    EXPECT_EQ(logger.calls, 0);
+    EXPECT_EQ(evaluations, 0);
+}
+
+// Test arguments are not evaluated below the runtime threshold or when disabled
+TEST_F(LogMacrosTest, RuntimeCheckPrecedesArguments)
+{
+    logger.setThreshold(LogLevel::Error);
+    IFX_LOG_INFO(&logger, "value %d", argument());
+    EXPECT_FALSE(logger.shouldLog(LogLevel::Warning));
+    EXPECT_TRUE(logger.shouldLog(LogLevel::Error));
+
+    logger.setThreshold(LogLevel::Debug);
+    logger.disable();
+    IFX_LOG_CRITICAL(&logger, "value %d", argument());
+    EXPECT_FALSE(logger.shouldLog(LogLevel::Critical));
+
+    logger.enable();
+    IFX_LOG_INFO(&logger, "value %d", argument());
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(logger.calls, 1);
+}
+
+// Test a null logger is accepted
+TEST_F(LogMacrosTest, NullLoggerIsIgnored)
+{
+    ILogger *none = nullptr;
+    IFX_LOG_ERROR(none, "value %d", argument());
+    EXPECT_EQ(evaluations, 0);
+}
@@ -1,10 +1,13 @@
 #include "logger.h"
+#include "memory_sink.h"
 #include <cstdio>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace InertiaFX::Core::Tools;
 
@@ -132,4 +135,192 @@ TEST_F(LoggerTest, Formatting)
     logger->log(LogLevel::Info, "Test %s %d", "number", 42);
     std::string output = testing::internal::GetCapturedStdout();
     EXPECT_TRUE(MatchLogPattern(output, LogLevel::Info, "Test number 42"));
-}
\ No newline at end of file
+}
+// Counts the writes it receives and keeps the last line
+class CountingSink : public ILogSink
+{
+  public:
+    void write(LogLevel level, std::string_view line) override
+    {
+        lastLevel = level;
+        lastLine  = line;
+        ++writes;
+    }
+
+    void flush() override
+    {
+        ++flushes;
+    }
+
+    LogLevel lastLevel = LogLevel::Debug;
+    std::string lastLine;
+    int writes  = 0;
+    int flushes = 0;
+};
+
+TEST_F(LoggerTest, DefaultConsoleSink)
+{
+    EXPECT_EQ(logger->getSinkCount(), 1u);
+
+    logger->clearSinks();
+    EXPECT_EQ(logger->getSinkCount(), 0u);
+    testing::internal::CaptureStdout();
+    logger->log(LogLevel::Info, "Nowhere to go");
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(LoggerTest, FansOutOneLine)
+{
+    logger->clearSinks();
+    auto &custom = static_cast<CountingSink &>(logger->addSink(std::make_unique<CountingSink>()));
+    auto &memory = static_cast<MemorySink &>(logger->addSink(std::make_unique<MemorySink>(4)));
+
+    logger->log(LogLevel::Warning, "Step %d of %s", 3, "run");
+
+    EXPECT_EQ(custom.writes, 1);
+    EXPECT_EQ(custom.lastLevel, LogLevel::Warning);
+    EXPECT_TRUE(MatchLogPattern(custom.lastLine, LogLevel::Warning, "Step 3 of run"));
+    ASSERT_EQ(memory.getLines().size(), 1u);
+    EXPECT_EQ(memory.getLines()[0], custom.lastLine);
+}
+
+TEST_F(LoggerTest, SinkEnabled)
+{
+    logger->clearSinks();
+    auto &custom = static_cast<CountingSink &>(logger->addSink(std::make_unique<CountingSink>()));
+
+    logger->setSinkEnabled(custom, false);
+    logger->log(LogLevel::Info, "Skipped");
+    EXPECT_EQ(custom.writes, 0);
+
+    logger->setSinkEnabled(custom, true);
+    logger->log(LogLevel::Info, "Written");
+    EXPECT_EQ(custom.writes, 1);
+}
+
+TEST_F(LoggerTest, AutoFlush)
+{
+    logger->clearSinks();
+    auto &custom = static_cast<CountingSink &>(logger->addSink(std::make_unique<CountingSink>()));
+
+    logger->log(LogLevel::Info, "Message");
+    EXPECT_EQ(custom.flushes, 0);
+
+    logger->setAutoFlush(true);
+    logger->log(LogLevel::Info, "Message");
+    EXPECT_EQ(custom.flushes, 1);
+}
+
+TEST_F(LoggerTest, LongMessage)
+{
+    logger->clearSinks();
+    auto &custom = static_cast<CountingSink &>(logger->addSink(std::make_unique<CountingSink>()));
+
+    const std::string longMessage(5000, 'a');
+    logger->log(LogLevel::Info, "%s", longMessage.c_str());
+    EXPECT_TRUE(MatchLogPattern(custom.lastLine, LogLevel::Info, longMessage));
+}
+
+// Test lines from concurrent threads are neither lost nor interleaved, and keep their order
+TEST_F(LoggerTest, ConcurrentThreads)
+{
+    constexpr int THREADS  = 8;
+    constexpr int MESSAGES = 500;
+    logger->clearSinks();
+    auto sink    = std::make_unique<MemorySink>(THREADS * MESSAGES);
+    auto &memory = static_cast<MemorySink &>(logger->addSink(std::move(sink)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([this, t] {
+            for (int i = 0; i < MESSAGES; ++i)
+            {
+                logger->log(LogLevel::Info, "thread %d message %d", t, i);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    logger->flush();
+
+    const std::vector<std::string> lines = memory.getLines();
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(THREADS * MESSAGES));
+    std::vector<int> next(THREADS, 0);
+    for (const std::string &line : lines)
+    {
+        int t = -1;
+        int i = -1;
+        ASSERT_EQ(std::sscanf(line.c_str() + line.find("thread"), "thread %d message %d", &t, &i),
+                  2);
+        // Whole lines only: "[YYYY-MM-DD HH:MM:SS] " then exactly one message
+        ASSERT_EQ(line.substr(22), "[Info] thread " + std::to_string(t) + " message " +
+                                       std::to_string(i) + "\n");
+        EXPECT_EQ(i, next[t]++);
+    }
+}
+
+// Test threads that exit leave their staging buffer to later threads, with its lines intact
+TEST_F(LoggerTest, ExitedThreadsFreeTheirBuffers)
+{
+    constexpr int THREADS = 16;
+    logger->clearSinks();
+    auto &memory = static_cast<MemorySink &>(logger->addSink(std::make_unique<MemorySink>(64)));
+
+    for (int t = 0; t < THREADS; ++t)
+    {
+        std::thread([this, t] { logger->log(LogLevel::Info, "thread %d", t); }).join();
+    }
+    EXPECT_EQ(logger->getThreadBufferCount(), 1u);
+
+    logger->flush();
+    const std::vector<std::string> lines = memory.getLines();
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(THREADS));
+    for (int t = 0; t < THREADS; ++t)
+    {
+        EXPECT_TRUE(MatchLogPattern(lines[t], LogLevel::Info, "thread " + std::to_string(t)));
+    }
+}
+
+// Test a thread alternating between loggers stages each line in the right logger
+TEST_F(LoggerTest, AlternatingLoggers)
+{
+    std::vector<std::unique_ptr<Logger>> loggers;
+    std::vector<MemorySink *> sinks;
+    for (int i = 0; i < 6; ++i)
+    {
+        loggers.push_back(std::make_unique<Logger>());
+        loggers.back()->clearSinks();
+        sinks.push_back(
+            &static_cast<MemorySink &>(loggers.back()->addSink(std::make_unique<MemorySink>(8))));
+    }
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (std::size_t i = 0; i < loggers.size(); ++i)
+        {
+            loggers[i]->log(LogLevel::Info, "logger %zu round %d", i, round);
+        }
+    }
+    for (std::size_t i = 0; i < loggers.size(); ++i)
+    {
+        const std::vector<std::string> lines = sinks[i]->getLines();
+        ASSERT_EQ(lines.size(), 3u);
+        EXPECT_TRUE(MatchLogPattern(lines[2], LogLevel::Info,
+                                    "logger " + std::to_string(i) + " round 2"));
+        EXPECT_EQ(loggers[i]->getThreadBufferCount(), 1u);
+    }
+}
+
+TEST_F(LoggerTest, ThresholdFromAnotherThread)
+{
+    logger->clearSinks();
+    auto &custom = static_cast<CountingSink &>(logger->addSink(std::make_unique<CountingSink>()));
+
+    std::thread([this] { logger->setThreshold(LogLevel::Error); }).join();
+    logger->log(LogLevel::Warning, "Skipped");
+    logger->log(LogLevel::Error, "Written");
+    EXPECT_EQ(custom.writes, 1);
+}
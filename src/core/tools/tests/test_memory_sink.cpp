@@ -0,0 +1,43 @@
+#include "memory_sink.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace InertiaFX::Core::Tools;
+
+TEST(MemorySinkTest, KeepsLinesInOrder)
+{
+    MemorySink sink(4);
+    sink.write(LogLevel::Info, "one\n");
+    sink.write(LogLevel::Error, "two\n");
+
+    const auto lines = sink.getLines();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "one\n");
+    EXPECT_EQ(lines[1], "two\n");
+    EXPECT_EQ(sink.getWrittenCount(), 2u);
+}
+
+TEST(MemorySinkTest, KeepsMostRecent)
+{
+    MemorySink sink(3);
+    for (int i = 0; i < 7; ++i)
+    {
+        sink.write(LogLevel::Info, std::to_string(i));
+    }
+
+    const auto lines = sink.getLines();
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0], "4");
+    EXPECT_EQ(lines[1], "5");
+    EXPECT_EQ(lines[2], "6");
+    EXPECT_EQ(sink.getWrittenCount(), 7u);
+}
+
+TEST(MemorySinkTest, Clear)
+{
+    MemorySink sink(2);
+    sink.write(LogLevel::Info, "line\n");
+    sink.clear();
+    EXPECT_TRUE(sink.getLines().empty());
+    EXPECT_EQ(sink.getWrittenCount(), 0u);
+}
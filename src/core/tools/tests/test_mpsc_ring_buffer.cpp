@@ -0,0 +1,76 @@
+#include "mpsc_ring_buffer.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace InertiaFX::Core::Tools;
+
+// Test the capacity is rounded up to a power of two
+TEST(MpscRingBufferTest, CapacityIsPowerOfTwo)
+{
+    EXPECT_EQ(MpscRingBuffer<int>(0).capacity(), 2u);
+    EXPECT_EQ(MpscRingBuffer<int>(5).capacity(), 8u);
+    EXPECT_EQ(MpscRingBuffer<int>(16).capacity(), 16u);
+}
+
+// Test elements come out in order and a full buffer rejects pushes
+TEST(MpscRingBufferTest, FifoAndFull)
+{
+    MpscRingBuffer<int> buffer(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(buffer.tryPush([i](int &slot) { slot = i; }));
+    }
+    EXPECT_FALSE(buffer.tryPush([](int &slot) { slot = 99; }));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        int value = -1;
+        EXPECT_TRUE(buffer.tryPop([&value](int &slot) { value = slot; }));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(buffer.tryPop([](int &) {}));
+}
+
+// Test concurrent producers lose nothing and keep their own order
+TEST(MpscRingBufferTest, ConcurrentProducers)
+{
+    constexpr int producers = 4;
+    constexpr int perThread = 10000;
+    MpscRingBuffer<int> buffer(64);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&buffer, p] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                const int value = p * perThread + i;
+                while (!buffer.tryPush([value](int &slot) { slot = value; }))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> last(producers, -1);
+    int received = 0;
+    while (received < producers * perThread)
+    {
+        int value = 0;
+        if (buffer.tryPop([&value](int &slot) { value = slot; }))
+        {
+            const int producer = value / perThread;
+            EXPECT_GT(value % perThread, last[producer]);
+            last[producer] = value % perThread;
+            ++received;
+        }
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(received, producers * perThread);
+}
@@ -0,0 +1,111 @@
+// Compile the zones into this file only, whatever the build sets
+#undef IFX_TRACING_ENABLED
+#define IFX_TRACING_ENABLED 1
+
+#include "trace.h"
+#include "trace_macros.h"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace InertiaFX::Core::Tools;
+
+// Test fixture starting each test with an empty, enabled tracer
+class TraceTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Tracer::instance().setBufferCapacity(Tracer::DEFAULT_BUFFER_CAPACITY);
+        Tracer::instance().clear();
+        Tracer::instance().enable();
+    }
+
+    void TearDown() override
+    {
+        Tracer::instance().disable();
+        Tracer::instance().setBufferCapacity(Tracer::DEFAULT_BUFFER_CAPACITY);
+        Tracer::instance().clear();
+    }
+
+    static std::string exportTrace()
+    {
+        std::ostringstream out;
+        Tracer::instance().writeChromeTrace(out);
+        return out.str();
+    }
+};
+
+// Test nested zones are recorded, and nothing is recorded while disabled
+TEST_F(TraceTest, RecordsZonesWhileEnabled)
+{
+    {
+        IFX_TRACE_ZONE("test", "outer");
+        {
+            IFX_TRACE_ZONE("test", "inner");
+        }
+    }
+    EXPECT_EQ(Tracer::instance().getEventCount(), 2u);
+
+    Tracer::instance().disable();
+    {
+        IFX_TRACE_ZONE("test", "skipped");
+    }
+    EXPECT_EQ(Tracer::instance().getEventCount(), 2u);
+
+    const std::string trace = exportTrace();
+    EXPECT_NE(trace.find("\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"inner\""), std::string::npos);
+    EXPECT_EQ(trace.find("skipped"), std::string::npos);
+}
+
+// Test events are written in microseconds with their thread's name
+TEST_F(TraceTest, WritesChromeTraceEvents)
+{
+    std::thread worker([] {
+        IFX_TRACE_THREAD_NAME("Worker \"A\"");
+        Tracer::instance().record("test", "step", 1500, 4250);
+    });
+    worker.join();
+
+    const std::string trace = exportTrace();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find("\"ph\":\"M\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"Worker \\\"A\\\"\"}"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"step\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":1.500,"
+                         "\"dur\":2.750"),
+              std::string::npos);
+    EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+// Test a full buffer overwrites its oldest events
+TEST_F(TraceTest, OverwritesOldestEvents)
+{
+    Tracer::instance().setBufferCapacity(4);
+    Tracer::instance().clear();
+    for (std::int64_t i = 0; i < 10; ++i)
+    {
+        Tracer::instance().record("test", "event", i * 1000, i * 1000 + 1);
+    }
+
+    EXPECT_EQ(Tracer::instance().getEventCount(), 4u);
+    EXPECT_EQ(Tracer::instance().getOverwrittenCount(), 6u);
+    const std::string trace = exportTrace();
+    EXPECT_EQ(trace.find("\"ts\":5.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":6.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":9.000"), std::string::npos);
+}
+
+// Test the trace can be written to a file, and a bad path is reported
+TEST_F(TraceTest, WritesTraceFile)
+{
+    {
+        IFX_TRACE_ZONE("test", "zone");
+    }
+    EXPECT_NO_THROW(Tracer::instance().writeChromeTrace(std::string("test_trace.json")));
+    std::remove("test_trace.json");
+    EXPECT_THROW(Tracer::instance().writeChromeTrace(std::string("missing/dir/trace.json")),
+                 std::runtime_error);
+}